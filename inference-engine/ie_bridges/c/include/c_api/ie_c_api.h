@@ -45,6 +45,7 @@ typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
 typedef struct ie_blob ie_blob_t;
+typedef struct ie_infer_request_pool ie_infer_request_pool_t;
 
 /**
  * @struct ie_core_version
@@ -275,6 +276,27 @@ typedef struct ie_complete_call_back {
     void *args;
 }ie_complete_call_back_t;
 
+/**
+ * @struct ie_blob_binding
+ * @brief Describes the pre-allocated memory of an input or output to be set to an infer request
+ */
+typedef struct ie_blob_binding {
+    const char *name;           // Name of the input or output
+    tensor_desc_t tensor_desc;  // Tensor descriptor of the memory
+    void *ptr;                  // Pointer to the pre-allocated memory
+    size_t size;                // Length of the pre-allocated array in elements
+}ie_blob_binding_t;
+
+/**
+ * @struct ie_infer_completion
+ * @brief Represents an infer request of a pool which finished the inference
+ */
+typedef struct ie_infer_completion {
+    ie_infer_request_t *request;  // Finished infer request, it stays acquired until released to the pool
+    void *user_data;              // Value passed to ie_infer_request_pool_start_async
+    IEStatusCode status;          // Status of the inference
+}ie_infer_completion_t;
+
 /**
  * @brief Returns number of version that is exported.
  * @return Version number of the API.
@@ -530,6 +552,19 @@ INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_get_blob(ie_infer_request_
  */
 INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_set_blob(ie_infer_request_t *infer_request, const char *name, const ie_blob_t *blob);
 
+/**
+ * @brief Sets the pre-allocated memory of several inputs and outputs to inference in one call.
+ * The blobs are created and owned by the infer request, so no ie_blob_t instances are created and freed by the caller.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param bindings An array of descriptions of the pre-allocated memory. The memory must be valid until the inference
+ * is finished or other memory is set for the same input or output.
+ * @param bindings_num Number of elements in the bindings array.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_set_blobs_from_preallocated(ie_infer_request_t *infer_request, \
+        const ie_blob_binding_t *bindings, const size_t bindings_num);
+
 /**
  * @brief Starts synchronous inference of the infer request and fill outputs.
  * @ingroup InferRequest
@@ -551,7 +586,8 @@ INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_infer_async(ie_infer_reque
  * @ingroup InferRequest
  * @param infer_request A pointer to ie_infer_request_t instance.
  * @param callback  A function to be called.
- * @return Status code of the operation: OK(0) for success.
+ * @return Status code of the operation: OK(0) for success, GENERAL_ERROR for the requests of an
+ * ie_infer_request_pool_t, as their callback reports the completion to the pool.
  */
 INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_set_completion_callback(ie_infer_request_t *infer_request, ie_complete_call_back_t *callback);
 
@@ -576,8 +612,107 @@ INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_wait(ie_infer_request_t *i
  */
 INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_set_batch(ie_infer_request_t *infer_request, const size_t size);
 
+/**
+ * @brief Sets the priority of the infer request over the requests of the same and other executable networks.
+ * By default the request has the priority of its executable network (the CPU_PRIORITY key of the CPU plugin).
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param priority New priority, the requests with higher values are executed first.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_set_priority(ie_infer_request_t *infer_request, const int priority);
+
 /** @} */ // end of InferRequest
 
+// InferRequestPool
+
+/**
+ * @defgroup InferRequestPool InferRequestPool
+ * Set of functions managing a pool of infer requests of an ExecutableNetwork
+ * with a single queue of completed requests. The queue can be polled, waited on
+ * or, on Linux, watched by epoll/poll/select through an eventfd, so an event loop
+ * of a server does not need a thread or a callback per request.
+ * @{
+ */
+
+/**
+ * @brief Creates a pool of infer requests of the executable network.
+ * @ingroup InferRequestPool
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param size Number of infer requests in the pool. If it is 0, OPTIMAL_NUMBER_OF_INFER_REQUESTS metric of the network is used.
+ * @param pool A pointer to the newly created pool.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_pool_create(ie_executable_network_t *ie_exec_network, const size_t size, \
+        ie_infer_request_pool_t **pool);
+
+/**
+ * @brief Waits for the started inferences and releases memory occupied by the pool and all its infer requests.
+ * @ingroup InferRequestPool
+ * @param pool A pointer to the ie_infer_request_pool_t to free memory.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_pool_free(ie_infer_request_pool_t **pool);
+
+/**
+ * @brief Gets an idle infer request of the pool. The request is owned by the pool and must not be freed.
+ * It is started with ie_infer_request_pool_start_async only, ie_infer_set_completion_callback is rejected for it
+ * and its inferences started by ie_infer_request_infer_async are not put to the completion queue.
+ * @ingroup InferRequestPool
+ * @param pool A pointer to ie_infer_request_pool_t instance.
+ * @param timeout Maximum duration in milliseconds to block for an idle request: 0 does not block, -1 waits infinitely.
+ * @param request A pointer to the acquired infer request.
+ * @return Status code of the operation: OK(0) for success, REQUEST_BUSY if all the requests are still in use after timeout.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_pool_acquire(ie_infer_request_pool_t *pool, const int64_t timeout, \
+        ie_infer_request_t **request);
+
+/**
+ * @brief Starts asynchronous inference of the acquired infer request. When it is finished, the request
+ * is put to the completion queue of the pool together with user_data.
+ * @ingroup InferRequestPool
+ * @param pool A pointer to ie_infer_request_pool_t instance.
+ * @param request An infer request acquired from the pool.
+ * @param user_data A value returned with the completion, for example a pointer to the context of the client.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_pool_start_async(ie_infer_request_pool_t *pool, ie_infer_request_t *request, \
+        void *user_data);
+
+/**
+ * @brief Takes completed infer requests from the completion queue of the pool.
+ * @ingroup InferRequestPool
+ * @param pool A pointer to ie_infer_request_pool_t instance.
+ * @param completions An array to be filled with completions.
+ * @param capacity Number of elements in the completions array.
+ * @param timeout Maximum duration in milliseconds to block for the first completion: 0 does not block, -1 waits infinitely.
+ * @param completions_num Number of filled completions.
+ * @return Status code of the operation: OK(0) for success, RESULT_NOT_READY if the queue is still empty after timeout.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_pool_get_completions(ie_infer_request_pool_t *pool, \
+        ie_infer_completion_t *completions, const size_t capacity, const int64_t timeout, size_t *completions_num);
+
+/**
+ * @brief Returns the completed or not started infer request to the pool, so it can be acquired again.
+ * @ingroup InferRequestPool
+ * @param pool A pointer to ie_infer_request_pool_t instance.
+ * @param request An infer request acquired from the pool.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_pool_release(ie_infer_request_pool_t *pool, ie_infer_request_t *request);
+
+/**
+ * @brief Gets a file descriptor which is readable while the completion queue of the pool is not empty.
+ * The descriptor is owned by the pool and must not be read or closed by the caller.
+ * @ingroup InferRequestPool
+ * @param pool A pointer to ie_infer_request_pool_t instance.
+ * @param fd A pointer to the file descriptor.
+ * @return Status code of the operation: OK(0) for success, NOT_IMPLEMENTED on the systems without eventfd.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_infer_request_pool_get_event_fd(ie_infer_request_pool_t *pool, int *fd);
+
+/** @} */ // end of InferRequestPool
+
 // Network
 
 /**
@@ -878,6 +1013,14 @@ INFERENCE_ENGINE_C_API(IEStatusCode) ie_blob_byte_size(ie_blob_t *blob, int *bsi
  */
 INFERENCE_ENGINE_C_API(IEStatusCode) ie_blob_deallocate(ie_blob_t **blob);
 
+/**
+ * @brief Releases the blob instance without deallocating its memory, for example a blob got from an infer request.
+ * @ingroup Blob
+ * @param blob A pointer to the blob to free.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IEStatusCode) ie_blob_free(ie_blob_t **blob);
+
 /**
  * @brief Gets access to the allocated memory .
  * @ingroup Blob
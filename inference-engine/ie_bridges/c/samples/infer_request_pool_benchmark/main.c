@@ -0,0 +1,308 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier : Apache-2.0
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifdef __linux__
+#include <poll.h>
+#endif
+#include <c_api/ie_c_api.h>
+
+/* Description of an input or output of the network */
+typedef struct {
+    char *name;
+    tensor_desc_t desc;
+    size_t size;
+    size_t byte_size;
+    int is_input;
+} port_info_t;
+
+/* Memory of one request of a client, like a server keeps it for every connection */
+typedef struct {
+    void **buffers;
+    ie_blob_binding_t *bindings;
+} client_context_t;
+
+/* Host time spent in the API calls and copies, blocking waits for the results are not included */
+typedef struct {
+    double total_ms;
+    double overhead_ms;
+    size_t completed;
+} run_result_t;
+
+static double now_ms(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static int get_ports(ie_network_t *network, ie_infer_request_t *request, port_info_t **ports, size_t *ports_num) {
+    size_t inputs_num = 0, outputs_num = 0, i;
+    if (ie_network_get_inputs_number(network, &inputs_num) != OK ||
+        ie_network_get_outputs_number(network, &outputs_num) != OK) {
+        return -1;
+    }
+
+    *ports_num = inputs_num + outputs_num;
+    *ports = (port_info_t *)calloc(*ports_num, sizeof(port_info_t));
+    for (i = 0; i < *ports_num; ++i) {
+        port_info_t *port = &(*ports)[i];
+        port->is_input = i < inputs_num;
+        IEStatusCode status = port->is_input ? ie_network_get_input_name(network, i, &port->name) :
+                                               ie_network_get_output_name(network, i - inputs_num, &port->name);
+        if (status != OK) {
+            return -1;
+        }
+
+        ie_blob_t *blob = NULL;
+        int size = 0, byte_size = 0;
+        if (ie_infer_request_get_blob(request, port->name, &blob) != OK) {
+            return -1;
+        }
+        ie_blob_get_dims(blob, &port->desc.dims);
+        ie_blob_get_layout(blob, &port->desc.layout);
+        ie_blob_get_precision(blob, &port->desc.precision);
+        ie_blob_size(blob, &size);
+        ie_blob_byte_size(blob, &byte_size);
+        ie_blob_free(&blob);
+        port->size = (size_t)size;
+        port->byte_size = (size_t)byte_size;
+    }
+    return 0;
+}
+
+static client_context_t *create_clients(const port_info_t *ports, size_t ports_num, size_t clients_num) {
+    client_context_t *clients = (client_context_t *)calloc(clients_num, sizeof(client_context_t));
+    size_t i, j;
+    for (i = 0; i < clients_num; ++i) {
+        clients[i].buffers = (void **)calloc(ports_num, sizeof(void *));
+        clients[i].bindings = (ie_blob_binding_t *)calloc(ports_num, sizeof(ie_blob_binding_t));
+        for (j = 0; j < ports_num; ++j) {
+            /* Zeroed inputs do not contain denormals or NaNs which distort timings */
+            clients[i].buffers[j] = calloc(1, ports[j].byte_size);
+            clients[i].bindings[j].name = ports[j].name;
+            clients[i].bindings[j].tensor_desc = ports[j].desc;
+            clients[i].bindings[j].ptr = clients[i].buffers[j];
+            clients[i].bindings[j].size = ports[j].size;
+        }
+    }
+    return clients;
+}
+
+static void free_clients(client_context_t *clients, size_t ports_num, size_t clients_num) {
+    size_t i, j;
+    for (i = 0; i < clients_num; ++i) {
+        for (j = 0; j < ports_num; ++j) {
+            free(clients[i].buffers[j]);
+        }
+        free(clients[i].buffers);
+        free(clients[i].bindings);
+    }
+    free(clients);
+}
+
+static void copy_port(ie_infer_request_t *request, const port_info_t *port, void *buffer) {
+    ie_blob_t *blob = NULL;
+    ie_blob_buffer_t blob_buffer;
+    ie_infer_request_get_blob(request, port->name, &blob);
+    ie_blob_get_buffer(blob, &blob_buffer);
+    if (port->is_input) {
+        memcpy(blob_buffer.buffer, buffer, port->byte_size);
+    } else {
+        memcpy(buffer, blob_buffer.buffer, port->byte_size);
+    }
+    ie_blob_free(&blob);
+}
+
+/* Classic usage of the API: per request handles of blobs are got, the data is copied in and out
+   and every request is waited for separately */
+static run_result_t run_copy(ie_executable_network_t *exe_network, const port_info_t *ports, size_t ports_num,
+                             client_context_t *clients, size_t requests_num, size_t pool_size) {
+    run_result_t result = {0, 0, 0};
+    ie_infer_request_t **requests = (ie_infer_request_t **)calloc(pool_size, sizeof(ie_infer_request_t *));
+    client_context_t **owners = (client_context_t **)calloc(pool_size, sizeof(client_context_t *));
+    size_t i, j, iteration;
+    for (i = 0; i < pool_size; ++i) {
+        ie_exec_network_create_infer_request(exe_network, &requests[i]);
+    }
+
+    double start = now_ms();
+    for (iteration = 0; result.completed < requests_num; ++iteration) {
+        size_t slot = iteration % pool_size;
+        if (owners[slot] != NULL) {
+            ie_infer_request_wait(requests[slot], -1);
+            double begin = now_ms();
+            for (j = 0; j < ports_num; ++j) {
+                if (!ports[j].is_input) {
+                    copy_port(requests[slot], &ports[j], owners[slot]->buffers[j]);
+                }
+            }
+            owners[slot] = NULL;
+            result.completed++;
+            result.overhead_ms += now_ms() - begin;
+        }
+        if (iteration < requests_num) {
+            double begin = now_ms();
+            client_context_t *client = &clients[iteration % (2 * pool_size)];
+            for (j = 0; j < ports_num; ++j) {
+                if (ports[j].is_input) {
+                    copy_port(requests[slot], &ports[j], client->buffers[j]);
+                }
+            }
+            ie_infer_request_infer_async(requests[slot]);
+            owners[slot] = client;
+            result.overhead_ms += now_ms() - begin;
+        }
+    }
+    result.total_ms = now_ms() - start;
+
+    for (i = 0; i < pool_size; ++i) {
+        ie_infer_request_free(&requests[i]);
+    }
+    free(requests);
+    free(owners);
+    return result;
+}
+
+/* The memory of the clients is bound to the requests of the pool without copies
+   and the completions of all the requests are taken from one queue */
+static run_result_t run_pool(ie_infer_request_pool_t *pool, size_t ports_num, client_context_t *clients,
+                             size_t requests_num, size_t pool_size, int use_event_fd) {
+    run_result_t result = {0, 0, 0};
+    ie_infer_completion_t *completions = (ie_infer_completion_t *)calloc(pool_size, sizeof(ie_infer_completion_t));
+    size_t i, started = 0;
+    int fd = -1;
+    if (use_event_fd && ie_infer_request_pool_get_event_fd(pool, &fd) != OK) {
+        free(completions);
+        return result;
+    }
+
+    double start = now_ms();
+    while (result.completed < requests_num) {
+        ie_infer_request_t *request = NULL;
+        double begin = now_ms();
+        if (started < requests_num && ie_infer_request_pool_acquire(pool, 0, &request) == OK) {
+            client_context_t *client = &clients[started % (2 * pool_size)];
+            ie_infer_request_set_blobs_from_preallocated(request, client->bindings, ports_num);
+            ie_infer_request_pool_start_async(pool, request, client);
+            started++;
+            result.overhead_ms += now_ms() - begin;
+            continue;
+        }
+
+        size_t completions_num = 0;
+#ifdef __linux__
+        if (fd >= 0) {
+            /* An event loop of a server waits for the descriptor together with its sockets */
+            struct pollfd poll_fd = {fd, POLLIN, 0};
+            poll(&poll_fd, 1, -1);
+        }
+#endif
+        ie_infer_request_pool_get_completions(pool, completions, pool_size, fd >= 0 ? 0 : -1, &completions_num);
+        begin = now_ms();
+        for (i = 0; i < completions_num; ++i) {
+            ie_infer_request_pool_release(pool, completions[i].request);
+        }
+        result.completed += completions_num;
+        result.overhead_ms += now_ms() - begin;
+    }
+    result.total_ms = now_ms() - start;
+
+    free(completions);
+    return result;
+}
+
+static void print_result(const char *mode, run_result_t result) {
+    if (result.completed == 0) {
+        printf("%-8s not supported\n", mode);
+        return;
+    }
+    printf("%-8s %12.2f %16.2f %20.3f\n", mode, result.total_ms, result.completed * 1000.0 / result.total_ms,
+           result.overhead_ms * 1000.0 / result.completed);
+}
+
+int main(int argc, char **argv) {
+    // ------------------------------ Parsing and validation of input args ---------------------------------
+    if (argc != 4 && argc != 5) {
+        printf("Usage : ./infer_request_pool_benchmark_c <path_to_model> <device_name> <requests_num> [<pool_size>]\n");
+        return EXIT_FAILURE;
+    }
+
+    const char *input_model = argv[1];
+    const char *device_name = argv[2];
+    size_t requests_num = (size_t)strtoul(argv[3], NULL, 10);
+    size_t pool_size = argc == 5 ? (size_t)strtoul(argv[4], NULL, 10) : 0;
+    if (requests_num == 0) {
+        printf("Number of requests should be positive\n");
+        return EXIT_FAILURE;
+    }
+    // -----------------------------------------------------------------------------------------------------
+
+    // --------------------------- 1. Load the network and create the pool ---------------------------------
+    ie_core_t *core = NULL;
+    ie_network_t *network = NULL;
+    ie_executable_network_t *exe_network = NULL;
+    ie_infer_request_pool_t *pool = NULL;
+    ie_config_t config = {NULL, NULL, NULL};
+    if (ie_core_create("", &core) != OK ||
+        ie_core_read_network(core, input_model, NULL, &network) != OK ||
+        ie_core_load_network(core, network, device_name, &config, &exe_network) != OK) {
+        printf("Cannot load the network %s to the device %s\n", input_model, device_name);
+        return EXIT_FAILURE;
+    }
+
+    if (pool_size == 0) {
+        ie_param_t param;
+        if (ie_exec_network_get_metric(exe_network, "OPTIMAL_NUMBER_OF_INFER_REQUESTS", &param) != OK) {
+            printf("Cannot get the optimal number of infer requests\n");
+            return EXIT_FAILURE;
+        }
+        pool_size = param.number;
+    }
+
+    if (ie_infer_request_pool_create(exe_network, pool_size, &pool) != OK) {
+        printf("Cannot create the pool of %zu infer requests\n", pool_size);
+        return EXIT_FAILURE;
+    }
+
+    /* Requests allocate the memory of the tensor descriptors the network is compiled for */
+    ie_infer_request_t *request = NULL;
+    port_info_t *ports = NULL;
+    size_t ports_num = 0, i;
+    ie_exec_network_create_infer_request(exe_network, &request);
+    if (get_ports(network, request, &ports, &ports_num) != 0) {
+        printf("Cannot get the inputs and outputs of the network\n");
+        return EXIT_FAILURE;
+    }
+    ie_infer_request_free(&request);
+    // -----------------------------------------------------------------------------------------------------
+
+    // --------------------------- 2. Run the same load with every mode -------------------------------------
+    /* Twice more clients than requests, so the memory bound to a request changes every time */
+    client_context_t *clients = create_clients(ports, ports_num, 2 * pool_size);
+
+    /* The first run warms up the plugin and the memory of the clients */
+    run_copy(exe_network, ports, ports_num, clients, pool_size, pool_size);
+
+    printf("Requests: %zu, requests in flight: %zu\n\n", requests_num, pool_size);
+    printf("%-8s %12s %16s %20s\n", "Mode", "Total, ms", "Throughput, FPS", "Overhead, us/request");
+    print_result("copy", run_copy(exe_network, ports, ports_num, clients, requests_num, pool_size));
+    print_result("pool", run_pool(pool, ports_num, clients, requests_num, pool_size, 0));
+    print_result("eventfd", run_pool(pool, ports_num, clients, requests_num, pool_size, 1));
+    // -----------------------------------------------------------------------------------------------------
+
+    free_clients(clients, ports_num, 2 * pool_size);
+    for (i = 0; i < ports_num; ++i) {
+        ie_network_name_free(&ports[i].name);
+    }
+    free(ports);
+    ie_infer_request_pool_free(&pool);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+
+    return EXIT_SUCCESS;
+}
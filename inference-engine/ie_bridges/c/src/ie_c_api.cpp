@@ -14,6 +14,15 @@
 #include <chrono>
 #include <tuple>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "details/ie_exception.hpp"
@@ -43,6 +52,7 @@ struct ie_executable {
  */
 struct ie_infer_request {
     IE::InferRequest object;
+    bool pooled = false;
 };
 
 /**
@@ -61,6 +71,33 @@ struct ie_network {
     IE::CNNNetwork object;
 };
 
+/**
+ * @struct ie_infer_request_slot
+ * @brief This struct represents an infer request of a pool and its state
+ */
+struct ie_infer_request_slot {
+    std::unique_ptr<ie_infer_request_t> request;
+    void *user_data = nullptr;
+    bool acquired = false;
+    bool running = false;
+};
+
+/**
+ * @struct ie_infer_request_pool
+ * @brief This struct represents infer requests of an executable network with a single queue of completions
+ */
+struct ie_infer_request_pool {
+    std::vector<ie_infer_request_slot> slots;
+    std::unordered_map<const ie_infer_request_t *, size_t> indices;
+    std::mutex mutex;
+    std::condition_variable idle_cond;
+    std::condition_variable completion_cond;
+    std::vector<size_t> idle;
+    std::deque<ie_infer_completion_t> completions;
+    size_t running = 0;
+    int event_fd = -1;
+};
+
 std::map<IE::StatusCode, IEStatusCode> status_map = {{IE::StatusCode::GENERAL_ERROR, IEStatusCode::GENERAL_ERROR},
                                                         {IE::StatusCode::INFER_NOT_STARTED, IEStatusCode::INFER_NOT_STARTED},
                                                         {IE::StatusCode::NETWORK_NOT_LOADED,  IEStatusCode::NETWORK_NOT_LOADED},
@@ -179,6 +216,88 @@ void parameter2IEparam(const IE::Parameter param, ie_param_t *ie_param) {
     }
 }
 
+/**
+ *@brief create the blob of the corresponding type from the pre-allocated memory.
+ */
+IE::Blob::Ptr make_blob_from_preallocated(const tensor_desc_t *tensorDesc, void *ptr, size_t size) {
+    IE::Precision prec;
+    for (const auto &it : precision_map) {
+        if (it.second == tensorDesc->precision) {
+            prec = it.first;
+            break;
+        }
+    }
+
+    IE::Layout l = IE::Layout::NCHW;
+    for (const auto &it : layout_map) {
+        if (it.second == tensorDesc->layout) {
+            l = it.first;
+            break;
+        }
+    }
+
+    IE::SizeVector dims_vector;
+    for (size_t i = 0; i < tensorDesc->dims.ranks; ++i) {
+        dims_vector.push_back(tensorDesc->dims.dims[i]);
+    }
+
+    IE::TensorDesc tensor(prec, dims_vector, l);
+    if (prec == IE::Precision::U8) {
+        return IE::make_shared_blob(tensor, reinterpret_cast<uint8_t *>(ptr), size);
+    } else if (prec == IE::Precision::U16) {
+        return IE::make_shared_blob(tensor, reinterpret_cast<uint16_t *>(ptr), size);
+    } else if (prec == IE::Precision::I8 || prec == IE::Precision::BIN) {
+        return IE::make_shared_blob(tensor, reinterpret_cast<int8_t *>(ptr), size);
+    } else if (prec == IE::Precision::I16 || prec == IE::Precision::FP16 || prec == IE::Precision::Q78) {
+        return IE::make_shared_blob(tensor, reinterpret_cast<int16_t *>(ptr), size);
+    } else if (prec == IE::Precision::I32) {
+        return IE::make_shared_blob(tensor, reinterpret_cast<int32_t *>(ptr), size);
+    } else if (prec == IE::Precision::I64) {
+        return IE::make_shared_blob(tensor, reinterpret_cast<int64_t *>(ptr), size);
+    } else if (prec == IE::Precision::FP32) {
+        return IE::make_shared_blob(tensor, reinterpret_cast<float *>(ptr), size);
+    } else {
+        return IE::make_shared_blob(tensor, reinterpret_cast<uint8_t *>(ptr), size);
+    }
+}
+
+/**
+ *@brief wait for the predicate with the timeout in milliseconds, negative timeout waits infinitely.
+ */
+template <typename Predicate>
+bool wait_for(std::condition_variable &cond, std::unique_lock<std::mutex> &lock, int64_t timeout, Predicate predicate) {
+    if (timeout < 0) {
+        cond.wait(lock, predicate);
+        return true;
+    }
+    return cond.wait_for(lock, std::chrono::milliseconds(timeout), predicate);
+}
+
+/**
+ *@brief put the finished infer request of the pool to the completion queue.
+ */
+void infer_request_pool_complete(ie_infer_request_pool_t *pool, size_t index, IE::StatusCode status_code) {
+    auto status = status_map.find(status_code);
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    auto &slot = pool->slots[index];
+    // Inference started bypassing the pool is not its completion
+    if (!slot.running) {
+        return;
+    }
+    slot.running = false;
+    pool->running--;
+    pool->completions.push_back({slot.request.get(), slot.user_data,
+                                 status != status_map.end() ? status->second : IEStatusCode::UNEXPECTED});
+#ifdef __linux__
+    if (pool->event_fd >= 0) {
+        uint64_t value = 1;
+        ssize_t written = write(pool->event_fd, &value, sizeof(value));
+        (void)written;
+    }
+#endif
+    pool->completion_cond.notify_all();
+}
+
 const char *ie_c_api_version(void) {
     auto version = IE::GetInferenceEngineVersion();
     std::string version_str = std::to_string(version->apiVersion.major) + ".";
@@ -1192,6 +1311,36 @@ IEStatusCode ie_infer_request_set_blob(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_infer_request_set_blobs_from_preallocated(ie_infer_request_t *infer_request, const ie_blob_binding_t *bindings, \
+        const size_t bindings_num) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || (bindings == nullptr && bindings_num > 0)) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    for (size_t i = 0; i < bindings_num; ++i) {
+        if (bindings[i].name == nullptr || bindings[i].ptr == nullptr) {
+            status = IEStatusCode::GENERAL_ERROR;
+            return status;
+        }
+    }
+
+    try {
+        for (size_t i = 0; i < bindings_num; ++i) {
+            const ie_blob_binding_t &binding = bindings[i];
+            infer_request->object.SetBlob(binding.name, make_blob_from_preallocated(&binding.tensor_desc, binding.ptr, binding.size));
+        }
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (const std::exception& e) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
 IEStatusCode ie_infer_request_infer(ie_infer_request_t *infer_request) {
     IEStatusCode status = IEStatusCode::OK;
 
@@ -1233,7 +1382,8 @@ IEStatusCode ie_infer_request_infer_async(ie_infer_request_t *infer_request) {
 IEStatusCode ie_infer_set_completion_callback(ie_infer_request_t *infer_request, ie_complete_call_back_t *callback) {
     IEStatusCode status = IEStatusCode::OK;
 
-    if (infer_request == nullptr || callback == nullptr) {
+    // The completion callback of a pooled request puts it to the completion queue of the pool
+    if (infer_request == nullptr || callback == nullptr || infer_request->pooled) {
         status = IEStatusCode::GENERAL_ERROR;
         return status;
     }
@@ -1291,6 +1441,238 @@ IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_infer_request_set_priority(ie_infer_request_t *infer_request, const int priority) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        infer_request->object.SetPriority(priority);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (const std::exception& e) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_infer_request_pool_create(ie_executable_network_t *ie_exec_network, const size_t size, ie_infer_request_pool_t **pool) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (ie_exec_network == nullptr || pool == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        size_t requests_num = size;
+        if (requests_num == 0) {
+            requests_num = ie_exec_network->object.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        }
+
+        std::unique_ptr<ie_infer_request_pool_t> pool_result(new ie_infer_request_pool_t);
+        ie_infer_request_pool_t *pool_ptr = pool_result.get();
+        pool_ptr->slots.resize(requests_num);
+        for (size_t i = 0; i < requests_num; ++i) {
+            auto &slot = pool_ptr->slots[i];
+            slot.request.reset(new ie_infer_request_t);
+            slot.request->object = ie_exec_network->object.CreateInferRequest();
+            std::function<void(IE::InferRequest, IE::StatusCode)> callback = [pool_ptr, i](IE::InferRequest, IE::StatusCode status_code) {
+                infer_request_pool_complete(pool_ptr, i, status_code);
+            };
+            slot.request->object.SetCompletionCallback(callback);
+            slot.request->pooled = true;
+            pool_ptr->indices[slot.request.get()] = i;
+            pool_ptr->idle.push_back(requests_num - 1 - i);
+        }
+        *pool = pool_result.release();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (const std::exception& e) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
+IEStatusCode ie_infer_request_pool_free(ie_infer_request_pool_t **pool) {
+    if (pool && *pool) {
+        {
+            std::unique_lock<std::mutex> lock((*pool)->mutex);
+            (*pool)->completion_cond.wait(lock, [pool] { return (*pool)->running == 0; });
+        }
+#ifdef __linux__
+        if ((*pool)->event_fd >= 0) {
+            close((*pool)->event_fd);
+        }
+#endif
+        delete *pool;
+        *pool = NULL;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_request_pool_acquire(ie_infer_request_pool_t *pool, const int64_t timeout, ie_infer_request_t **request) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (pool == nullptr || request == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    if (!wait_for(pool->idle_cond, lock, timeout, [pool] { return !pool->idle.empty(); })) {
+        return IEStatusCode::REQUEST_BUSY;
+    }
+    // The most recently released request is reused first as its memory is more likely to be in the cache
+    auto &slot = pool->slots[pool->idle.back()];
+    pool->idle.pop_back();
+    slot.acquired = true;
+    slot.user_data = nullptr;
+    *request = slot.request.get();
+
+    return status;
+}
+
+IEStatusCode ie_infer_request_pool_start_async(ie_infer_request_pool_t *pool, ie_infer_request_t *request, void *user_data) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (pool == nullptr || request == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    size_t index = 0;
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        auto found = pool->indices.find(request);
+        if (found == pool->indices.end() || !pool->slots[found->second].acquired) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
+        index = found->second;
+        auto &slot = pool->slots[index];
+        if (slot.running) {
+            return IEStatusCode::REQUEST_BUSY;
+        }
+        slot.user_data = user_data;
+        slot.running = true;
+        pool->running++;
+    }
+
+    try {
+        request->object.StartAsync();
+    } catch (const IE::details::InferenceEngineException& e) {
+        status = e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (const std::exception& e) {
+        status = IEStatusCode::UNEXPECTED;
+    }
+
+    if (status != IEStatusCode::OK) {
+        // The completion callback is not called if the inference was not started. The slot may be already
+        // completed by the inference started bypassing the pool, which made this start fail.
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        auto &slot = pool->slots[index];
+        if (slot.running) {
+            slot.running = false;
+            pool->running--;
+        }
+        pool->completion_cond.notify_all();
+    }
+
+    return status;
+}
+
+IEStatusCode ie_infer_request_pool_get_completions(ie_infer_request_pool_t *pool, ie_infer_completion_t *completions, const size_t capacity, \
+        const int64_t timeout, size_t *completions_num) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (pool == nullptr || completions == nullptr || capacity == 0 || completions_num == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    *completions_num = 0;
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    if (!wait_for(pool->completion_cond, lock, timeout, [pool] { return !pool->completions.empty(); })) {
+        return IEStatusCode::RESULT_NOT_READY;
+    }
+    while (*completions_num < capacity && !pool->completions.empty()) {
+        completions[(*completions_num)++] = pool->completions.front();
+        pool->completions.pop_front();
+    }
+#ifdef __linux__
+    // The counter of the eventfd is reset only when the queue is empty, so the descriptor stays readable otherwise
+    if (pool->event_fd >= 0 && pool->completions.empty()) {
+        uint64_t value = 0;
+        ssize_t read_size = read(pool->event_fd, &value, sizeof(value));
+        (void)read_size;
+    }
+#endif
+
+    return status;
+}
+
+IEStatusCode ie_infer_request_pool_release(ie_infer_request_pool_t *pool, ie_infer_request_t *request) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (pool == nullptr || request == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        auto found = pool->indices.find(request);
+        if (found == pool->indices.end() || !pool->slots[found->second].acquired) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
+        auto &slot = pool->slots[found->second];
+        if (slot.running) {
+            return IEStatusCode::REQUEST_BUSY;
+        }
+        slot.acquired = false;
+        pool->idle.push_back(found->second);
+    }
+    pool->idle_cond.notify_one();
+
+    return status;
+}
+
+IEStatusCode ie_infer_request_pool_get_event_fd(ie_infer_request_pool_t *pool, int *fd) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (pool == nullptr || fd == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+#ifdef __linux__
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    // The descriptor is created on demand, so the pools which are only polled do not make system calls per completion
+    if (pool->event_fd < 0) {
+        pool->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (pool->event_fd < 0) {
+            return IEStatusCode::GENERAL_ERROR;
+        }
+        if (!pool->completions.empty()) {
+            uint64_t value = 1;
+            ssize_t written = write(pool->event_fd, &value, sizeof(value));
+            (void)written;
+        }
+    }
+    *fd = pool->event_fd;
+#else
+    status = IEStatusCode::NOT_IMPLEMENTED;
+#endif
+
+    return status;
+}
+
 IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
     if (tensorDesc == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
@@ -1356,56 +1738,10 @@ IEStatusCode ie_blob_make_memory_from_preallocated(const tensor_desc_t *tensorDe
         return IEStatusCode::GENERAL_ERROR;
     }
 
-    IE::Precision prec;
-    for (auto it : precision_map) {
-        if (it.second == tensorDesc->precision) {
-            prec = it.first;
-            break;
-        }
-    }
-
-    IE::Layout l = IE::Layout::NCHW;
-    for (auto it : layout_map) {
-        if (it.second == tensorDesc->layout) {
-            l = it.first;
-            break;
-        }
-    }
-
-    IE::SizeVector dims_vector;
-    for (size_t i = 0; i < tensorDesc->dims.ranks; ++i) {
-        dims_vector.push_back(tensorDesc->dims.dims[i]);
-    }
-
     IEStatusCode status = IEStatusCode::OK;
     try {
-        IE::TensorDesc tensor(prec, dims_vector, l);
         std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
-        if (prec == IE::Precision::U8) {
-            uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::U16) {
-            uint16_t *p = reinterpret_cast<uint16_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I8 || prec == IE::Precision::BIN) {
-            int8_t *p = reinterpret_cast<int8_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I16 || prec == IE::Precision::FP16 || prec == IE::Precision::Q78) {
-            int16_t *p = reinterpret_cast<int16_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I32) {
-            int32_t *p = reinterpret_cast<int32_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I64) {
-            int64_t *p = reinterpret_cast<int64_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if  (prec == IE::Precision::FP32) {
-            float *p = reinterpret_cast<float *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else {
-            uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        }
+        _blob->object = make_blob_from_preallocated(tensorDesc, ptr, size);
         *blob = _blob.release();
     } catch (const IE::details::InferenceEngineException& e) {
         return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
@@ -1474,6 +1810,15 @@ IEStatusCode ie_blob_deallocate(ie_blob_t **blob) {
     return status;
 }
 
+IEStatusCode ie_blob_free(ie_blob_t **blob) {
+    if (blob) {
+        delete *blob;
+        *blob = NULL;
+    }
+
+    return IEStatusCode::OK;
+}
+
 IEStatusCode ie_blob_get_buffer(const ie_blob_t *blob, ie_blob_buffer_t *blob_buffer) {
     if (blob == nullptr || blob_buffer == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
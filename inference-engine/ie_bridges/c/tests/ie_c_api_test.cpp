@@ -0,0 +1,364 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <c_api/ie_c_api.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <poll.h>
+#endif
+
+namespace {
+
+// Network doubling its input: out = 2 * data
+const char *doubleModel = R"V0G0N(<?xml version="1.0" ?>
+<net name="double" version="7" batch="1">
+    <layers>
+        <layer id="0" name="data" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="out" precision="FP32" type="Power">
+            <data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+const size_t inputSize = 1 * 3 * 4 * 4;
+
+}  // namespace
+
+class IECApiTests : public ::testing::Test {
+protected:
+    std::string xml = "ie_c_api_test_double.xml";
+    std::string bin = "ie_c_api_test_double.bin";
+    ie_core_t *core = nullptr;
+    ie_network_t *network = nullptr;
+
+    void SetUp() override {
+        std::ofstream(xml) << doubleModel;
+        // the network has no weights, the file is not empty to be readable
+        std::ofstream(bin, std::ios::binary).write("\0\0\0\0", 4);
+        ASSERT_EQ(IEStatusCode::OK, ie_core_create("", &core));
+        ASSERT_EQ(IEStatusCode::OK, ie_core_read_network(core, xml.c_str(), bin.c_str(), &network));
+    }
+
+    void TearDown() override {
+        if (network != nullptr)
+            ie_network_free(&network);
+        if (core != nullptr)
+            ie_core_free(&core);
+        std::remove(xml.c_str());
+        std::remove(bin.c_str());
+    }
+};
+
+TEST(IECApiPriorityTests, setPriorityOfNullRequestFails) {
+    ASSERT_EQ(IEStatusCode::GENERAL_ERROR, ie_infer_request_set_priority(nullptr, 1));
+}
+
+TEST_F(IECApiTests, requestWithPriorityIsInferred) {
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    ASSERT_EQ(IEStatusCode::OK, ie_core_load_network(core, network, "CPU", &config, &exe_network));
+    ie_infer_request_t *infer_request = nullptr;
+    ASSERT_EQ(IEStatusCode::OK, ie_exec_network_create_infer_request(exe_network, &infer_request));
+
+    ie_blob_t *input = nullptr;
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_get_blob(infer_request, "data", &input));
+    ie_blob_buffer_t input_buffer;
+    ASSERT_EQ(IEStatusCode::OK, ie_blob_get_buffer(input, &input_buffer));
+    auto src = static_cast<float *>(input_buffer.buffer);
+    for (size_t i = 0; i < inputSize; i++)
+        src[i] = static_cast<float>(i);
+
+    EXPECT_EQ(IEStatusCode::OK, ie_infer_request_set_priority(infer_request, 5));
+    EXPECT_EQ(IEStatusCode::OK, ie_infer_request_infer(infer_request));
+
+    ie_blob_t *output = nullptr;
+    EXPECT_EQ(IEStatusCode::OK, ie_infer_request_get_blob(infer_request, "out", &output));
+    if (output != nullptr) {
+        ie_blob_buffer_t output_buffer;
+        EXPECT_EQ(IEStatusCode::OK, ie_blob_get_cbuffer(output, &output_buffer));
+        auto dst = static_cast<const float *>(output_buffer.cbuffer);
+        for (size_t i = 0; i < inputSize; i++)
+            EXPECT_FLOAT_EQ(2.f * i, dst[i]) << "at " << i;
+        ie_blob_free(&output);
+    }
+
+    ie_blob_free(&input);
+    ie_infer_request_free(&infer_request);
+    ie_exec_network_free(&exe_network);
+}
+
+TEST_F(IECApiTests, wrongPriorityIsRejectedOnLoad) {
+    ie_config_t config = {"CPU_PRIORITY", "abc", nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    ASSERT_NE(IEStatusCode::OK, ie_core_load_network(core, network, "CPU", &config, &exe_network));
+    ASSERT_EQ(nullptr, exe_network);
+}
+
+class IECApiPoolTests : public IECApiTests {
+protected:
+    ie_executable_network_t *exe_network = nullptr;
+    ie_infer_request_pool_t *pool = nullptr;
+
+    void SetUp() override {
+        IECApiTests::SetUp();
+        ie_config_t config = {nullptr, nullptr, nullptr};
+        ASSERT_EQ(IEStatusCode::OK, ie_core_load_network(core, network, "CPU", &config, &exe_network));
+        ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_create(exe_network, 3, &pool));
+    }
+
+    void TearDown() override {
+        if (pool != nullptr)
+            ie_infer_request_pool_free(&pool);
+        if (exe_network != nullptr)
+            ie_exec_network_free(&exe_network);
+        IECApiTests::TearDown();
+    }
+
+    static void fillInput(ie_infer_request_t *request, float value) {
+        ie_blob_t *input = nullptr;
+        ASSERT_EQ(IEStatusCode::OK, ie_infer_request_get_blob(request, "data", &input));
+        ie_blob_buffer_t buffer;
+        ASSERT_EQ(IEStatusCode::OK, ie_blob_get_buffer(input, &buffer));
+        auto src = static_cast<float *>(buffer.buffer);
+        for (size_t i = 0; i < inputSize; i++)
+            src[i] = value;
+        ie_blob_free(&input);
+    }
+
+    static void checkOutput(ie_infer_request_t *request, float value) {
+        ie_blob_t *output = nullptr;
+        ASSERT_EQ(IEStatusCode::OK, ie_infer_request_get_blob(request, "out", &output));
+        ie_blob_buffer_t buffer;
+        ASSERT_EQ(IEStatusCode::OK, ie_blob_get_cbuffer(output, &buffer));
+        auto dst = static_cast<const float *>(buffer.cbuffer);
+        for (size_t i = 0; i < inputSize; i++)
+            EXPECT_FLOAT_EQ(2.f * value, dst[i]) << "at " << i;
+        ie_blob_free(&output);
+    }
+
+    // Takes the completions until the given number of them is received
+    std::vector<ie_infer_completion_t> getCompletions(size_t number, size_t capacity) {
+        std::vector<ie_infer_completion_t> result;
+        std::vector<ie_infer_completion_t> batch(capacity);
+        while (result.size() < number) {
+            size_t completions_num = 0;
+            EXPECT_EQ(IEStatusCode::OK, ie_infer_request_pool_get_completions(pool, batch.data(), capacity, -1, &completions_num));
+            EXPECT_LE(1, completions_num);
+            EXPECT_GE(capacity, completions_num);
+            result.insert(result.end(), batch.begin(), batch.begin() + completions_num);
+        }
+        return result;
+    }
+};
+
+TEST_F(IECApiPoolTests, acquireReturnsRequestBusyAfterTimeout) {
+    ie_infer_request_t *requests[3] = {};
+    for (auto &request : requests)
+        ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_acquire(pool, 0, &request));
+
+    ie_infer_request_t *extra = nullptr;
+    ASSERT_EQ(IEStatusCode::REQUEST_BUSY, ie_infer_request_pool_acquire(pool, 0, &extra));
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(IEStatusCode::REQUEST_BUSY, ie_infer_request_pool_acquire(pool, 20, &extra));
+    ASSERT_LE(20, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+
+    // A request released by another thread wakes up the waiting one
+    std::thread releaser([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ie_infer_request_pool_release(pool, requests[1]);
+    });
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_acquire(pool, -1, &extra));
+    releaser.join();
+    ASSERT_EQ(requests[1], extra);
+
+    for (auto &request : requests)
+        ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_release(pool, request));
+    // Only acquired requests can be released
+    ASSERT_EQ(IEStatusCode::GENERAL_ERROR, ie_infer_request_pool_release(pool, requests[0]));
+}
+
+TEST_F(IECApiPoolTests, getCompletionsReturnsResultNotReadyOnEmptyQueue) {
+    ie_infer_completion_t completion;
+    size_t completions_num = 1;
+    ASSERT_EQ(IEStatusCode::RESULT_NOT_READY, ie_infer_request_pool_get_completions(pool, &completion, 1, 0, &completions_num));
+    ASSERT_EQ(0, completions_num);
+    ASSERT_EQ(IEStatusCode::RESULT_NOT_READY, ie_infer_request_pool_get_completions(pool, &completion, 1, 20, &completions_num));
+    ASSERT_EQ(0, completions_num);
+    ASSERT_EQ(IEStatusCode::GENERAL_ERROR, ie_infer_request_pool_get_completions(pool, &completion, 0, 0, &completions_num));
+}
+
+TEST_F(IECApiPoolTests, completionsAreReturnedInBatches) {
+    int ids[3] = {0, 1, 2};
+    for (auto &id : ids) {
+        ie_infer_request_t *request = nullptr;
+        ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_acquire(pool, 0, &request));
+        fillInput(request, static_cast<float>(id));
+        ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_start_async(pool, request, &id));
+    }
+
+    std::set<int> finished;
+    for (auto &completion : getCompletions(3, 2)) {
+        ASSERT_EQ(IEStatusCode::OK, completion.status);
+        int id = *static_cast<int *>(completion.user_data);
+        ASSERT_TRUE(finished.insert(id).second);
+        checkOutput(completion.request, static_cast<float>(id));
+        ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_release(pool, completion.request));
+    }
+    ASSERT_EQ(3, finished.size());
+}
+
+TEST_F(IECApiPoolTests, runningRequestIsNotReleased) {
+    ie_infer_request_t *request = nullptr;
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_acquire(pool, 0, &request));
+    fillInput(request, 1.f);
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_start_async(pool, request, nullptr));
+
+    // The inference may already be finished, then the request is released right away
+    IEStatusCode status = ie_infer_request_pool_release(pool, request);
+    ASSERT_TRUE(status == IEStatusCode::OK || status == IEStatusCode::REQUEST_BUSY);
+    auto completions = getCompletions(1, 1);
+    ASSERT_EQ(request, completions[0].request);
+    if (status == IEStatusCode::REQUEST_BUSY)
+        ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_release(pool, request));
+
+    // Not acquired request can't be started
+    ASSERT_EQ(IEStatusCode::GENERAL_ERROR, ie_infer_request_pool_start_async(pool, request, nullptr));
+}
+
+TEST_F(IECApiPoolTests, failedStartIsRolledBack) {
+    ie_infer_request_t *request = nullptr;
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_acquire(pool, 0, &request));
+    fillInput(request, 1.f);
+
+    // The inference started bypassing the pool makes the start fail unless it is already finished
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_infer_async(request));
+    IEStatusCode status = ie_infer_request_pool_start_async(pool, request, nullptr);
+    ASSERT_TRUE(status == IEStatusCode::OK || status == IEStatusCode::REQUEST_BUSY);
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_wait(request, -1));
+
+    if (status == IEStatusCode::OK) {
+        getCompletions(1, 1);
+    } else {
+        // The failed start is not a completion of the pool. The direct inference is not either, unless it
+        // finished right between the pool marked the request running and the start failed.
+        ie_infer_completion_t completions[2];
+        size_t completions_num = 0;
+        IEStatusCode completions_status = ie_infer_request_pool_get_completions(pool, completions, 2, 20, &completions_num);
+        ASSERT_TRUE(completions_status == IEStatusCode::RESULT_NOT_READY || completions_num == 1);
+    }
+    // The request is not running for the pool, so it is released and the pool is freed without waiting for it
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_release(pool, request));
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_free(&pool));
+    ASSERT_EQ(nullptr, pool);
+}
+
+TEST_F(IECApiPoolTests, completionCallbackOfPooledRequestIsRejected) {
+    ie_infer_request_t *request = nullptr;
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_acquire(pool, 0, &request));
+    ie_complete_call_back_t callback = {[](void *) {}, nullptr};
+    ASSERT_EQ(IEStatusCode::GENERAL_ERROR, ie_infer_set_completion_callback(request, &callback));
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_release(pool, request));
+}
+
+#ifdef __linux__
+TEST_F(IECApiPoolTests, eventFdIsReadableWhileCompletionsAreQueued) {
+    int fd = -1;
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_get_event_fd(pool, &fd));
+    ASSERT_LE(0, fd);
+    int same_fd = -1;
+    ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_get_event_fd(pool, &same_fd));
+    ASSERT_EQ(fd, same_fd);
+
+    pollfd poll_fd = {fd, POLLIN, 0};
+    ASSERT_EQ(0, poll(&poll_fd, 1, 0));
+
+    ie_infer_request_t *requests[2] = {};
+    for (auto &request : requests) {
+        ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_acquire(pool, 0, &request));
+        fillInput(request, 1.f);
+        ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_start_async(pool, request, nullptr));
+    }
+
+    // The descriptor is readable while a completion is queued, the counter is reset when the last one is taken
+    for (size_t i = 0; i < 2; i++) {
+        poll_fd.revents = 0;
+        ASSERT_EQ(1, poll(&poll_fd, 1, 5000));
+        ASSERT_TRUE(poll_fd.revents & POLLIN);
+        getCompletions(1, 1);
+    }
+    poll_fd.revents = 0;
+    ASSERT_EQ(0, poll(&poll_fd, 1, 0));
+
+    for (auto &request : requests)
+        ASSERT_EQ(IEStatusCode::OK, ie_infer_request_pool_release(pool, request));
+}
+#endif
+
+TEST_F(IECApiTests, preallocatedMemoryIsBoundInOneCall) {
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    ASSERT_EQ(IEStatusCode::OK, ie_core_load_network(core, network, "CPU", &config, &exe_network));
+    ie_infer_request_t *infer_request = nullptr;
+    ASSERT_EQ(IEStatusCode::OK, ie_exec_network_create_infer_request(exe_network, &infer_request));
+
+    std::vector<float> src(inputSize), dst(inputSize, 0.f);
+    for (size_t i = 0; i < inputSize; i++)
+        src[i] = static_cast<float>(i);
+    tensor_desc_t desc = {layout_e::NCHW, {4, {1, 3, 4, 4}}, precision_e::FP32};
+    ie_blob_binding_t bindings[] = {{"data", desc, src.data(), inputSize},
+                                    {"out", desc, dst.data(), inputSize}};
+
+    EXPECT_EQ(IEStatusCode::OK, ie_infer_request_set_blobs_from_preallocated(infer_request, bindings, 2));
+    EXPECT_EQ(IEStatusCode::OK, ie_infer_request_infer(infer_request));
+    for (size_t i = 0; i < inputSize; i++)
+        EXPECT_FLOAT_EQ(2.f * i, dst[i]) << "at " << i;
+
+    // Incomplete bindings are rejected before any of them is set
+    ie_blob_binding_t wrong[] = {{"data", desc, src.data(), inputSize},
+                                 {nullptr, desc, dst.data(), inputSize}};
+    EXPECT_EQ(IEStatusCode::GENERAL_ERROR, ie_infer_request_set_blobs_from_preallocated(infer_request, wrong, 2));
+    EXPECT_EQ(IEStatusCode::GENERAL_ERROR, ie_infer_request_set_blobs_from_preallocated(infer_request, nullptr, 1));
+    EXPECT_EQ(IEStatusCode::OK, ie_infer_request_set_blobs_from_preallocated(infer_request, nullptr, 0));
+
+    ie_infer_request_free(&infer_request);
+    ie_exec_network_free(&exe_network);
+}
@@ -1,4 +1,4 @@
 from .ie_api import *
-__all__ = ['IENetwork', "IEPlugin", "IECore", "get_version"]
+__all__ = ['IENetwork', "IEPlugin", "IECore", "AsyncInferQueue", "get_version"]
 __version__ = get_version()
 
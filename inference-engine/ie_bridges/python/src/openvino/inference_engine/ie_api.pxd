@@ -10,6 +10,7 @@ cdef class BlobBuffer:
     cdef char*format
     cdef vector[Py_ssize_t] shape
     cdef vector[Py_ssize_t] strides
+    cdef bint read_only
     cdef reset(self, Blob.Ptr &)
     cdef char*_get_blob_format(self, const TensorDesc & desc)
 
@@ -21,13 +22,14 @@ cdef class InferRequest:
 
     cpdef BlobBuffer _get_blob_buffer(self, const string & blob_name)
 
-    cpdef infer(self, inputs = ?)
-    cpdef async_infer(self, inputs = ?)
+    cpdef infer(self, inputs = ?, share_inputs = ?)
+    cpdef async_infer(self, inputs = ?, share_inputs = ?)
     cpdef wait(self, timeout = ?)
     cpdef get_perf_counts(self)
     cdef void user_callback(self, int status) with gil
     cdef public:
-        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called
+        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called, \
+        _py_callback_status, _request_blobs, _user_inputs
 
 cdef class IENetwork:
     cdef C.IENetwork impl
@@ -10,12 +10,15 @@ from libcpp.memory cimport unique_ptr, shared_ptr
 from libc.stdlib cimport malloc, free
 from libc.stdint cimport int64_t, uint8_t
 from libc.string cimport memcpy, strcpy
+from cpython.buffer cimport PyBUF_WRITABLE
 import os
 import numpy as np
 from copy import deepcopy
 import warnings
 from collections import OrderedDict, namedtuple
 from collections import OrderedDict
+from collections import deque
+import asyncio
 import threading
 
 cdef extern from "<utility>" namespace "std" nogil:
@@ -418,7 +421,7 @@ cdef class ExecutableNetwork:
     def infer(self, inputs=None):
         current_request = self.requests[0]
         current_request.infer(inputs)
-        return deepcopy(current_request.outputs)
+        return current_request.outputs
 
     ## Starts asynchronous inference for specified infer request.
     #  Wraps `async_infer()` method of the `InferRequest` class.
@@ -551,11 +554,18 @@ cdef class InferRequest:
         self._py_callback = lambda *args, **kwargs: None
         self._py_callback_used = False
         self._py_callback_called = threading.Event()
+        self._py_callback_status = StatusCode.OK
         self._py_data = None
+        self._request_blobs = {}
+        self._user_inputs = {}
 
     cdef void user_callback(self, int status) with gil:
-        if self._py_callback:
-            self._py_callback(status, self._py_data)
+        # Status is kept for wait(), which has to report failures of the request as well
+        self._py_callback_status = status
+        try:
+            if self._py_callback:
+                self._py_callback(status, self._py_data)
+        finally:
             self._py_callback_called.set()
 
     ## Description: Sets a callback function that is called on success or failure of an asynchronous request
@@ -589,10 +599,14 @@ cdef class InferRequest:
         buffer.reset(blob_ptr)
         return buffer
 
-    ## Starts synchronous inference of the infer request and fill outputs array
+    ## Starts synchronous inference of the infer request and fill outputs array.
+    #  The GIL is released while the request runs, so other Python threads can run their requests in parallel.
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                 input data for the layer
+    #  @param share_inputs: If True, C-contiguous arrays of the input shape and precision are used by the request
+    #                       directly without copying, so they must not be modified until it completes.
+    #                       Other inputs are copied as by default.
     #  @return None
     #
     #  Usage example:\n
@@ -605,15 +619,20 @@ cdef class InferRequest:
     #         5.45198545e-02, 2.44456064e-02, 5.41366823e-03, 3.42589128e-03,
     #         2.26027006e-03, 2.12283316e-03 ...])
     #  ```
-    cpdef infer(self, inputs=None):
+    cpdef infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, share_inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            deref(self.impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
-    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with input data for the layer
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
+    #                 input data for the layer
+    #  @param share_inputs: If True, C-contiguous arrays of the input shape and precision are used by the request
+    #                       directly without copying, so they must not be modified until it completes.
+    #                       Other inputs are copied as by default.
     #  @return: None
     #
     #  Usage example:\n
@@ -623,9 +642,9 @@ cdef class InferRequest:
     #  request_status = exec_net.requests[0].wait()
     #  res = exec_net.requests[0].outputs['prob']
     #  ```
-    cpdef async_infer(self, inputs=None):
+    cpdef async_infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, share_inputs)
         self._py_callback_called.clear()
         deref(self.impl).infer_async()
 
@@ -638,19 +657,24 @@ cdef class InferRequest:
     #
     #  @param timeout: Time to wait in milliseconds or special (0, -1) cases described above.
     #                  If not specified, `timeout` value is set to -1 by default.
-    #  @return Request status code.
+    #  @return Request status code. If a completion callback is set, it is the status the callback was called with.
     #
     #  Usage example: See `async_infer()` method of the the `InferRequest` class.
     cpdef wait(self, timeout=None):
+        cdef int64_t c_timeout
+        cdef int status
         if self._py_callback_used:
             while not self._py_callback_called.is_set():
                 if not self._py_callback_called.wait(timeout):
                     return StatusCode.REQUEST_BUSY
-            return StatusCode.OK
+            return self._py_callback_status
         else:
             if timeout is None:
                 timeout = -1
-            return deref(self.impl).wait(<int64_t> timeout)
+            c_timeout = <int64_t> timeout
+            with nogil:
+                status = deref(self.impl).wait(c_timeout)
+            return status
 
     ## Queries performance measures per layer to get feedback of what is the most time consuming layer.
     #  NOTE: Performance counters data and format depends on the plugin
@@ -686,7 +710,10 @@ cdef class InferRequest:
         return profile
 
     ## A dictionary that maps input layer names to `numpy.ndarray`
-    #  objects of proper shape with input data for the layer
+    #  objects of proper shape with input data for the layer.
+    #  NOTE: After `infer()` or `async_infer()` shared an input array (`share_inputs=True`), the entry of the input
+    #  refers to the memory of that array: writing to one of them changes the other. The entry gets the memory of the
+    #  request back when the input is copied again.
     @property
     def inputs(self):
         inputs = {}
@@ -702,6 +729,24 @@ cdef class InferRequest:
             outputs[output] = self._get_blob_buffer(output.encode()).to_numpy()
         return deepcopy(outputs)
 
+    ## A dictionary that maps output layer names to read-only `numpy.ndarray` views of the output data.
+    #  Unlike `outputs`, the data is not copied, so the views are valid until the next inference of the request only.
+    #
+    #  Usage example:\n
+    #  ```python
+    #  exec_net.requests[0].infer({input_blob: image})
+    #  top = np.argmax(exec_net.requests[0].output_views['prob'])
+    #  ```
+    @property
+    def output_views(self):
+        cdef BlobBuffer buffer
+        views = {}
+        for output in self._outputs_list:
+            buffer = self._get_blob_buffer(output.encode())
+            buffer.read_only = True
+            views[output] = buffer.to_numpy()
+        return views
+
     ## Current infer request inference time in milliseconds
     @property
     def latency(self):
@@ -730,10 +775,163 @@ cdef class InferRequest:
             raise ValueError("Batch size should be positive integer number but {} specified".format(size))
         deref(self.impl).setBatch(size)
 
-    def _fill_inputs(self, inputs):
+    ## Sets the priority of the request over the requests of the same and other executable networks.
+    #  By default the request has the priority of its executable network (`CPU_PRIORITY` key of the CPU plugin).
+    #
+    #  @param priority: New priority, the requests with higher values are executed first
+    #  @return None
+    #
+    #  Usage example:\n
+    #  ```python
+    #  exec_net = ie_core.load_network(network=net, device_name="CPU", num_requests=2)
+    #  exec_net.requests[0].set_priority(10)
+    #  ```
+    def set_priority(self, priority: int):
+        deref(self.impl).setPriority(priority)
+
+    def _fill_inputs(self, inputs, share_inputs=False):
+        cdef BlobBuffer request_blob
+        cdef size_t data
         for k, v in inputs.items():
             assert k in self._inputs_list, "No input with name {} found in network".format(k)
-            self.inputs[k][:] = v
+            # Blob allocated by the request is kept to return to it when the data has to be copied again
+            if k not in self._request_blobs:
+                self._request_blobs[k] = self._get_blob_buffer(k.encode())
+            request_blob = self._request_blobs[k]
+            request_data = request_blob.to_numpy()
+
+            if share_inputs and isinstance(v, np.ndarray) and v.flags['C_CONTIGUOUS'] and \
+                    v.dtype == request_data.dtype and v.shape == request_data.shape:
+                data = v.__array_interface__['data'][0]
+                deref(self.impl).setBlobFromBuffer(k.encode(), <void *> data)
+                # The request refers to the array memory, so the array is kept alive while it is set
+                self._user_inputs[k] = v
+            else:
+                if k in self._user_inputs:
+                    deref(self.impl).setBlob(k.encode(), request_blob.ptr)
+                    del self._user_inputs[k]
+                request_data[:] = v
+
+
+## This class is a pool of infer requests of `ExecutableNetwork` integrated with `asyncio` event loop.
+#  Jobs wait for an idle request without polling and are completed by the request completion callbacks, which only
+#  hand the result over to the event loop thread. So a single event loop keeps all the requests busy.
+#
+#  Usage example:\n
+#  ```python
+#  ie = IECore()
+#  exec_net = ie.load_network(network=net, device_name="CPU", num_requests=0)
+#  queue = AsyncInferQueue(exec_net)
+#  queue.set_callback(lambda request, image_id: (image_id, np.argmax(request.output_views['prob'])))
+#
+#  async def classify(images):
+#      return await asyncio.gather(*[queue.infer({input_blob: image}, image_id) for image_id, image in images])
+#  ```
+class AsyncInferQueue:
+    ## Class constructor
+    #
+    #  @param exec_net: `ExecutableNetwork` which requests are used by the queue. Completion callbacks of the requests
+    #                   are replaced, so they should not be used by other code while the queue exists.
+    #  @param loop: `asyncio` event loop the jobs are awaited in, the current one is used if not specified
+    #  @return An instance of AsyncInferQueue class
+    def __init__(self, exec_net, loop=None):
+        self._requests = exec_net.requests
+        self._loop = loop if loop is not None else asyncio.get_event_loop()
+        self._idle = deque(range(len(self._requests)))
+        self._waiters = deque()
+        self._jobs = [None] * len(self._requests)
+        self._callback = None
+        for request_id, request in enumerate(self._requests):
+            request.set_completion_callback(self._on_request_complete, request_id)
+
+    ## Number of requests in the queue
+    def __len__(self):
+        return len(self._requests)
+
+    ## Returns True if there is an idle request, so the next job starts without waiting
+    def is_ready(self):
+        return len(self._idle) > 0
+
+    ## Sets a function which turns a completed request into the job result. The function is called in the event
+    #  loop thread as `callback(request, userdata)` before the request is reused, so it can read `output_views`
+    #  without copying. If no callback is set, the result is the `outputs` dictionary of the request.
+    def set_callback(self, callback):
+        self._callback = callback
+
+    ## Waits for an idle request and starts inference on it.
+    #
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects with input data
+    #  @param userdata: Any object passed to the callback set by `set_callback()` together with the request
+    #  @return `asyncio.Future` which is resolved with the job result when the request completes
+    async def start_async(self, inputs=None, userdata=None):
+        request_id = await self._acquire()
+        future = self._loop.create_future()
+        self._jobs[request_id] = (future, userdata)
+        try:
+            self._requests[request_id].async_infer(inputs)
+        except:
+            self._jobs[request_id] = None
+            self._release(request_id)
+            raise
+        return future
+
+    ## Runs the job on an idle request and waits for its result.
+    #  Parameters are the same as for `start_async()`.
+    #
+    #  @return Job result, see `set_callback()`
+    async def infer(self, inputs=None, userdata=None):
+        return await (await self.start_async(inputs, userdata))
+
+    ## Waits until all the started jobs complete
+    async def wait_all(self):
+        jobs = [job[0] for job in self._jobs if job is not None]
+        if jobs:
+            await asyncio.wait(jobs)
+
+    async def _acquire(self):
+        while not self._idle:
+            waiter = self._loop.create_future()
+            self._waiters.append(waiter)
+            try:
+                await waiter
+            except asyncio.CancelledError:
+                # The request this waiter was woken for is passed to the next one
+                if waiter.done() and not waiter.cancelled():
+                    self._wake_waiter()
+                raise
+        return self._idle.popleft()
+
+    def _release(self, request_id):
+        self._idle.append(request_id)
+        self._wake_waiter()
+
+    def _wake_waiter(self):
+        while self._waiters:
+            waiter = self._waiters.popleft()
+            if not waiter.done():
+                waiter.set_result(None)
+                break
+
+    # Called in the thread of the plugin, the GIL is only held to schedule the completion in the event loop
+    def _on_request_complete(self, status, request_id):
+        self._loop.call_soon_threadsafe(self._complete, request_id, status)
+
+    def _complete(self, request_id, status):
+        future, userdata = self._jobs[request_id]
+        self._jobs[request_id] = None
+        try:
+            if status != StatusCode.OK:
+                raise RuntimeError("Infer request {} failed with status code {}".format(request_id, status))
+            request = self._requests[request_id]
+            result = self._callback(request, userdata) if self._callback is not None else request.outputs
+        except Exception as e:
+            if not future.cancelled():
+                future.set_exception(e)
+        else:
+            if not future.cancelled():
+                future.set_result(result)
+        finally:
+            self._release(request_id)
 
 
 ## Layer calibration statistic container.
@@ -1306,6 +1504,8 @@ cdef class BlobBuffer:
         self.item_size = itemsize
 
     def __getbuffer__(self, Py_buffer *buffer, int flags):
+        if self.read_only and flags & PyBUF_WRITABLE:
+            raise BufferError("Blob buffer is read-only")
         buffer.buf = C.get_buffer[char](deref(self.ptr))
         buffer.format = self.format
         buffer.internal = NULL
@@ -1313,7 +1513,7 @@ cdef class BlobBuffer:
         buffer.len = self.total_stride
         buffer.ndim = self.shape.size()
         buffer.obj = self
-        buffer.readonly = 0
+        buffer.readonly = self.read_only
         buffer.shape = self.shape.data()
         buffer.strides = self.strides.data()
         buffer.suboffsets = NULL
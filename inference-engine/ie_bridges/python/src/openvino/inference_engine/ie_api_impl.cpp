@@ -471,25 +471,73 @@ void InferenceEnginePython::InferRequestWrap::getBlobPtr(const std::string &blob
     IE_CHECK_CALL(request_ptr->GetBlob(blob_name.c_str(), blob_ptr, &response));
 }
 
+void InferenceEnginePython::InferRequestWrap::setBlob(const std::string &blob_name,
+                                                      const InferenceEngine::Blob::Ptr &blob_ptr) {
+    InferenceEngine::ResponseDesc response;
+    IE_CHECK_CALL(request_ptr->SetBlob(blob_name.c_str(), blob_ptr, &response));
+}
+
+void InferenceEnginePython::InferRequestWrap::setBlobFromBuffer(const std::string &blob_name, void *data) {
+    InferenceEngine::Blob::Ptr blob_ptr;
+    getBlobPtr(blob_name, blob_ptr);
+    const InferenceEngine::TensorDesc &desc = blob_ptr->getTensorDesc();
+
+    InferenceEngine::Blob::Ptr wrapper;
+    switch (desc.getPrecision()) {
+        case InferenceEngine::Precision::FP32:
+            wrapper = InferenceEngine::make_shared_blob<float>(desc, static_cast<float *>(data));
+            break;
+        case InferenceEngine::Precision::FP16:
+        case InferenceEngine::Precision::I16:
+            wrapper = InferenceEngine::make_shared_blob<int16_t>(desc, static_cast<int16_t *>(data));
+            break;
+        case InferenceEngine::Precision::U16:
+            wrapper = InferenceEngine::make_shared_blob<uint16_t>(desc, static_cast<uint16_t *>(data));
+            break;
+        case InferenceEngine::Precision::I8:
+            wrapper = InferenceEngine::make_shared_blob<int8_t>(desc, static_cast<int8_t *>(data));
+            break;
+        case InferenceEngine::Precision::U8:
+            wrapper = InferenceEngine::make_shared_blob<uint8_t>(desc, static_cast<uint8_t *>(data));
+            break;
+        case InferenceEngine::Precision::I32:
+            wrapper = InferenceEngine::make_shared_blob<int32_t>(desc, static_cast<int32_t *>(data));
+            break;
+        case InferenceEngine::Precision::I64:
+            wrapper = InferenceEngine::make_shared_blob<int64_t>(desc, static_cast<int64_t *>(data));
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Cannot wrap buffer for blob " << blob_name << " with precision "
+                               << desc.getPrecision();
+    }
+    setBlob(blob_name, wrapper);
+}
+
 
 void InferenceEnginePython::InferRequestWrap::setBatch(int size) {
     InferenceEngine::ResponseDesc response;
     IE_CHECK_CALL(request_ptr->SetBatch(size, &response));
 }
 
+void InferenceEnginePython::InferRequestWrap::setPriority(int priority) {
+    InferenceEngine::ResponseDesc response;
+    IE_CHECK_CALL(request_ptr->SetPriority(priority, &response));
+}
+
 void latency_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
-    if (code != InferenceEngine::StatusCode::OK) {
-        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
-    }
     InferenceEnginePython::InferRequestWrap *requestWrap;
     InferenceEngine::ResponseDesc dsc;
     request->GetUserData(reinterpret_cast<void **>(&requestWrap), &dsc);
     auto end_time = Time::now();
     auto execTime = std::chrono::duration_cast<ns>(end_time - requestWrap->start_time);
     requestWrap->exec_time = static_cast<double>(execTime.count()) * 0.000001;
+    // User callback gets failures as well, otherwise the code waiting for it would never know the request finished
     if (requestWrap->user_callback) {
         requestWrap->user_callback(requestWrap->user_data, code);
     }
+    if (code != InferenceEngine::StatusCode::OK) {
+        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
+    }
 }
 
 void InferenceEnginePython::InferRequestWrap::setCyCallback(cy_callback callback, void *data) {
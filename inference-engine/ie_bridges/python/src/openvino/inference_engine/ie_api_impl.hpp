@@ -92,8 +92,15 @@ struct InferRequestWrap {
 
     void getBlobPtr(const std::string &blob_name, InferenceEngine::Blob::Ptr &blob_ptr);
 
+    void setBlob(const std::string &blob_name, const InferenceEngine::Blob::Ptr &blob_ptr);
+
+    // Wraps the caller memory of the same shape and precision as the current blob without copying
+    void setBlobFromBuffer(const std::string &blob_name, void *data);
+
     void setBatch(int size);
 
+    void setPriority(int priority);
+
     std::map<std::string, InferenceEnginePython::ProfileInfo> getPerformanceCounts();
 };
 
@@ -154,11 +154,14 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
     cdef cppclass InferRequestWrap:
         double exec_time;
         void getBlobPtr(const string & blob_name, Blob.Ptr & blob_ptr) except +
+        void setBlob(const string & blob_name, const Blob.Ptr & blob_ptr) except +
+        void setBlobFromBuffer(const string & blob_name, void * data) except +
         map[string, ProfileInfo] getPerformanceCounts() except +
-        void infer() except +
+        void infer() nogil except +
         void infer_async() except +
-        int wait(int64_t timeout) except +
+        int wait(int64_t timeout) nogil except +
         void setBatch(int size) except +
+        void setPriority(int priority) except +
         void setCyCallback(void (*)(void*, int), void *) except +
 
     cdef cppclass IECore:
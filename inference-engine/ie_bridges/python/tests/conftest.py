@@ -0,0 +1,69 @@
+# Copyright (C) 2018-2020 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+
+import pytest
+
+from openvino.inference_engine import IECore, IENetwork
+
+# Network doubling its input: out = 2 * data
+DOUBLE_MODEL = """<?xml version="1.0" ?>
+<net name="double" version="7" batch="1">
+    <layers>
+        <layer id="0" name="data" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="out" precision="FP32" type="Power">
+            <data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+"""
+
+INPUT_SHAPE = (1, 3, 4, 4)
+
+
+@pytest.fixture(scope="session")
+def device():
+    return os.environ.get("TEST_DEVICE", "CPU")
+
+
+@pytest.fixture(scope="session")
+def ie_core():
+    return IECore()
+
+
+@pytest.fixture
+def network(tmp_path):
+    xml = tmp_path / "double.xml"
+    weights = tmp_path / "double.bin"
+    xml.write_text(DOUBLE_MODEL)
+    weights.write_bytes(b"\0" * 4)
+    return IENetwork(model=str(xml), weights=str(weights))
@@ -0,0 +1,155 @@
+# Copyright (C) 2018-2020 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import asyncio
+import threading
+
+import numpy as np
+import pytest
+
+from conftest import INPUT_SHAPE
+from openvino.inference_engine import AsyncInferQueue
+
+STATUS_OK = 0
+STATUS_GENERAL_ERROR = -1
+
+
+class FakeRequest:
+    """Request doubling its input which completes from another thread after the delay"""
+
+    def __init__(self, delay=0.0, status=STATUS_OK):
+        self.delay = delay
+        self.status = status
+        self.outputs = None
+        self._callback = None
+        self._data = None
+
+    def set_completion_callback(self, py_callback, py_data=None):
+        self._callback = py_callback
+        self._data = py_data
+
+    def async_infer(self, inputs=None):
+        self.outputs = {"out": 2 * inputs["data"]}
+        threading.Timer(self.delay, self._callback, (self.status, self._data)).start()
+
+
+class FakeExecutableNetwork:
+    def __init__(self, requests):
+        self.requests = requests
+
+
+def run(coroutine_function):
+    loop = asyncio.new_event_loop()
+    try:
+        return loop.run_until_complete(coroutine_function(loop))
+    finally:
+        loop.close()
+
+
+def make_inputs(count):
+    return [np.full(INPUT_SHAPE, i, dtype=np.float32) for i in range(count)]
+
+
+def test_results_match_jobs(ie_core, device, network):
+    exec_net = ie_core.load_network(network, device, num_requests=2)
+    inputs = make_inputs(8)
+
+    async def main(loop):
+        queue = AsyncInferQueue(exec_net, loop)
+        return await asyncio.gather(*[queue.infer({"data": data}) for data in inputs])
+
+    results = run(main)
+    for data, result in zip(inputs, results):
+        assert np.allclose(result["out"], 2 * data)
+
+
+def test_jobs_resolve_in_completion_order():
+    # The first request completes after the second one
+    exec_net = FakeExecutableNetwork([FakeRequest(delay=0.2), FakeRequest()])
+    inputs = make_inputs(2)
+
+    async def main(loop):
+        queue = AsyncInferQueue(exec_net, loop)
+        completed = []
+        futures = []
+        for job_id, data in enumerate(inputs):
+            future = await queue.start_async({"data": data})
+            future.add_done_callback(lambda f, job_id=job_id: completed.append(job_id))
+            futures.append(future)
+        results = await asyncio.gather(*futures)
+        return completed, results
+
+    completed, results = run(main)
+    assert completed == [1, 0]
+    for data, result in zip(inputs, results):
+        assert np.array_equal(result["out"], 2 * data)
+
+
+def test_request_failure_is_raised_from_job():
+    exec_net = FakeExecutableNetwork([FakeRequest(status=STATUS_GENERAL_ERROR)])
+
+    async def main(loop):
+        queue = AsyncInferQueue(exec_net, loop)
+        with pytest.raises(RuntimeError):
+            await queue.infer({"data": make_inputs(1)[0]})
+        # The failed request is reused by the next job
+        assert queue.is_ready()
+
+    run(main)
+
+
+def test_callback_exception_is_raised_from_job(ie_core, device, network):
+    exec_net = ie_core.load_network(network, device, num_requests=1)
+    data = make_inputs(2)[1]
+
+    def callback(request, userdata):
+        if userdata == "fail":
+            raise ValueError("callback failed")
+        return request.outputs
+
+    async def main(loop):
+        queue = AsyncInferQueue(exec_net, loop)
+        queue.set_callback(callback)
+        with pytest.raises(ValueError):
+            await queue.infer({"data": data}, "fail")
+        return await queue.infer({"data": data})
+
+    result = run(main)
+    assert np.allclose(result["out"], 2 * data)
+
+
+def test_wait_all(ie_core, device, network):
+    exec_net = ie_core.load_network(network, device, num_requests=2)
+    inputs = make_inputs(6)
+
+    async def main(loop):
+        queue = AsyncInferQueue(exec_net, loop)
+        futures = [await queue.start_async({"data": data}) for data in inputs]
+        await queue.wait_all()
+        assert all(future.done() for future in futures)
+        assert queue.is_ready()
+        return [future.result() for future in futures]
+
+    results = run(main)
+    for data, result in zip(inputs, results):
+        assert np.allclose(result["out"], 2 * data)
+
+
+def test_wait_returns_callback_status(ie_core, device, network):
+    request = ie_core.load_network(network, device).requests[0]
+    statuses = []
+    request.set_completion_callback(lambda status, py_data: statuses.append(status))
+    request.async_infer({"data": make_inputs(2)[1]})
+    assert request.wait() == STATUS_OK
+    assert statuses == [STATUS_OK]
+
+
+def test_wait_returns_when_callback_raises(ie_core, device, network):
+    request = ie_core.load_network(network, device).requests[0]
+
+    def callback(status, py_data):
+        raise ValueError("callback failed")
+
+    request.set_completion_callback(callback)
+    request.async_infer({"data": make_inputs(2)[1]})
+    assert request.wait(10000) == STATUS_OK
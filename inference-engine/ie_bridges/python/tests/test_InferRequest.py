@@ -0,0 +1,125 @@
+# Copyright (C) 2018-2020 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import gc
+
+import numpy as np
+import pytest
+
+from conftest import INPUT_SHAPE
+
+
+def test_infer(ie_core, device, network):
+    request = ie_core.load_network(network, device).requests[0]
+    data = np.random.rand(*INPUT_SHAPE).astype(np.float32)
+    request.infer({"data": data})
+    assert np.allclose(request.outputs["out"], 2 * data)
+
+
+def test_inputs_are_copied_by_default(ie_core, device, network):
+    request = ie_core.load_network(network, device).requests[0]
+    data = np.ones(INPUT_SHAPE, dtype=np.float32)
+    request.infer({"data": data})
+    assert not np.shares_memory(request.inputs["data"], data)
+
+    # Changes of the array after the call are not seen by the request
+    data[:] = 5
+    request.infer()
+    assert np.all(request.outputs["out"] == 2)
+
+
+def test_shared_inputs_alias_array_used_without_copy(ie_core, device, network):
+    request = ie_core.load_network(network, device).requests[0]
+    data = np.random.rand(*INPUT_SHAPE).astype(np.float32)
+    request.infer({"data": data}, share_inputs=True)
+    assert np.shares_memory(request.inputs["data"], data)
+
+    # The request reads the array memory, so changes of the array are seen by the next inference
+    data[:] = 5
+    assert np.all(request.inputs["data"] == 5)
+    request.infer()
+    assert np.all(request.outputs["out"] == 10)
+
+
+@pytest.mark.parametrize("make_input", [
+    lambda data: data.astype(np.float64),
+    lambda data: np.asfortranarray(data),
+    lambda data: data.tolist(),
+], ids=["precision", "layout", "list"])
+def test_shared_inputs_are_copied_on_mismatch(ie_core, device, network, make_input):
+    request = ie_core.load_network(network, device).requests[0]
+    data = np.random.rand(*INPUT_SHAPE).astype(np.float32)
+    user_input = make_input(data)
+    request.infer({"data": user_input}, share_inputs=True)
+    if isinstance(user_input, np.ndarray):
+        assert not np.shares_memory(request.inputs["data"], user_input)
+    assert np.allclose(request.outputs["out"], 2 * data)
+
+
+def test_request_memory_is_restored_after_copy(ie_core, device, network):
+    request = ie_core.load_network(network, device).requests[0]
+    aliased = np.ones(INPUT_SHAPE, dtype=np.float32)
+    request.infer({"data": aliased}, share_inputs=True)
+    assert np.shares_memory(request.inputs["data"], aliased)
+
+    copied = np.full(INPUT_SHAPE, 3, dtype=np.float32)
+    request.infer({"data": copied})
+    assert not np.shares_memory(request.inputs["data"], aliased)
+    assert np.all(request.outputs["out"] == 6)
+
+    # The array used before is not referenced by the request anymore
+    aliased[:] = 7
+    request.infer()
+    assert np.all(request.outputs["out"] == 6)
+
+
+def test_output_views_are_read_only(ie_core, device, network):
+    request = ie_core.load_network(network, device).requests[0]
+    request.infer({"data": np.ones(INPUT_SHAPE, dtype=np.float32)})
+    views = request.output_views
+    assert np.array_equal(views["out"], request.outputs["out"])
+    with pytest.raises(ValueError):
+        views["out"][0] = 0
+
+
+def test_output_views_are_valid_until_next_infer(ie_core, device, network):
+    request = ie_core.load_network(network, device).requests[0]
+    request.infer({"data": np.ones(INPUT_SHAPE, dtype=np.float32)})
+    views = request.output_views
+    outputs = request.outputs
+
+    # Views share the memory of the output blobs, outputs are copies
+    request.infer({"data": np.full(INPUT_SHAPE, 3, dtype=np.float32)})
+    assert np.all(views["out"] == 6)
+    assert np.all(outputs["out"] == 2)
+
+
+def test_output_views_keep_blobs_alive(ie_core, device, network):
+    exec_net = ie_core.load_network(network, device)
+    request = exec_net.requests[0]
+    request.infer({"data": np.ones(INPUT_SHAPE, dtype=np.float32)})
+    views = request.output_views
+
+    del request
+    del exec_net
+    gc.collect()
+    assert np.all(views["out"] == 2)
+
+
+def test_set_priority(ie_core, device, network):
+    if device != "CPU":
+        pytest.skip("CPU_PRIORITY is supported by the CPU plugin only")
+    exec_net = ie_core.load_network(network, device, config={"CPU_PRIORITY": "1"})
+    request = exec_net.requests[0]
+    request.set_priority(5)
+    data = np.random.rand(*INPUT_SHAPE).astype(np.float32)
+    request.infer({"data": data})
+    assert np.allclose(request.outputs["out"], 2 * data)
+
+
+@pytest.mark.parametrize("priority", ["abc", "1.5", ""])
+def test_wrong_priority_is_rejected(ie_core, device, network, priority):
+    if device != "CPU":
+        pytest.skip("CPU_PRIORITY is supported by the CPU plugin only")
+    with pytest.raises(RuntimeError):
+        ie_core.load_network(network, device, config={"CPU_PRIORITY": priority})
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for the Batching plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods of plugins
+ *
+ * @file batch_plugin_config.hpp
+ */
+
+#pragma once
+
+#include <string>
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Batching plugin configuration
+ */
+namespace BatchConfigParams {
+
+/**
+ * @def BATCH_CONFIG_KEY(name)
+ * @brief Shortcut for defining BATCH configuration keys
+ */
+#define BATCH_CONFIG_KEY(name) InferenceEngine::BatchConfigParams::_CONFIG_KEY(BATCH_##name)
+#define DECLARE_BATCH_CONFIG_KEY(name) DECLARE_CONFIG_KEY(BATCH_##name)
+
+/**
+ * @brief The key for the device which executes the batched network, for example "CPU".
+ * It is set by the Core when the "BATCH:<device>" device name is used
+ */
+DECLARE_BATCH_CONFIG_KEY(DEVICE);
+
+/**
+ * @brief The key for the number of requests which are coalesced into one inference of the device.
+ * This option should be used with values: positive integer, 8 by default
+ */
+DECLARE_BATCH_CONFIG_KEY(SIZE);
+
+/**
+ * @brief The key for the maximum time in microseconds a started request waits for the batch to be filled.
+ * When it elapses, the started requests are inferred without batching.
+ * This option should be used with values: non-negative integer, 1000 by default
+ */
+DECLARE_BATCH_CONFIG_KEY(TIMEOUT);
+
+}  // namespace BatchConfigParams
+}  // namespace InferenceEngine
@@ -190,6 +190,15 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+     * @brief Sets the priority of the request over the requests of the same and other executable networks.
+     *
+     * @param priority new priority, the requests with higher values are executed first.
+     */
+    void SetPriority(const int priority) {
+        CALL_STATUS_FNC(SetPriority, priority);
+    }
+
     /**
      * constructs InferRequest from the initialized shared_pointer
      * @param request Initialized shared pointer
@@ -177,6 +177,26 @@ public:
      * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
      */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Sets the priority of the request over the requests of the same and other executable networks.
+     *
+     * The requests with higher values are executed first. By default the request has the priority of its
+     * executable network. Plugins which do not schedule the requests return InferenceEngine::NOT_IMPLEMENTED.
+     *
+     * @note Adding the method extends the virtual table of the interface, so it breaks binary compatibility:
+     * plugins must be rebuilt against this header. Calling it on a request created by a plugin built before
+     * it is undefined behavior.
+     *
+     * @param priority new priority to be used by all the following inference calls for this request.
+     * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if
+     * occurred)
+     * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success,
+     * InferenceEngine::NOT_IMPLEMENTED if the request does not support priorities
+     */
+    virtual InferenceEngine::StatusCode SetPriority(int /*priority*/, ResponseDesc* /*resp*/) noexcept {
+        return NOT_IMPLEMENTED;
+    }
 };
 
 }  // namespace InferenceEngine
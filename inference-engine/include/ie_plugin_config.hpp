@@ -12,6 +12,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -155,6 +157,32 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get a std::map<std::string, float> of durations of the network loading phases in milliseconds.
+ *
+ * String value is "CPU_LOAD_PHASES". Phases of the graph of every stream are keyed as "stream<N>/<phase>",
+ * the graphs of all the streams except the first one are copied from it instead of being optimized again.
+ * Network-wide phases are "ConvertNetwork" (cloning of the network including the conversion from nGraph function),
+ * "NetworkTransformations" and "AutoTuning".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_LOAD_PHASES, std::map<std::string, float>);
+
+/**
+ * @brief Metric to get histograms of the node latencies collected with CPU_LATENCY_SAMPLING_PERIOD.
+ *
+ * String value is "CPU_NODE_LATENCY_HISTOGRAMS". The value maps the node name to the non-empty buckets of its
+ * histogram, summed over all the streams. A bucket is keyed by the upper bound of its latencies in microseconds.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_NODE_LATENCY_HISTOGRAMS, std::map<std::string, std::map<float, uint64_t>>);
+
+/**
+ * @brief Metric to get the memory traffic in bytes one inference saves on data movement layers.
+ *
+ * String value is "CPU_ELIMINATED_DATA_MOVEMENT". The value is keyed by the layer type, "Permute" counts permutes
+ * removed as inverse pairs or identities and permutes executed in place, "Reorder" counts cancelled or merged reorders.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_ELIMINATED_DATA_MOVEMENT, std::map<std::string, uint64_t>);
+
 }  // namespace Metrics
 
 /**
@@ -256,6 +284,79 @@ DECLARE_CONFIG_KEY(DYN_BATCH_ENABLED);
 DECLARE_CONFIG_KEY(DUMP_QUANTIZED_GRAPH_AS_DOT);
 DECLARE_CONFIG_KEY(DUMP_QUANTIZED_GRAPH_AS_IR);
 
+/**
+ * @brief The key enables benchmarking of the candidate implementations of every layer during network loading on CPU.
+ *
+ * It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default). Chosen implementations are reported
+ * in the executable graph and stored in the file set by KEY_CPU_TUNING_CACHE_FILE.
+ */
+DECLARE_CONFIG_KEY(CPU_AUTOTUNING);
+
+/**
+ * @brief The key sets the name of the file with implementations chosen by CPU_AUTOTUNING.
+ *
+ * Layers found in the file are not benchmarked again. The file is used even if the autotuning is disabled.
+ * A file which cannot be parsed is ignored.
+ */
+DECLARE_CONFIG_KEY(CPU_TUNING_CACHE_FILE);
+
+/**
+ * @brief The key makes CPU graph workspaces and weights backed by 2MB pages bound to the NUMA node of the stream.
+ *
+ * It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+ * - PluginConfigParams::NO (default) uses the regular allocations
+ * - CPU_HUGE_PAGES_TRANSPARENT asks the kernel to back the allocations by transparent huge pages
+ * - CPU_HUGE_PAGES_EXPLICIT uses pages reserved via /proc/sys/vm/nr_hugepages, transparent ones if there are none
+ */
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+DECLARE_CONFIG_VALUE(CPU_HUGE_PAGES_TRANSPARENT);
+DECLARE_CONFIG_VALUE(CPU_HUGE_PAGES_EXPLICIT);
+
+/**
+ * @brief The key enables histograms of the latencies of every CPU graph node, reported by the
+ * CPU_NODE_LATENCY_HISTOGRAMS metric.
+ *
+ * The value is a period of sampling: the node durations of every N-th inference of each stream are recorded.
+ * "0" (default) disables the histograms. The durations are measured anyway, so even "1" adds only a lock-free
+ * increment per node.
+ */
+DECLARE_CONFIG_KEY(CPU_LATENCY_SAMPLING_PERIOD);
+
+/**
+ * @brief The key sets the name of the file the latency histograms are periodically written to.
+ *
+ * The file is rewritten with the histograms collected since the network loading. Empty string (default) disables it.
+ */
+DECLARE_CONFIG_KEY(CPU_LATENCY_DUMP_FILE);
+
+/**
+ * @brief The key sets the period of writing the CPU_LATENCY_DUMP_FILE in seconds, "10" by default.
+ */
+DECLARE_CONFIG_KEY(CPU_LATENCY_DUMP_INTERVAL);
+
+/**
+ * @brief The key sets the name of the file the timeline of the inference is written to in Chrome trace format.
+ *
+ * The timeline contains the stages of the asynchronous pipeline, preprocessing, the graph nodes of CPU streams
+ * and HETERO subrequests. Only the requests of the executable network loaded with the key are traced, the file is
+ * written when the network is destroyed. HETERO does not pass the key to the devices of its subnetworks.
+ * Empty string (default) disables the tracing. Supported by CPU and HETERO plugins.
+ */
+DECLARE_CONFIG_KEY(TRACE_FILE);
+
+/**
+ * @brief The key sets the default priority of the infer requests of the CPU executable network.
+ *
+ * The value is an integer, "0" by default, and can be changed for a single request by InferRequest::SetPriority.
+ * The streams start queued requests with higher priority first. Inferences of all CPU networks running in
+ * the process are preempted between the graph nodes while an inference with a higher priority is running,
+ * so the cores are given to it until it completes. A preempted inference waits at most one second, then it
+ * continues and is not preempted till its end, so a steady load with higher priority slows the lower priority
+ * requests down but does not starve them.
+ */
+DECLARE_CONFIG_KEY(CPU_PRIORITY);
+
 /**
  * @brief The key controls threading inside Inference Engine.
  *
@@ -18,6 +18,13 @@ static const char input_message[] = "Optional. Path to a folder with images and/
 /// @brief message for model argument
 static const char model_message[] = "Required. Path to an .xml file with a trained model or to a .blob files with a trained compiled model";
 
+/// @brief message for models argument
+static const char models_message[] = "Optional. Path to a file with several models to run concurrently in one Core instead of -m. Every line "
+                                     "contains a path to an .xml file followed by optional settings of the model: \"d=<device>\", "
+                                     "\"nstreams=<integer>\", \"nireq=<integer>\", \"b=<integer>\", \"rate=<float>\", "
+                                     "\"arrival=<poisson/constant>\" and \"priority=<integer>\" (CPU only, higher values preempt lower "
+                                     "ones). Inputs are filled with random values.";
+
 /// @brief message for execution mode
 static const char api_message[] = "Optional. Enable Sync/Async API. Default value is \"async\".";
 
@@ -25,6 +32,7 @@ static const char api_message[] = "Optional. Enable Sync/Async API. Default valu
 static const char target_device_message[] = "Optional. Specify a target device to infer on (the list of available devices is shown below). " \
 "Default value is CPU. Use \"-d HETERO:<comma-separated_devices_list>\" format to specify HETERO plugin. " \
 "Use \"-d MULTI:<comma-separated_devices_list>\" format to specify MULTI plugin. " \
+"Use \"-d BATCH:<device>\" format to coalesce the requests into batched inferences on the device. " \
 "The application looks for a suitable plugin for the specified device.";
 
 /// @brief message for iterations count
@@ -37,6 +45,16 @@ static const char infer_requests_count_message[] = "Optional. Number of infer re
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for arrival rate
+static const char arrival_rate_message[] = "Optional. Rate of the incoming requests per second for open-loop measurement. Requests arrive "
+                                           "independently of the completion of the previous ones and wait for an idle infer request, "
+                                           "the waiting time is reported as queueing time. Default value is 0, which means closed-loop "
+                                           "measurement: a new request starts as soon as one becomes idle.";
+
+/// @brief message for arrival distribution
+static const char arrival_message[] = "Optional. Distribution of the request arrivals for open-loop measurement: \"poisson\" (default) "
+                                      "for exponentially distributed intervals or \"constant\" for equal intervals.";
+
 /// @brief message for #threads for CPU inference
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU "
                                                 "(including HETERO and MULTI cases).";
@@ -76,6 +94,10 @@ static const char report_type_message[] = "Optional. Enable collecting statistic
 // @brief message for report_folder option
 static const char report_folder_message[] = "Optional. Path to a folder where statistics report is stored.";
 
+// @brief message for report_format option
+static const char report_format_message[] = "Optional. Format of the statistics report: \"csv\" (default) or \"json\". "
+                                            "Performance counters reports are always stored in CSV.";
+
 // @brief message for exec_graph_path option
 static const char exec_graph_path_message[] = "Optional. Path to a file where to store executable graph information serialized.";
 
@@ -99,6 +121,9 @@ DEFINE_string(i, "", input_message);
 /// It is a required parameter
 DEFINE_string(m, "", model_message);
 
+/// @brief Define parameter for set file with several models
+DEFINE_string(models, "", models_message);
+
 /// @brief Define execution mode
 DEFINE_string(api, "async", api_message);
 
@@ -124,6 +149,12 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Rate of the incoming requests per second, 0 means closed-loop measurement
+DEFINE_double(rate, 0.0, arrival_rate_message);
+
+/// @brief Distribution of the request arrivals in open-loop measurement
+DEFINE_string(arrival, "poisson", arrival_message);
+
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
 
@@ -146,6 +177,9 @@ DEFINE_string(report_type, "", report_type_message);
 /// @brief Path to a folder where statistics report is stored
 DEFINE_string(report_folder, "", report_folder_message);
 
+/// @brief Format of the statistics report
+DEFINE_string(report_format, "csv", report_format_message);
+
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
@@ -166,6 +200,7 @@ static void showUsage() {
     std::cout << "    -h, --help                " << help_message << std::endl;
     std::cout << "    -i \"<path>\"               " << input_message << std::endl;
     std::cout << "    -m \"<path>\"               " << model_message << std::endl;
+    std::cout << "    -models \"<path>\"          " << models_message << std::endl;
     std::cout << "    -d \"<device>\"             " << target_device_message << std::endl;
     std::cout << "    -l \"<absolute_path>\"      " << custom_cpu_library_message << std::endl;
     std::cout << "          Or" << std::endl;
@@ -177,6 +212,8 @@ static void showUsage() {
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
+    std::cout << "    -rate \"<float>\"           " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival \"<type>\"         " << arrival_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -184,6 +221,7 @@ static void showUsage() {
     std::cout << std::endl << "  Statistics dumping options:" << std::endl;
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
+    std::cout << "    -report_format \"<format>\" " << report_format_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
 }
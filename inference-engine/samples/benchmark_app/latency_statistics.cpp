@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "latency_statistics.hpp"
+
+LatencyStatistics::LatencyStatistics(std::vector<double> latencies) : _sorted(std::move(latencies)) {
+    std::sort(_sorted.begin(), _sorted.end());
+}
+
+double LatencyStatistics::percentile(double p) const {
+    if (_sorted.empty())
+        return 0.0;
+    auto rank = static_cast<size_t>(std::ceil(p / 100.0 * _sorted.size()));
+    return _sorted[std::min(std::max(rank, static_cast<size_t>(1)), _sorted.size()) - 1];
+}
+
+StatisticsReport::Parameters LatencyStatistics::histogram() const {
+    StatisticsReport::Parameters buckets;
+    if (_sorted.empty())
+        return buckets;
+
+    // Fine buckets at the small latencies and coarse ones in the tail keep the histogram short for any spread
+    const double factor = std::sqrt(2.0);
+    double bound = 0.01;
+    while (bound * factor < _sorted.front())
+        bound *= factor;
+
+    auto begin = _sorted.begin();
+    while (begin != _sorted.end()) {
+        bound *= factor;
+        auto end = std::upper_bound(begin, _sorted.end(), bound);
+        std::stringstream name;
+        name << "<= " << std::setprecision(3) << bound << " ms";
+        buckets.push_back({name.str(), std::to_string(end - begin)});
+        begin = end;
+    }
+    return buckets;
+}
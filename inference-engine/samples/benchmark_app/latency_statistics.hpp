@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+
+#include "statistics_report.hpp"
+
+/// @brief Percentiles and histogram of the latencies collected during the benchmark, in milliseconds
+class LatencyStatistics {
+public:
+    explicit LatencyStatistics(std::vector<double> latencies);
+
+    bool empty() const {
+        return _sorted.empty();
+    }
+
+    /// @brief Nearest-rank percentile, p is in (0, 100]
+    double percentile(double p) const;
+
+    double max() const {
+        return _sorted.empty() ? 0.0 : _sorted.back();
+    }
+
+    /// @brief Counts of the latencies in geometric buckets, every bucket is sqrt(2) times wider than the previous one
+    StatisticsReport::Parameters histogram() const;
+
+private:
+    std::vector<double> _sorted;
+};
@@ -4,9 +4,12 @@
 
 #include <algorithm>
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <map>
+#include <random>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -22,6 +25,8 @@
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
 #include "inputs_filling.hpp"
+#include "latency_statistics.hpp"
+#include "multi_model.hpp"
 #include "utils.hpp"
 
 #ifdef __linux__
@@ -51,8 +56,12 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
-        throw std::logic_error("Model is required but not set. Please set -m option.");
+    if (FLAGS_m.empty() && FLAGS_models.empty()) {
+        throw std::logic_error("Model is required but not set. Please set -m or -models option.");
+    }
+
+    if (!FLAGS_m.empty() && !FLAGS_models.empty()) {
+        throw std::logic_error("Only one of -m and -models options can be set.");
     }
 
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
@@ -70,6 +79,19 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (FLAGS_report_format != csvReportFormat && FLAGS_report_format != jsonReportFormat) {
+        throw std::logic_error("only " + std::string(csvReportFormat) + "/" + std::string(jsonReportFormat) +
+                               " report formats are supported (invalid -report_format option value)");
+    }
+
+    if (FLAGS_rate < 0) {
+        throw std::logic_error("Incorrect arrival rate. Please set -rate option to a non-negative value.");
+    }
+
+    if (FLAGS_arrival != "poisson" && FLAGS_arrival != "constant") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `poisson` or `constant` value.");
+    }
+
     return true;
 }
 
@@ -136,7 +158,8 @@ int main(int argc, char *argv[]) {
                     command_line_arguments.push_back({ flag.name, flag.current_value });
                 }
             }
-            statistics = std::make_shared<StatisticsReport>(StatisticsReport::Config{FLAGS_report_type, FLAGS_report_folder});
+            statistics = std::make_shared<StatisticsReport>(StatisticsReport::Config{FLAGS_report_type, FLAGS_report_folder,
+                                                                                     FLAGS_report_format});
             statistics->addParameters(StatisticsReport::Category::COMMAND_LINE_PARAMETERS, command_line_arguments);
         }
 
@@ -175,6 +198,16 @@ int main(int argc, char *argv[]) {
         slog::info << "Device info: " << slog::endl;
         std::cout << ie.GetVersions(device_name) << std::endl;
 
+        if (!FLAGS_models.empty()) {
+            // Models share the Core, so they compete for the same cores, memory bandwidth and executors as in production
+            auto specs = parseModelSpecs(FLAGS_models);
+            uint32_t duration_seconds = FLAGS_t != 0 ? FLAGS_t : deviceDefaultDeviceDurationInSeconds(device_name);
+            runMultiModelBenchmark(ie, specs, duration_seconds, FLAGS_pin, statistics);
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
         // ----------------- 3. Setting device configuration -----------------------------------------------------------
         next_step();
 
@@ -353,9 +386,12 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        // Open-loop measurement starts requests at the arrival times, so the iterations are not aligned by requests
+        const bool openLoop = FLAGS_rate > 0;
+
         // Iteration limit
         uint32_t niter = FLAGS_niter;
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        if ((niter > 0) && (FLAGS_api == "async") && !openLoop) {
             niter = ((niter + nireq - 1)/nireq)*nireq;
             if (FLAGS_niter != niter) {
                 slog::warn << "Number of iterations was aligned by request number from "
@@ -386,6 +422,13 @@ int main(int argc, char *argv[]) {
                                             {"number of parallel infer requests", std::to_string(nireq)},
                                             {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                                       });
+            if (openLoop) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                                {"arrival rate (requests/s)", double_to_string(FLAGS_rate)},
+                                                {"arrival distribution", FLAGS_arrival},
+                                          });
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -426,6 +469,9 @@ int main(int argc, char *argv[]) {
                 ss << " using " << device_ss.str();
             }
         }
+        if (openLoop) {
+            ss << ", " << FLAGS_arrival << " arrivals at " << double_to_string(FLAGS_rate) << " requests/s";
+        }
         ss << ", limits: ";
         if (duration_seconds > 0) {
             ss << getDurationInMilliseconds(duration_seconds) << " ms duration";
@@ -458,20 +504,34 @@ int main(int argc, char *argv[]) {
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
+        // Arrivals of the open-loop measurement do not depend on the completions. A job which arrives when all the
+        // requests are busy waits for the first idle one, so its latency includes the queueing time.
+        std::mt19937 arrivalGenerator(42);
+        std::exponential_distribution<double> poissonInterval(openLoop ? FLAGS_rate : 1.0);
+        auto nextArrivalTime = startTime;
+
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            auto arrivalTime = Time::now();
+            if (openLoop) {
+                std::this_thread::sleep_until(nextArrivalTime);
+                arrivalTime = nextArrivalTime;
+                double interval = FLAGS_arrival == "poisson" ? poissonInterval(arrivalGenerator) : 1.0 / FLAGS_rate;
+                nextArrivalTime += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+            }
+
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 THROW_IE_EXCEPTION << "No idle Infer Requests!";
             }
 
             if (FLAGS_api == "sync") {
-                inferRequest->infer();
+                inferRequest->infer(arrivalTime);
             } else {
                 // As the inference request is currently idle, the wait() adds no additional overhead (and should return immediately).
                 // The primary reason for calling the method is exception checking/re-throwing.
@@ -479,7 +539,7 @@ int main(int argc, char *argv[]) {
                 // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
                 // So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                inferRequest->startAsync(arrivalTime);
             }
             iteration++;
 
@@ -501,10 +561,19 @@ int main(int argc, char *argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        // Latency of a job is the time from its arrival, which is the execution time in the closed-loop measurement
+        std::vector<double> executionTimes = inferRequestsQueue.getLatencies();
+        std::vector<double> queueTimes = inferRequestsQueue.getQueueTimes();
+        std::vector<double> latencies(executionTimes.size());
+        std::transform(executionTimes.begin(), executionTimes.end(), queueTimes.begin(), latencies.begin(), std::plus<double>());
+        LatencyStatistics latencyStatistics(latencies);
+        LatencyStatistics executionStatistics(executionTimes);
+        LatencyStatistics queueStatistics(queueTimes);
+
+        double latency = getMedianValue<double>(latencies);
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
-        double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
-                                             batchSize * 1000.0 * iteration / totalDuration;
+        double fps = (FLAGS_api == "sync" && !openLoop) ? batchSize * 1000.0 / latency :
+                                                          batchSize * 1000.0 * iteration / totalDuration;
 
         if (statistics) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
@@ -516,7 +585,22 @@ int main(int argc, char *argv[]) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                           {
                                             {"latency (ms)", double_to_string(latency)},
+                                            {"latency p50 (ms)", double_to_string(latencyStatistics.percentile(50))},
+                                            {"latency p90 (ms)", double_to_string(latencyStatistics.percentile(90))},
+                                            {"latency p99 (ms)", double_to_string(latencyStatistics.percentile(99))},
+                                            {"latency p99.9 (ms)", double_to_string(latencyStatistics.percentile(99.9))},
+                                            {"latency max (ms)", double_to_string(latencyStatistics.max())},
                                           });
+                if (openLoop) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                {"queueing time p50 (ms)", double_to_string(queueStatistics.percentile(50))},
+                                                {"queueing time p99 (ms)", double_to_string(queueStatistics.percentile(99))},
+                                                {"execution time p50 (ms)", double_to_string(executionStatistics.percentile(50))},
+                                                {"execution time p99 (ms)", double_to_string(executionStatistics.percentile(99))},
+                                              });
+                }
+                statistics->addParameters(StatisticsReport::Category::LATENCY_HISTOGRAM, latencyStatistics.histogram());
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
@@ -559,8 +643,19 @@ int main(int argc, char *argv[]) {
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::cout << "            p90 " << double_to_string(latencyStatistics.percentile(90))
+                      << " ms, p99 " << double_to_string(latencyStatistics.percentile(99))
+                      << " ms, p99.9 " << double_to_string(latencyStatistics.percentile(99.9))
+                      << " ms, max " << double_to_string(latencyStatistics.max()) << " ms" << std::endl;
+            if (openLoop) {
+                std::cout << "Queueing:   " << double_to_string(queueStatistics.percentile(50))
+                          << " ms, p99 " << double_to_string(queueStatistics.percentile(99)) << " ms" << std::endl;
+                std::cout << "Execution:  " << double_to_string(executionStatistics.percentile(50))
+                          << " ms, p99 " << double_to_string(executionStatistics.percentile(99)) << " ms" << std::endl;
+            }
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
@@ -0,0 +1,330 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <samples/slog.hpp>
+
+#include "multi_model.hpp"
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "latency_statistics.hpp"
+
+#ifdef __linux__
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+using namespace InferenceEngine;
+
+namespace {
+
+struct ModelRun {
+    ModelSpec spec;
+    std::string name;
+    size_t batchSize = 0;
+    uint32_t nireq = 0;
+    std::string nstreams;
+    ExecutableNetwork network;
+    std::unique_ptr<InferRequestsQueue> queue;
+    size_t iterations = 0;
+    double duration = 0.0;
+    std::exception_ptr error;
+};
+
+std::string toString(double number) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << number;
+    return ss.str();
+}
+
+void loadModel(Core &ie, ModelRun &run, const std::string &pin) {
+    const ModelSpec &spec = run.spec;
+    CNNNetwork network = ie.ReadNetwork(spec.path);
+    if (spec.batch != 0)
+        network.setBatchSize(spec.batch);
+    run.name = network.getName();
+    run.batchSize = network.getBatchSize();
+
+    for (auto& item : network.getInputsInfo()) {
+        if (isImage(item.second))
+            item.second->setPrecision(Precision::U8);
+    }
+
+    // Settings are passed with the network, so every model has its own streams on the same device
+    std::map<std::string, std::string> config = {{ CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(NO) }};
+    if (spec.device == "CPU") {
+        config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = spec.nstreams.empty() ? "CPU_THROUGHPUT_AUTO" : spec.nstreams;
+        config[CONFIG_KEY(CPU_BIND_THREAD)] = pin;
+        config[CONFIG_KEY(CPU_PRIORITY)] = std::to_string(spec.priority);
+    } else if (spec.device == "GPU") {
+        config[CONFIG_KEY(GPU_THROUGHPUT_STREAMS)] = spec.nstreams.empty() ? "GPU_THROUGHPUT_AUTO" : spec.nstreams;
+    } else if (!spec.nstreams.empty()) {
+        slog::warn << "Number of streams is ignored for " << spec.path << " on " << spec.device << slog::endl;
+    }
+    if (spec.priority != 0 && spec.device != "CPU")
+        slog::warn << "Priority is ignored for " << spec.path << " on " << spec.device << slog::endl;
+    run.network = ie.LoadNetwork(network, spec.device, config);
+
+    run.nireq = spec.nireq;
+    if (run.nireq == 0)
+        run.nireq = run.network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+
+    run.nstreams = spec.nstreams.empty() ? "auto" : spec.nstreams;
+    try {
+        if (spec.device == "CPU")
+            run.nstreams = run.network.GetConfig(CONFIG_KEY(CPU_THROUGHPUT_STREAMS)).as<std::string>();
+        else if (spec.device == "GPU")
+            run.nstreams = run.network.GetConfig(CONFIG_KEY(GPU_THROUGHPUT_STREAMS)).as<std::string>();
+    } catch (const std::exception&) {
+    }
+
+    run.queue = std::unique_ptr<InferRequestsQueue>(new InferRequestsQueue(run.network, run.nireq));
+    fillBlobs({}, run.batchSize, run.network.GetInputsInfo(), run.queue->requests);
+}
+
+void runModel(ModelRun &run, size_t index, Time::time_point startTime, Time::time_point endTime) {
+    try {
+        const bool openLoop = run.spec.rate > 0;
+        std::mt19937 arrivalGenerator(static_cast<unsigned>(42 + index));
+        std::exponential_distribution<double> poissonInterval(openLoop ? run.spec.rate : 1.0);
+        auto nextArrivalTime = startTime;
+
+        while (Time::now() < endTime) {
+            auto arrivalTime = Time::now();
+            if (openLoop) {
+                if (nextArrivalTime >= endTime)
+                    break;
+                std::this_thread::sleep_until(nextArrivalTime);
+                arrivalTime = nextArrivalTime;
+                double interval = run.spec.arrival == "poisson" ? poissonInterval(arrivalGenerator) : 1.0 / run.spec.rate;
+                nextArrivalTime += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+            }
+
+            auto inferRequest = run.queue->getIdleRequest();
+            inferRequest->wait();
+            inferRequest->startAsync(arrivalTime);
+            run.iterations++;
+        }
+        run.queue->waitAll();
+        run.duration = run.queue->getDurationInMilliseconds();
+    } catch (...) {
+        run.error = std::current_exception();
+    }
+}
+
+#ifdef __linux__
+struct CpuTimes {
+    unsigned long long busy = 0;
+    unsigned long long total = 0;
+};
+
+// Aggregate line of /proc/stat: user, nice, system, idle, iowait, irq, softirq and steal times
+CpuTimes readSystemCpuTimes() {
+    CpuTimes times;
+    std::ifstream stat("/proc/stat");
+    std::string cpu;
+    stat >> cpu;
+    unsigned long long value = 0;
+    for (int i = 0; i < 8 && stat >> value; i++) {
+        times.total += value;
+        if (i != 3 && i != 4)
+            times.busy += value;
+    }
+    return times;
+}
+
+double readProcessCpuSeconds() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1e-6;
+}
+#endif
+
+}  // namespace
+
+std::vector<ModelSpec> parseModelSpecs(const std::string &fileName) {
+    std::ifstream file(fileName);
+    if (!file.is_open())
+        throw std::logic_error("Cannot open models file " + fileName);
+
+    std::vector<ModelSpec> specs;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        ModelSpec spec;
+        if (!(fields >> spec.path) || spec.path[0] == '#')
+            continue;
+
+        std::string field;
+        while (fields >> field) {
+            auto separator = field.find('=');
+            if (separator == std::string::npos)
+                throw std::logic_error("Incorrect model option " + field + " in line: " + line);
+            std::string key = field.substr(0, separator);
+            std::string value = field.substr(separator + 1);
+            try {
+                if (key == "d") {
+                    spec.device = value;
+                } else if (key == "nstreams") {
+                    spec.nstreams = std::to_string(std::stoul(value));
+                } else if (key == "nireq") {
+                    spec.nireq = static_cast<uint32_t>(std::stoul(value));
+                } else if (key == "b") {
+                    spec.batch = static_cast<uint32_t>(std::stoul(value));
+                } else if (key == "rate") {
+                    spec.rate = std::stod(value);
+                } else if (key == "arrival" && (value == "poisson" || value == "constant")) {
+                    spec.arrival = value;
+                } else if (key == "priority") {
+                    spec.priority = std::stoi(value);
+                } else {
+                    throw std::logic_error(key);
+                }
+            } catch (const std::exception&) {
+                throw std::logic_error("Incorrect model option " + field + " in line: " + line);
+            }
+        }
+        if (spec.rate < 0)
+            throw std::logic_error("Incorrect arrival rate in line: " + line);
+        specs.push_back(spec);
+    }
+    if (specs.empty())
+        throw std::logic_error("No models are specified in " + fileName);
+    return specs;
+}
+
+void runMultiModelBenchmark(Core &ie, const std::vector<ModelSpec> &specs, uint32_t durationSeconds,
+                            const std::string &pin, const std::shared_ptr<StatisticsReport> &statistics) {
+    std::vector<ModelRun> runs(specs.size());
+    for (size_t i = 0; i < specs.size(); i++) {
+        runs[i].spec = specs[i];
+        auto startTime = Time::now();
+        loadModel(ie, runs[i], pin);
+        slog::info << "Loaded " << specs[i].path << " to " << specs[i].device << " in "
+                   << toString(std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001) << " ms: "
+                   << runs[i].nstreams << " streams, " << runs[i].nireq << " infer requests"
+                   << (specs[i].rate > 0 ? ", " + toString(specs[i].rate) + " requests/s" : "")
+                   << (specs[i].priority != 0 ? ", priority " + std::to_string(specs[i].priority) : "") << slog::endl;
+    }
+
+    // warming up - out of scope
+    for (auto &run : runs) {
+        run.queue->getIdleRequest()->startAsync();
+        run.queue->waitAll();
+        run.queue->resetTimes();
+    }
+
+    slog::info << "Running " << runs.size() << " models concurrently for " << durationSeconds << " s" << slog::endl;
+#ifdef __linux__
+    CpuTimes systemStart = readSystemCpuTimes();
+    double processStart = readProcessCpuSeconds();
+#endif
+    auto startTime = Time::now();
+    auto endTime = startTime + std::chrono::seconds(durationSeconds);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < runs.size(); i++)
+        threads.emplace_back(runModel, std::ref(runs[i]), i, startTime, endTime);
+    for (auto &thread : threads)
+        thread.join();
+    double wallSeconds = std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 1e-9;
+
+    for (auto &run : runs) {
+        if (run.error)
+            std::rethrow_exception(run.error);
+    }
+
+    double totalFps = 0.0;
+    for (size_t i = 0; i < runs.size(); i++) {
+        auto &run = runs[i];
+        std::vector<double> executionTimes = run.queue->getLatencies();
+        std::vector<double> queueTimes = run.queue->getQueueTimes();
+        std::vector<double> latencies(executionTimes.size());
+        std::transform(executionTimes.begin(), executionTimes.end(), queueTimes.begin(), latencies.begin(), std::plus<double>());
+        LatencyStatistics latencyStatistics(latencies);
+        LatencyStatistics queueStatistics(queueTimes);
+        double fps = run.duration > 0 ? run.batchSize * 1000.0 * run.iterations / run.duration : 0.0;
+        totalFps += fps;
+
+        std::cout << "Model " << i << ": " << run.name << " (" << run.spec.path << ") on " << run.spec.device << std::endl;
+        std::cout << "    Count:      " << run.iterations << " iterations" << std::endl;
+        std::cout << "    Throughput: " << toString(fps) << " FPS" << std::endl;
+        std::cout << "    Latency:    p50 " << toString(latencyStatistics.percentile(50))
+                  << " ms, p90 " << toString(latencyStatistics.percentile(90))
+                  << " ms, p99 " << toString(latencyStatistics.percentile(99))
+                  << " ms, p99.9 " << toString(latencyStatistics.percentile(99.9))
+                  << " ms, max " << toString(latencyStatistics.max()) << " ms" << std::endl;
+        if (run.spec.rate > 0) {
+            std::cout << "    Queueing:   p50 " << toString(queueStatistics.percentile(50))
+                      << " ms, p99 " << toString(queueStatistics.percentile(99)) << " ms" << std::endl;
+        }
+
+        if (statistics) {
+            std::string prefix = "model " + std::to_string(i) + " ";
+            statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                      {
+                                            {prefix + "path", run.spec.path},
+                                            {prefix + "target device", run.spec.device},
+                                            {prefix + "batch size", std::to_string(run.batchSize)},
+                                            {prefix + "number of streams", run.nstreams},
+                                            {prefix + "number of parallel infer requests", std::to_string(run.nireq)},
+                                            {prefix + "arrival rate (requests/s)", toString(run.spec.rate)},
+                                            {prefix + "priority", std::to_string(run.spec.priority)},
+                                      });
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                            {prefix + "total number of iterations", std::to_string(run.iterations)},
+                                            {prefix + "throughput", toString(fps)},
+                                            {prefix + "latency p50 (ms)", toString(latencyStatistics.percentile(50))},
+                                            {prefix + "latency p90 (ms)", toString(latencyStatistics.percentile(90))},
+                                            {prefix + "latency p99 (ms)", toString(latencyStatistics.percentile(99))},
+                                            {prefix + "latency p99.9 (ms)", toString(latencyStatistics.percentile(99.9))},
+                                            {prefix + "latency max (ms)", toString(latencyStatistics.max())},
+                                            {prefix + "queueing time p99 (ms)", toString(queueStatistics.percentile(99))},
+                                      });
+        }
+    }
+
+    std::cout << "Total throughput: " << toString(totalFps) << " FPS" << std::endl;
+    if (statistics) {
+        statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                  {
+                                        {"total throughput", toString(totalFps)},
+                                  });
+    }
+
+#ifdef __linux__
+    CpuTimes systemEnd = readSystemCpuTimes();
+    double processCpuSeconds = readProcessCpuSeconds() - processStart;
+    double systemUtilization = systemEnd.total > systemStart.total ?
+            100.0 * (systemEnd.busy - systemStart.busy) / (systemEnd.total - systemStart.total) : 0.0;
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    double processUtilization = 100.0 * processCpuSeconds / (wallSeconds * cores);
+
+    std::cout << "CPU utilization: " << toString(systemUtilization) << "% of the system, "
+              << toString(processUtilization) << "% by the benchmark (" << cores << " logical cores)" << std::endl;
+    if (statistics) {
+        statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                  {
+                                        {"system CPU utilization (%)", toString(systemUtilization)},
+                                        {"benchmark CPU utilization (%)", toString(processUtilization)},
+                                  });
+    }
+#else
+    (void)wallSeconds;
+#endif
+}
@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include "statistics_report.hpp"
+
+/// @brief Model of the multi-model measurement with its own device settings and load
+struct ModelSpec {
+    std::string path;
+    std::string device = "CPU";
+    std::string nstreams;       // empty means the device default
+    uint32_t nireq = 0;         // 0 means the optimal number for the device
+    uint32_t batch = 0;         // 0 means the batch of the model
+    double rate = 0.0;          // 0 means closed-loop measurement
+    std::string arrival = "poisson";
+    int priority = 0;           // CPU_PRIORITY of the network, higher values preempt lower ones
+};
+
+/// @brief Parses the file with one model per line:
+/// "<path> [d=<device>] [nstreams=<n>] [nireq=<n>] [b=<n>] [rate=<r>] [arrival=poisson|constant] [priority=<n>]".
+/// Empty lines and lines starting with '#' are skipped.
+std::vector<ModelSpec> parseModelSpecs(const std::string &fileName);
+
+/// @brief Loads all the models into one Core, runs them concurrently for the given duration and reports per-model
+/// throughput and latency percentiles together with the CPU utilization of the whole run
+void runMultiModelBenchmark(InferenceEngine::Core &ie, const std::vector<ModelSpec> &specs, uint32_t durationSeconds,
+                            const std::string &pin, const std::shared_ptr<StatisticsReport> &statistics);
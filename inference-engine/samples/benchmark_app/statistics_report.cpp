@@ -7,9 +7,38 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <stdexcept>
 
 #include "statistics_report.hpp"
 
+namespace {
+
+const std::vector<std::pair<StatisticsReport::Category, std::string>> categoryTitles = {
+    {StatisticsReport::Category::COMMAND_LINE_PARAMETERS, "Command line parameters"},
+    {StatisticsReport::Category::RUNTIME_CONFIG, "Configuration setup"},
+    {StatisticsReport::Category::EXECUTION_RESULTS, "Execution results"},
+    {StatisticsReport::Category::LATENCY_HISTOGRAM, "Latency histogram"},
+};
+
+std::string toJsonString(const std::string &value) {
+    std::string result = "\"";
+    for (char c : value) {
+        switch (c) {
+            case '"':  result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\n': result += "\\n"; break;
+            case '\t': result += "\\t"; break;
+            case '\r': result += "\\r"; break;
+            default:   result += c;
+        }
+    }
+    return result + "\"";
+}
+
+}  // namespace
+
 void StatisticsReport::addParameters(const Category &category, const Parameters& parameters) {
     if (_parameters.count(category) == 0)
         _parameters[category] = parameters;
@@ -18,6 +47,11 @@ void StatisticsReport::addParameters(const Category &category, const Parameters&
 }
 
 void StatisticsReport::dump() {
+    if (_config.report_format == jsonReportFormat) {
+        dumpJson();
+        return;
+    }
+
     CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_report.csv");
 
     auto dump_parameters = [ &dumper ] (const Parameters &parameters) {
@@ -26,31 +60,50 @@ void StatisticsReport::dump() {
             dumper.endLine();
         }
     };
-    if (_parameters.count(Category::COMMAND_LINE_PARAMETERS)) {
-        dumper << "Command line parameters";
-        dumper.endLine();
+    for (auto& category : categoryTitles) {
+        if (_parameters.count(category.first)) {
+            dumper << category.second;
+            dumper.endLine();
 
-        dump_parameters(_parameters.at(Category::COMMAND_LINE_PARAMETERS));
-        dumper.endLine();
+            dump_parameters(_parameters.at(category.first));
+            dumper.endLine();
+        }
     }
 
-    if (_parameters.count(Category::RUNTIME_CONFIG)) {
-        dumper << "Configuration setup";
-        dumper.endLine();
+    slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
+}
 
-        dump_parameters(_parameters.at(Category::RUNTIME_CONFIG));
-        dumper.endLine();
+void StatisticsReport::dumpJson() {
+    std::string filename = _config.report_folder + _separator + "benchmark_report.json";
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot write statistics report to " + filename);
     }
 
-    if (_parameters.count(Category::EXECUTION_RESULTS)) {
-        dumper << "Execution results";
-        dumper.endLine();
-
-        dump_parameters(_parameters.at(Category::EXECUTION_RESULTS));
-        dumper.endLine();
+    // Sections are named by the CSV titles in snake case, e.g. "execution_results"
+    file << "{";
+    bool firstCategory = true;
+    for (auto& category : categoryTitles) {
+        if (!_parameters.count(category.first))
+            continue;
+        std::string name = category.second;
+        std::transform(name.begin(), name.end(), name.begin(), [](char c) {
+            return c == ' ' ? '_' : static_cast<char>(std::tolower(c));
+        });
+
+        file << (firstCategory ? "" : ",") << "\n    " << toJsonString(name) << ": {";
+        bool firstParameter = true;
+        for (auto& parameter : _parameters.at(category.first)) {
+            file << (firstParameter ? "" : ",") << "\n        "
+                 << toJsonString(parameter.first) << ": " << toJsonString(parameter.second);
+            firstParameter = false;
+        }
+        file << "\n    }";
+        firstCategory = false;
     }
+    file << "\n}\n";
 
-    slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
+    slog::info << "Statistics report is stored to " << filename << slog::endl;
 }
 
 void StatisticsReport::dumpPerformanceCountersRequest(CsvDumper& dumper,
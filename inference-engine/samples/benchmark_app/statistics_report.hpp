@@ -19,7 +19,11 @@ static constexpr char noCntReport[] = "no_counters";
 static constexpr char averageCntReport[] = "average_counters";
 static constexpr char detailedCntReport[] = "detailed_counters";
 
-/// @brief Responsible for collecting of statistics and dumping to .csv file
+// @brief statistics reports formats
+static constexpr char csvReportFormat[] = "csv";
+static constexpr char jsonReportFormat[] = "json";
+
+/// @brief Responsible for collecting of statistics and dumping to .csv or .json file
 class StatisticsReport {
 public:
     typedef std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> PerformaceCounters;
@@ -28,12 +32,14 @@ public:
     struct Config {
         std::string report_type;
         std::string report_folder;
+        std::string report_format;
     };
 
     enum class Category {
         COMMAND_LINE_PARAMETERS,
         RUNTIME_CONFIG,
         EXECUTION_RESULTS,
+        LATENCY_HISTOGRAM,
     };
 
     explicit StatisticsReport(Config config) : _config(std::move(config)) {
@@ -58,6 +64,8 @@ public:
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
 
 private:
+    void dumpJson();
+
     void dumpPerformanceCountersRequest(CsvDumper& dumper,
                                         const PerformaceCounters& perfCounts);
 
@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include "batch_async_infer_request.hpp"
+#include "batch_executable_network.hpp"
+
+using namespace BatchPlugin;
+using namespace InferenceEngine;
+
+BatchAsyncInferRequest::BatchAsyncInferRequest(const BatchInferRequest::Ptr&    request,
+                                               BatchExecutableNetwork*          network,
+                                               const ITaskExecutor::Ptr&        callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(request, nullptr, callbackExecutor),
+    _batchInferRequest(request),
+    _network(network) {
+    // The stage is started when the batch with the request or the request alone is inferred
+    struct BatchExecutor : ITaskExecutor {
+        BatchExecutor(BatchExecutableNetwork* network, BatchInferRequest* request) :
+            _network{network}, _request{request} {}
+        void run(Task task) override {
+            _request->_task = std::move(task);
+            _network->Enqueue(_request);
+        }
+        BatchExecutableNetwork* _network = nullptr;
+        BatchInferRequest*      _request = nullptr;
+    };
+
+    _pipeline = {
+        {std::make_shared<BatchExecutor>(network, _batchInferRequest.get()), [this] {
+            if (StatusCode::OK != _batchInferRequest->_status) {
+                THROW_IE_EXCEPTION << InferenceEngine::details::as_status << _batchInferRequest->_status;
+            }
+            _batchInferRequest->CompleteOutputs();
+        }}
+    };
+}
+
+void BatchAsyncInferRequest::StartAsync_ThreadUnsafe() {
+    _batchInferRequest->checkBlobs();
+    _batchInferRequest->PrepareInputs();
+    RunFirstStage();
+}
+
+BatchAsyncInferRequest::~BatchAsyncInferRequest() {
+    StopAndWait();
+    _network->ReleaseSlot(_batchInferRequest->_worker, _batchInferRequest->_slot);
+}
@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
+#include "batch_infer_request.hpp"
+
+namespace BatchPlugin {
+
+class BatchExecutableNetwork;
+
+class BatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<BatchAsyncInferRequest>;
+    BatchAsyncInferRequest(const BatchInferRequest::Ptr&                request,
+                           BatchExecutableNetwork*                      network,
+                           const InferenceEngine::ITaskExecutor::Ptr&   callbackExecutor);
+    ~BatchAsyncInferRequest() override;
+    void StartAsync_ThreadUnsafe() override;
+
+private:
+    BatchInferRequest::Ptr  _batchInferRequest;
+    BatchExecutableNetwork* _network = nullptr;
+};
+
+}  // namespace BatchPlugin
@@ -0,0 +1,280 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ie_metric_helpers.hpp"
+#include "batch/batch_plugin_config.hpp"
+#include "batch_executable_network.hpp"
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::BatchConfigParams;
+using namespace BatchPlugin;
+
+namespace {
+
+void completeRequests(const std::vector<BatchInferRequest*>& requests, StatusCode status) {
+    for (auto&& request : requests) {
+        if (nullptr != request) {
+            request->_status = status;
+            auto task = std::move(request->_task);
+            task();
+        }
+    }
+}
+
+StatusCode exceptionStatus() {
+    try {
+        throw;
+    } catch (const details::InferenceEngineException& ex) {
+        return ex.hasStatus() ? ex.getStatus() : StatusCode::GENERAL_ERROR;
+    } catch (...) {
+        return StatusCode::GENERAL_ERROR;
+    }
+}
+
+}  // namespace
+
+BatchExecutableNetwork::BatchExecutableNetwork(const ExecutableNetwork&                    batchedNetwork,
+                                               const ExecutableNetwork&                    network,
+                                               const std::map<std::string, std::string>&   config,
+                                               size_t                                      batchSize,
+                                               std::chrono::microseconds                   timeout,
+                                               bool                                        dynamicBatch) :
+    _batchedNetwork{batchedNetwork},
+    _network{network},
+    _config{config},
+    _batchSize{batchSize},
+    _timeout{timeout},
+    _dynamicBatch{dynamicBatch} {
+    _timeoutThread = std::thread([this] { TimeoutLoop(); });
+}
+
+BatchExecutableNetwork::~BatchExecutableNetwork() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _timeoutCondVar.notify_all();
+    _timeoutThread.join();
+}
+
+BatchWorker::Ptr BatchExecutableNetwork::CreateWorker() {
+    auto worker = std::make_shared<BatchWorker>();
+    worker->_request = _batchedNetwork.CreateInferRequestPtr();
+    for (auto&& input : _batchedNetwork.GetInputsInfo()) {
+        worker->_blobs[input.first] = worker->_request->GetBlob(input.first);
+    }
+    for (auto&& output : _batchedNetwork.GetOutputsInfo()) {
+        worker->_blobs[output.first] = worker->_request->GetBlob(output.first);
+    }
+    worker->_pending.assign(_batchSize, nullptr);
+    worker->_slotsUsed.assign(_batchSize, false);
+
+    // The worker owns the request, so the callback does not extend the lifetime of the worker
+    auto workerPtr = worker.get();
+    worker->_request->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+        [workerPtr] (InferRequest, StatusCode status) {
+            // The requests can be started again by their callbacks, so the running list is released first
+            std::vector<BatchInferRequest*> requests;
+            {
+                std::lock_guard<std::mutex> lock(workerPtr->_runningMutex);
+                std::swap(requests, workerPtr->_running);
+            }
+            completeRequests(requests, status);
+        });
+    return worker;
+}
+
+InferRequestInternal::Ptr BatchExecutableNetwork::CreateInferRequestImpl(InputsDataMap  networkInputs,
+                                                                         OutputsDataMap networkOutputs) {
+    BatchWorker::Ptr worker;
+    size_t slot = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto&& candidate : _workers) {
+            auto itSlot = std::find(candidate->_slotsUsed.begin(), candidate->_slotsUsed.end(), false);
+            if (itSlot != candidate->_slotsUsed.end()) {
+                worker = candidate;
+                slot = std::distance(candidate->_slotsUsed.begin(), itSlot);
+                break;
+            }
+        }
+        if (nullptr == worker) {
+            worker = CreateWorker();
+            _workers.push_back(worker);
+        }
+        worker->_slotsUsed[slot] = true;
+    }
+
+    try {
+        return std::make_shared<BatchInferRequest>(networkInputs, networkOutputs, worker, slot,
+                                                   _network.CreateInferRequestPtr());
+    } catch (...) {
+        ReleaseSlot(worker, slot);
+        throw;
+    }
+}
+
+void BatchExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
+    auto batchInferRequest = std::dynamic_pointer_cast<BatchInferRequest>(
+            CreateInferRequestImpl(_networkInputs, _networkOutputs));
+    batchInferRequest->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncTreadSafeImpl = std::make_shared<BatchAsyncInferRequest>(batchInferRequest, this, _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<BatchAsyncInferRequest>(asyncTreadSafeImpl),
+                       [](IInferRequest *p) { p->Release(); });
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+}
+
+void BatchExecutableNetwork::ReleaseSlot(const BatchWorker::Ptr& worker, size_t slot) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    worker->_slotsUsed[slot] = false;
+}
+
+std::vector<BatchInferRequest*> BatchExecutableNetwork::TakePending(BatchWorker& worker) {
+    std::vector<BatchInferRequest*> requests(_batchSize, nullptr);
+    std::swap(requests, worker._pending);
+    worker._pendingNum = 0;
+    return requests;
+}
+
+void BatchExecutableNetwork::Enqueue(BatchInferRequest* request) {
+    auto& worker = *request->_worker;
+    std::vector<BatchInferRequest*> requests;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (0 == worker._pendingNum) {
+            worker._firstStartTime = std::chrono::steady_clock::now();
+            _timeoutCondVar.notify_one();
+        }
+        worker._pending[request->_slot] = request;
+        if (++worker._pendingNum < _batchSize) {
+            return;
+        }
+        requests = TakePending(worker);
+    }
+    RunBatch(worker, std::move(requests), _batchSize);
+}
+
+void BatchExecutableNetwork::RunBatch(BatchWorker& worker, std::vector<BatchInferRequest*> requests, size_t batch) {
+    // The batched request is idle here: every its inference contains the first slot, which is started again
+    // only after the completion of the previous inference
+    for (auto&& request : requests) {
+        if (nullptr != request) {
+            request->_inferredAlone = false;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(worker._runningMutex);
+        worker._running = std::move(requests);
+    }
+    try {
+        if (_dynamicBatch) {
+            worker._request->SetBatch(static_cast<int>(batch));
+        }
+        worker._request->StartAsync();
+    } catch (...) {
+        auto status = exceptionStatus();
+        std::vector<BatchInferRequest*> failed;
+        {
+            std::lock_guard<std::mutex> lock(worker._runningMutex);
+            std::swap(failed, worker._running);
+        }
+        completeRequests(failed, status);
+    }
+}
+
+void BatchExecutableNetwork::RunExpired(BatchWorker& worker, std::vector<BatchInferRequest*> requests) {
+    auto startedNum = static_cast<size_t>(std::count_if(requests.begin(), requests.end(),
+                                                        [] (BatchInferRequest* request) { return nullptr != request; }));
+    // The dynamic batch infers only the first slots, the others may be still read or written by their users
+    if (_dynamicBatch &&
+        std::all_of(requests.begin(), requests.begin() + startedNum,
+                    [] (BatchInferRequest* request) { return nullptr != request; })) {
+        RunBatch(worker, std::move(requests), startedNum);
+        return;
+    }
+
+    for (auto&& request : requests) {
+        if (nullptr != request) {
+            request->_inferredAlone = true;
+            try {
+                request->_request->StartAsync();
+            } catch (...) {
+                completeRequests({request}, exceptionStatus());
+            }
+        }
+    }
+}
+
+void BatchExecutableNetwork::TimeoutLoop() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_stop) {
+        auto now = std::chrono::steady_clock::now();
+        auto deadline = std::chrono::steady_clock::time_point::max();
+        std::vector<std::pair<BatchWorker*, std::vector<BatchInferRequest*>>> expired;
+        for (auto&& worker : _workers) {
+            if (0 == worker->_pendingNum) {
+                continue;
+            }
+            auto workerDeadline = worker->_firstStartTime + _timeout;
+            if (workerDeadline <= now) {
+                expired.emplace_back(worker.get(), TakePending(*worker));
+            } else {
+                deadline = std::min(deadline, workerDeadline);
+            }
+        }
+
+        if (!expired.empty()) {
+            lock.unlock();
+            for (auto&& batch : expired) {
+                RunExpired(*batch.first, std::move(batch.second));
+            }
+            lock.lock();
+        } else if (deadline == std::chrono::steady_clock::time_point::max()) {
+            _timeoutCondVar.wait(lock);
+        } else {
+            _timeoutCondVar.wait_until(lock, deadline);
+        }
+    }
+}
+
+void BatchExecutableNetwork::GetConfig(const std::string &name, Parameter &result, ResponseDesc *) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        result = it->second;
+    } else {
+        result = _batchedNetwork.GetConfig(name);
+    }
+}
+
+void BatchExecutableNetwork::GetMetric(const std::string &name, Parameter &result, ResponseDesc *) const {
+    if (METRIC_KEY(SUPPORTED_METRICS) == name) {
+        result = IE_SET_METRIC(SUPPORTED_METRICS, std::vector<std::string>{
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)});
+    } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
+        result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
+            BATCH_CONFIG_KEY(DEVICE),
+            BATCH_CONFIG_KEY(SIZE),
+            BATCH_CONFIG_KEY(TIMEOUT)});
+    } else if (METRIC_KEY(NETWORK_NAME) == name) {
+        result = _network.GetMetric(METRIC_KEY(NETWORK_NAME));
+    } else if (METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
+        // Every request of the batched network needs the whole batch of user requests to be filled
+        unsigned int value = _batchedNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(value * _batchSize));
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
+    }
+}
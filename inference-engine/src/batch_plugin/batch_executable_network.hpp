@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for ExecutableNetwork of the batching plugin
+ * @file batch_executable_network.hpp
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ie_common.h>
+#include <cpp/ie_executable_network.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+
+#include "batch_infer_request.hpp"
+#include "batch_async_infer_request.hpp"
+
+namespace BatchPlugin {
+
+/**
+ * @class BatchExecutableNetwork
+ * @brief Coalesces the requests started by users into inferences of the network loaded with a larger batch.
+ *        Every user request is bound to a slot of a request of the batched network and its blobs are views
+ *        of the memory of the slot. The batch is inferred when all its slots are started. The requests which
+ *        wait longer than the timeout are inferred by the not batched network or, if dynamic batching is enabled
+ *        and they are the first slots of the batch, by the batched request with a smaller batch.
+ */
+class BatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    typedef std::shared_ptr<BatchExecutableNetwork> Ptr;
+
+    BatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&    batchedNetwork,
+                           const InferenceEngine::ExecutableNetwork&    network,
+                           const std::map<std::string, std::string>&    config,
+                           size_t                                       batchSize,
+                           std::chrono::microseconds                    timeout,
+                           bool                                         dynamicBatch);
+
+    ~BatchExecutableNetwork() override;
+
+    InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                      InferenceEngine::OutputsDataMap networkOutputs) override;
+
+    void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
+
+    void GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
+
+    void GetMetric(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
+
+    /**
+     * @brief Puts the started request to the batch of its worker and infers the batch if all its slots are started
+     */
+    void Enqueue(BatchInferRequest* request);
+
+    /**
+     * @brief Makes the slot of the destroyed request available for new requests
+     */
+    void ReleaseSlot(const BatchWorker::Ptr& worker, size_t slot);
+
+private:
+    BatchWorker::Ptr CreateWorker();
+
+    std::vector<BatchInferRequest*> TakePending(BatchWorker& worker);
+
+    void RunBatch(BatchWorker& worker, std::vector<BatchInferRequest*> requests, size_t batch);
+
+    void RunExpired(BatchWorker& worker, std::vector<BatchInferRequest*> requests);
+
+    void TimeoutLoop();
+
+    InferenceEngine::ExecutableNetwork  _batchedNetwork;
+    InferenceEngine::ExecutableNetwork  _network;
+    std::map<std::string, std::string>  _config;
+    size_t                              _batchSize;
+    std::chrono::microseconds           _timeout;
+    bool                                _dynamicBatch;
+
+    std::mutex                          _mutex;
+    std::condition_variable             _timeoutCondVar;
+    bool                                _stop = false;
+    std::vector<BatchWorker::Ptr>       _workers;
+    std::thread                         _timeoutThread;
+};
+
+}  // namespace BatchPlugin
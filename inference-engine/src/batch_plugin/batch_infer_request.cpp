@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "batch_infer_request.hpp"
+#include <ie_blob.h>
+#include <blob_factory.hpp>
+#include <blob_transform.hpp>
+#include <cstring>
+#include <map>
+#include <string>
+
+using namespace BatchPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+void copyBlob(const Blob::Ptr& src, const Blob::Ptr& dst) {
+    auto srcMemoryBlob = as<MemoryBlob>(src);
+    auto dstMemoryBlob = as<MemoryBlob>(dst);
+    // Dense blobs with the same layout are copied as is, others are converted by the common transformation
+    if (srcMemoryBlob != nullptr && dstMemoryBlob != nullptr &&
+        src->getTensorDesc() == dst->getTensorDesc() &&
+        0 == src->getTensorDesc().getBlockingDesc().getOffsetPadding()) {
+        auto srcMemory = srcMemoryBlob->rmap();
+        auto dstMemory = dstMemoryBlob->wmap();
+        std::memcpy(dstMemory.as<void*>(), srcMemory.as<const void*>(), src->byteSize());
+    } else {
+        blob_copy(src, dst);
+    }
+}
+
+}  // namespace
+
+BatchInferRequest::BatchInferRequest(InputsDataMap              networkInputs,
+                                     OutputsDataMap             networkOutputs,
+                                     const BatchWorker::Ptr&    worker,
+                                     size_t                     slot,
+                                     const InferRequest::Ptr&   request) :
+        InferRequestInternal(networkInputs, networkOutputs),
+        _worker(worker),
+        _slot(slot),
+        _request(request) {
+    // User requests get the memory of their slots, so the batched request reads and writes it without copies
+    auto makeSlotBlob = [&](const std::string& name, const TensorDesc& desc) {
+        auto batchedBlob = as<MemoryBlob>(_worker->_blobs.at(name));
+        if (batchedBlob == nullptr) {
+            THROW_IE_EXCEPTION << "Blob " << name << " of the batched request is not a memory blob";
+        }
+        auto slotSize = batchedBlob->byteSize() / _worker->_slotsUsed.size();
+        auto memory = batchedBlob->rwmap().as<uint8_t*>() + _slot * slotSize;
+        auto blob = make_blob_with_precision(desc, memory);
+        _slotBlobs[name] = blob;
+        _request->SetBlob(name.c_str(), blob);
+        return blob;
+    };
+    for (auto&& input : _networkInputs) {
+        _inputs[input.first] = makeSlotBlob(input.first, input.second->getTensorDesc());
+    }
+    for (auto&& output : _networkOutputs) {
+        _outputs[output.first] = makeSlotBlob(output.first, output.second->getTensorDesc());
+    }
+
+    _request->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+        [this] (InferRequest, StatusCode status) {
+            _status = status;
+            auto task = std::move(_task);
+            task();
+        });
+}
+
+void BatchInferRequest::InferImpl() {
+    _inferredAlone = true;
+    PrepareInputs();
+    _request->Infer();
+    CompleteOutputs();
+}
+
+void BatchInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    perfMap = _inferredAlone ? _request->GetPerformanceCounts() : _worker->_request->GetPerformanceCounts();
+}
+
+void BatchInferRequest::PrepareInputs() {
+    execDataPreprocessing(_inputs);
+    for (auto&& input : _inputs) {
+        auto& slotBlob = _slotBlobs[input.first];
+        if (input.second != slotBlob) {
+            copyBlob(input.second, slotBlob);
+        }
+    }
+}
+
+void BatchInferRequest::CompleteOutputs() {
+    for (auto&& output : _outputs) {
+        auto& slotBlob = _slotBlobs[output.first];
+        if (output.second != slotBlob) {
+            copyBlob(slotBlob, output.second);
+        }
+    }
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ie_common.h>
+#include <cpp_interfaces/ie_task_executor.hpp>
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+#include <cpp/ie_infer_request.hpp>
+
+namespace BatchPlugin {
+
+class BatchInferRequest;
+
+/**
+ * @brief Request of the batched network, every user request is bound to one of its slots
+ */
+struct BatchWorker {
+    using Ptr = std::shared_ptr<BatchWorker>;
+
+    InferenceEngine::InferRequest::Ptr                  _request;
+    std::map<std::string, InferenceEngine::Blob::Ptr>   _blobs;
+    // Started user requests by slot, nullptr if the slot is not started yet
+    std::vector<BatchInferRequest*>                     _pending;
+    size_t                                              _pendingNum = 0;
+    std::chrono::steady_clock::time_point               _firstStartTime;
+    // Guards _running, which is set by the thread starting the batch and taken by the completion callback
+    std::mutex                                          _runningMutex;
+    // User requests inferred by the running batch
+    std::vector<BatchInferRequest*>                     _running;
+    std::vector<bool>                                   _slotsUsed;
+};
+
+class BatchInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<BatchInferRequest>;
+
+    BatchInferRequest(InferenceEngine::InputsDataMap            networkInputs,
+                      InferenceEngine::OutputsDataMap           networkOutputs,
+                      const BatchWorker::Ptr&                   worker,
+                      size_t                                    slot,
+                      const InferenceEngine::InferRequest::Ptr& request);
+
+    /**
+     * @brief Synchronous inference does not wait for other requests, so it is executed without batching
+     */
+    void InferImpl() override;
+
+    /**
+     * @brief Returns the counters of the batched request or, if the last inference was not batched, of the not
+     *        batched one
+     */
+    void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
+
+    /**
+     * @brief Preprocesses inputs into the slot of the batch and copies the inputs set by the user there
+     */
+    void PrepareInputs();
+
+    /**
+     * @brief Copies the outputs from the slot of the batch to the outputs set by the user if any
+     */
+    void CompleteOutputs();
+
+    BatchWorker::Ptr                                    _worker;
+    size_t                                              _slot;
+    // Not batched request which infers the slot memory when the batch is not filled in time
+    InferenceEngine::InferRequest::Ptr                  _request;
+    // Views of the memory of the slot in the batched blobs
+    std::map<std::string, InferenceEngine::Blob::Ptr>   _slotBlobs;
+    InferenceEngine::Task                               _task;
+    InferenceEngine::StatusCode                         _status = InferenceEngine::StatusCode::OK;
+    // The last inference was executed by the not batched request
+    bool                                                _inferredAlone = false;
+};
+
+}  // namespace BatchPlugin
@@ -0,0 +1,220 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_metric_helpers.hpp"
+#include "batch_plugin.hpp"
+#include "ie_util_internal.hpp"
+#include <memory>
+#include <vector>
+#include <map>
+#include <string>
+#include "ie_plugin_config.hpp"
+#include "batch/batch_plugin_config.hpp"
+#include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include "batch_executable_network.hpp"
+#include "cpp_interfaces/base/ie_inference_plugin_api.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::PluginConfigParams;
+using namespace InferenceEngine::BatchConfigParams;
+using namespace BatchPlugin;
+
+namespace {
+
+IE_SUPPRESS_DEPRECATED_START
+
+IInferencePluginAPI * getInferencePluginAPIInterface(InferencePlugin plugin) {
+    InferenceEnginePluginPtr iplugin = static_cast<InferenceEnginePluginPtr>(plugin);
+    return dynamic_cast<IInferencePluginAPI *>(static_cast<IInferencePlugin *>(iplugin.operator->()));
+}
+
+Engine::Configs getSupportedConfig(const Engine::Configs& config, const InferencePlugin& plugin) {
+    auto pluginApi = getInferencePluginAPIInterface(plugin);
+    std::vector<std::string> supportedConfigKeys = pluginApi->GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), {});
+    Engine::Configs supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+IE_SUPPRESS_DEPRECATED_END
+
+// The slot of a request is a contiguous part of the batched blob only if the batch is the outermost dimension
+void checkBatchLayout(const std::string& name, const TensorDesc& desc) {
+    switch (desc.getLayout()) {
+    case NCHW:
+    case NHWC:
+    case NCDHW:
+    case NDHWC:
+    case NC:
+        break;
+    default:
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Batching plugin does not support layout " << desc.getLayout()
+                           << " of " << name;
+    }
+    if (desc.getDims().empty() || desc.getDims()[0] != 1) {
+        THROW_IE_EXCEPTION << "Batching plugin expects the network with batch 1, but " << name << " has batch "
+                           << (desc.getDims().empty() ? 0 : desc.getDims()[0]);
+    }
+}
+
+void checkBatchedDims(const std::string& name, const SizeVector& dims, const SizeVector& batchedDims, size_t batchSize) {
+    SizeVector expectedDims = dims;
+    expectedDims[0] = batchSize;
+    if (batchedDims != expectedDims) {
+        THROW_IE_EXCEPTION << "Batching plugin cannot set batch " << batchSize << " for " << name;
+    }
+}
+
+}  // namespace
+
+Engine::Engine() {
+    _pluginName = "BATCH";
+    _config[BATCH_CONFIG_KEY(SIZE)] = "8";
+    _config[BATCH_CONFIG_KEY(TIMEOUT)] = "1000";
+}
+
+IE_SUPPRESS_DEPRECATED_START
+
+InferencePlugin Engine::GetDevicePlugin(const std::string& deviceWithID) const {
+    InferencePlugin plugin;
+    DeviceIDParser deviceParser(deviceWithID);
+    std::string deviceName = deviceParser.getDeviceName();
+
+    if (nullptr == _core) {
+        PluginDispatcher dispatcher({file_name_t()});
+        plugin = dispatcher.getPluginByDevice(deviceName);
+    } else {
+        plugin = InferencePlugin{_core->GetPluginByName(deviceName)};
+    }
+    return plugin;
+}
+
+ExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(const ICore*   core,
+                                                          ICNNNetwork&   network,
+                                                          const Configs& config) {
+    Configs tconfig = config;
+    // we must not override the parameter, but need to copy everything from plugin config
+    for (auto && c : _config) {
+        if (tconfig.find(c.first) == tconfig.end()) {
+            tconfig[c.first] = c.second;
+        }
+    }
+
+    auto itDevice = tconfig.find(BATCH_CONFIG_KEY(DEVICE));
+    if (itDevice == tconfig.end() || itDevice->second.empty()) {
+        THROW_IE_EXCEPTION << "The '" << BATCH_CONFIG_KEY(DEVICE) << "' option was not defined for batching plugin";
+    }
+
+    int batchSize = 0;
+    try {
+        batchSize = std::stoi(tconfig[BATCH_CONFIG_KEY(SIZE)]);
+    } catch (const std::exception&) {
+    }
+    if (batchSize <= 0) {
+        THROW_IE_EXCEPTION << "Wrong value " << tconfig[BATCH_CONFIG_KEY(SIZE)] << " for property key "
+                           << BATCH_CONFIG_KEY(SIZE) << ". Expected only positive integer numbers";
+    }
+
+    int timeout = -1;
+    try {
+        timeout = std::stoi(tconfig[BATCH_CONFIG_KEY(TIMEOUT)]);
+    } catch (const std::exception&) {
+    }
+    if (timeout < 0) {
+        THROW_IE_EXCEPTION << "Wrong value " << tconfig[BATCH_CONFIG_KEY(TIMEOUT)] << " for property key "
+                           << BATCH_CONFIG_KEY(TIMEOUT) << ". Expected only non-negative integer numbers";
+    }
+
+    InputsDataMap inputs;
+    OutputsDataMap outputs;
+    network.getInputsInfo(inputs);
+    network.getOutputsInfo(outputs);
+    for (auto&& input : inputs) {
+        checkBatchLayout(input.first, input.second->getTensorDesc());
+    }
+    for (auto&& output : outputs) {
+        checkBatchLayout(output.first, output.second->getTensorDesc());
+    }
+
+    auto plugin = GetDevicePlugin(itDevice->second);
+    auto deviceConfig = getSupportedConfig(tconfig, plugin);
+    std::string deviceID = DeviceIDParser(itDevice->second).getDeviceID();
+    if (!deviceID.empty()) {
+        deviceConfig[KEY_DEVICE_ID] = deviceID;
+    }
+    bool dynamicBatch = deviceConfig.find(KEY_DYN_BATCH_ENABLED) != deviceConfig.end() &&
+                        deviceConfig[KEY_DYN_BATCH_ENABLED] == YES;
+
+    CNNNetwork batchedNetwork{cloneNet(network)};
+    batchedNetwork.setBatchSize(batchSize);
+    auto batchedExecutableNetwork = plugin.LoadNetwork(batchedNetwork, deviceConfig);
+    for (auto&& input : batchedExecutableNetwork.GetInputsInfo()) {
+        checkBatchedDims(input.first, inputs[input.first]->getTensorDesc().getDims(),
+                         input.second->getTensorDesc().getDims(), batchSize);
+    }
+    for (auto&& output : batchedExecutableNetwork.GetOutputsInfo()) {
+        checkBatchedDims(output.first, outputs[output.first]->getTensorDesc().getDims(),
+                         output.second->getTensorDesc().getDims(), batchSize);
+    }
+
+    // The not batched network infers the requests which do not fill the batch in time
+    deviceConfig.erase(KEY_DYN_BATCH_ENABLED);
+    CNNNetwork clonedNetwork{cloneNet(network)};
+    auto executableNetwork = plugin.LoadNetwork(clonedNetwork, deviceConfig);
+
+    return std::make_shared<BatchExecutableNetwork>(batchedExecutableNetwork, executableNetwork, tconfig,
+                                                    static_cast<size_t>(batchSize),
+                                                    std::chrono::microseconds(timeout), dynamicBatch);
+}
+
+IE_SUPPRESS_DEPRECATED_END
+
+void Engine::SetConfig(const Configs &configs) {
+    for (auto&& config : configs) {
+        _config[config.first] = config.second;
+    }
+}
+
+Parameter Engine::GetMetric(const std::string& name, const std::map<std::string, Parameter> & options) const {
+    if (METRIC_KEY(SUPPORTED_METRICS) == name) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, std::vector<std::string>{
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS)});
+    } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
+            BATCH_CONFIG_KEY(DEVICE),
+            BATCH_CONFIG_KEY(SIZE),
+            BATCH_CONFIG_KEY(TIMEOUT)});
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported Plugin metric: " << name;
+    }
+}
+
+Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter> & options) const {
+    auto it = _config.find(name);
+    if (it == _config.end()) {
+        THROW_IE_EXCEPTION << "Unsupported config key: " << name;
+    }
+    return it->second;
+}
+
+IE_SUPPRESS_DEPRECATED_START
+
+INFERENCE_PLUGIN_API(InferenceEngine::StatusCode) CreatePluginEngine(
+        InferenceEngine::IInferencePlugin *&plugin,
+        InferenceEngine::ResponseDesc *resp) noexcept {
+    try {
+        plugin = make_ie_compatible_plugin({2, 1, CI_BUILD_NUMBER, "batchPlugin"},
+                                           std::make_shared<Engine>());
+        return OK;
+    }
+    catch (std::exception &ex) {
+        return DescriptionBuffer(GENERAL_ERROR, resp) << ex.what();
+    }
+}
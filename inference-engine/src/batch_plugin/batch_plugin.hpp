@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+#include "inference_engine.hpp"
+#include "description_buffer.hpp"
+#include "ie_icore.hpp"
+#include "cpp_interfaces/impl/ie_plugin_internal.hpp"
+#include "cpp/ie_plugin_cpp.hpp"
+#include <map>
+#include <string>
+
+namespace BatchPlugin {
+
+class Engine : public InferenceEngine::InferencePluginInternal {
+public:
+    using Configs = std::map<std::string, std::string>;
+
+    Engine();
+
+    InferenceEngine::ExecutableNetworkInternal::Ptr
+    LoadExeNetworkImpl(const InferenceEngine::ICore * core, InferenceEngine::ICNNNetwork &network, const Configs &config) override;
+
+    void SetConfig(const Configs &config) override;
+
+    InferenceEngine::Parameter GetMetric(const std::string& name,
+        const std::map<std::string, InferenceEngine::Parameter> & options) const override;
+
+    InferenceEngine::Parameter GetConfig(const std::string& name,
+        const std::map<std::string, InferenceEngine::Parameter> & options) const override;
+
+    IE_SUPPRESS_DEPRECATED_START
+
+    InferenceEngine::InferencePlugin GetDevicePlugin(const std::string& device) const;
+
+    IE_SUPPRESS_DEPRECATED_END
+};
+
+}  // namespace BatchPlugin
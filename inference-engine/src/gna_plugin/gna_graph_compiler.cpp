@@ -1499,7 +1499,11 @@ void GNAGraphCompiler::connectOutput(InferenceEngine::CNNLayerPtr layer, void *p
     }
     // cannot reuse suitable input
     if (unused_input == nullptr) {
-        gnamem->reserve_ptr(ptr, ALIGN64(num_data_bytes_out), 64);
+        if (gnaFlags->compact_mode) {
+            gnamem->reserve_scratch_ptr(ptr, ALIGN64(num_data_bytes_out), 64);
+        } else {
+            gnamem->reserve_ptr(ptr, ALIGN64(num_data_bytes_out), 64);
+        }
     }
 }
 
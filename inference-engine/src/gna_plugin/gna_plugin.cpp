@@ -479,9 +479,13 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
     }
 
     // CreatingLayer primitives
+    // layers indexes are used as lifetimes of intermediate buffers, so they follow GNA components order
+    int32_t layerIndex = 0;
     for (auto & layer : sortedNoMem) {
+        gnamem->set_layer_index(layerIndex++);
         graphCompiler.CreateLayerPrimitive(layer);
     }
+    gnamem->set_layer_index(-1);
     for (auto& inputLayer : inputLayers) {
         auto layerInfo = LayerInfo(inputLayer);
         if (layerInfo.isInput() && 0 == inputsDesc->bytes_allocated_for_input[inputLayer->name]) {
@@ -555,12 +559,14 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
     void *pParallelExecutionData  = nullptr;
 
     // reserving more bytes for intermediate data in parallel case - TODO: this works incorrectly in compact mode at lest
-    rwSegmentSize = gnamem->getRWBytes();
+    rwSegmentSize = gnamem->calculateRWBytes();
     if (gnaFlags->gna_lib_async_threads_num > 1) {
-        gnamem->reserve_ptr(&pParallelExecutionData, gnamem->getRWBytes() * (gnaFlags->gna_lib_async_threads_num - 1), 64);
+        gnamem->reserve_ptr(&pParallelExecutionData, rwSegmentSize * (gnaFlags->gna_lib_async_threads_num - 1), 64);
     }
 
     gnamem->commit();
+    gnalog() << "GNA memory: " << gnamem->getTotalBytes() << " bytes allocated, "
+             << gnamem->getScratchSavedBytes() << " bytes saved by sharing intermediate buffers\n";
 
     dnn->Init(gnamem->getBasePtr(),
              gnamem->getTotalBytes(),
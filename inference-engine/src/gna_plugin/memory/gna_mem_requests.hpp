@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <vector>
 #include <algorithm>
@@ -40,6 +41,10 @@ struct MemRequest {
     size_t _offset = 0;
     // expansion in bytes due to large depended layers
     size_t _padding = 0;
+    // index of the layer which issued the request, negative if request is not issued by particular layer
+    int32_t _layer_index = -1;
+    // scratch buffer may share memory with other scratch buffers not alive at the same time
+    bool _scratch = false;
     MemRequest(rRegion region,
                 rType req,
                 void *ptr_out,
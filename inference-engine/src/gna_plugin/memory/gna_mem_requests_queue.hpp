@@ -27,11 +27,11 @@ public:
      * @param alignment
      */
     void push_initializer(void *ptr_out, size_t num_bytes, std::function<void(void * data, size_t size)> initializer, size_t alignment = 1) {
-        futureHeap().push_back({regionType(), ptr_out, num_bytes, initializer, REQUEST_INITIALIZER, alignment});
+        push_request({regionType(), ptr_out, num_bytes, initializer, REQUEST_INITIALIZER, alignment});
     }
 
     void push_ptr(void *ptr_out, const void *ptr_in, size_t num_bytes, size_t alignment = 1) {
-        futureHeap().push_back({regionType(), REQUEST_STORE, ptr_out, ptr_in, 1, num_bytes, alignment});
+        push_request({regionType(), REQUEST_STORE, ptr_out, ptr_in, 1, num_bytes, alignment});
     }
 
     /**
@@ -43,7 +43,7 @@ public:
     void push_local_ptr(void *ptr_out, const void *ptr_in, size_t num_bytes, size_t alignment = 1) {
         localStorage().emplace_back(reinterpret_cast<const uint8_t *>(ptr_in),
                                     reinterpret_cast<const uint8_t *>(ptr_in) + num_bytes);
-        futureHeap().push_back({regionType(), REQUEST_STORE, ptr_out, &localStorage().back().front(), 1, num_bytes, alignment});
+        push_request({regionType(), REQUEST_STORE, ptr_out, &localStorage().back().front(), 1, num_bytes, alignment});
     }
 
     /**
@@ -52,7 +52,18 @@ public:
      * @param num_bytes
      */
     void reserve_ptr(void *ptr_out, size_t num_bytes, size_t alignment = 1)  {
-        futureHeap().push_back({regionType(), REQUEST_ALLOCATE, ptr_out, nullptr, 1, num_bytes, alignment});
+        push_request({regionType(), REQUEST_ALLOCATE, ptr_out, nullptr, 1, num_bytes, alignment});
+    }
+
+    /**
+     * @brief reserves intermediate buffer of the layer being compiled, it is alive from that layer
+     * till the last layer using it through bind requests, so it can share memory with other scratch buffers
+     * @param ptr_out
+     * @param num_bytes
+     */
+    void reserve_scratch_ptr(void *ptr_out, size_t num_bytes, size_t alignment = 1)  {
+        push_request({regionType(), REQUEST_ALLOCATE, ptr_out, nullptr, 1, num_bytes, alignment});
+        futureHeap().back()._scratch = true;
     }
 
     /**
@@ -64,7 +75,7 @@ public:
      *      if that happens - reserved request parameters will be updated before committing memory
      */
     void bind_ptr(void *source, const void *dest, size_t offset = 0, size_t num_bytes = 0)  {
-        futureHeap().push_back({regionType(), REQUEST_BIND, source, dest, 1, num_bytes, 1, offset});
+        push_request({regionType(), REQUEST_BIND, source, dest, 1, num_bytes, 1, offset});
     }
 
     /**
@@ -73,7 +84,7 @@ public:
      * @param initializer - initialisation routine to be called on allocated memory
      */
     void bind_initializer(void *ptr_out, std::function<void(void * data, size_t size)> initializer)  {
-        futureHeap().push_back({regionType(), ptr_out, 0, initializer, REQUEST_BIND, 1});
+        push_request({regionType(), ptr_out, 0, initializer, REQUEST_BIND, 1});
     }
 
     /**
@@ -81,7 +92,15 @@ public:
      */
     template<class T>
     void push_value(void *ptr_out, T value, size_t num_elements, size_t alignment = 1) {
-        futureHeap().push_back({regionType(), ptr_out, value, num_elements, alignment});
+        push_request({regionType(), ptr_out, value, num_elements, alignment});
+    }
+
+    /**
+     * @brief sets index of the layer being compiled, it is attached to all subsequent requests
+     * to calculate lifetimes of scratch buffers, negative index means requests are not issued by particular layer
+     */
+    void set_layer_index(int32_t index) {
+        _layer_index = index;
     }
 
     /**
@@ -90,6 +109,14 @@ public:
     virtual rRegion regionType() const = 0;
     virtual std::vector<MemRequest> & futureHeap()  = 0;
     virtual std::list<std::vector<char>> &localStorage() = 0;
+
+ protected:
+    void push_request(MemRequest && request) {
+        request._layer_index = _layer_index;
+        futureHeap().push_back(std::move(request));
+    }
+
+    int32_t _layer_index = -1;
 };
 }  // namespace memory
 }  // namespace GNAPluginNS
@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 #include <list>
+#include <limits>
 #include <algorithm>
 #include <functional>
 
@@ -39,6 +40,10 @@ class GNAMemory : public GNAMemRequestsQueue {
     size_t _total = 0;
     size_t _rw_section_size = 0;
     size_t _ro_section_size = 0;
+    // scratch buffers are packed into the beginning of read/write section
+    size_t _scratch_section_size = 0;
+    size_t _scratch_saved_bytes = 0;
+    std::vector<size_t> _scratch_offsets;
     Allocator _allocator;
     std::shared_ptr<uint8_t> heap;
     size_t _page_alignment = 1;
@@ -76,23 +81,6 @@ class GNAMemory : public GNAMemRequestsQueue {
      * @brief calculates size required for all requests, allocates memory and updates pointers
      */
     void commit() {
-        // 1st stage -- looking for expandable bind requests:
-        for (auto &originated : _future_heap) {
-            if (originated._type & REQUEST_BIND) continue;
-            size_t offset = 0;
-            iterate_binded(originated, [&](MemRequest & reference, MemRequest & binded) {
-                if (&originated == &reference) {
-                    offset = 0;
-                }
-                offset += binded._offset;
-                auto current = offset + ALIGN(binded._num_elements * binded._element_size, binded._alignment);
-                auto original_no_pad = ALIGN(originated._num_elements * originated._element_size, originated._alignment);
-                auto original_with_pad = ALIGN(originated._num_elements * originated._element_size + originated._padding, originated._alignment);
-
-                originated._padding = ALIGN(std::max(original_with_pad, current), originated._alignment) - original_no_pad;
-            });
-        }
-
         updateSectionsSizes();
 
         _total = _rw_section_size + _ro_section_size;
@@ -100,15 +88,18 @@ class GNAMemory : public GNAMemRequestsQueue {
         // allocation with memory setting to 0 internally
         heap = allocate(_total);
         auto setupOffsets = [&](std::function<bool(MemRequest & request)> filter, size_t offset) {
-            for (auto &re : _future_heap) {
+            for (size_t i = 0; i != _future_heap.size(); i++) {
+                auto &re = _future_heap[i];
                 if (re._type == REQUEST_BIND) continue;
                 if (filter(re)) continue;
 
                 auto sz = re._element_size * re._num_elements;
+                auto packed = _scratch_offsets[i] != NOT_PACKED;
+                auto re_offset = packed ? _scratch_offsets[i] : offset;
 
                 if (re._ptr_out != nullptr) {
-                    auto cptr = heap.get() + offset;
-                    size_t cptr_avail_size = _total - offset;
+                    auto cptr = heap.get() + re_offset;
+                    size_t cptr_avail_size = _total - re_offset;
                     if (re._type & REQUEST_BIND) {
                         cptr = reinterpret_cast<uint8_t*>(*reinterpret_cast<void **>(re._ptr_out));
                         cptr_avail_size = sz;
@@ -145,7 +136,7 @@ class GNAMemory : public GNAMemRequestsQueue {
                         }
                     }
                 }
-                if (!(re._type & REQUEST_BIND)) {
+                if (!(re._type & REQUEST_BIND) && !packed) {
                     offset += ALIGN(sz + re._padding, re._alignment);
                 }
             }
@@ -154,7 +145,7 @@ class GNAMemory : public GNAMemRequestsQueue {
         setupOffsets([](GNAPluginNS::memory::MemRequest & request) {
             // TODO: consume bind requests separately from storage type
             return !(request._type & REQUEST_BIND) && (request._region != REGION_RW);
-        }, 0);
+        }, _scratch_section_size);
 
         setupOffsets([](GNAPluginNS::memory::MemRequest & request) {
             return (request._type & REQUEST_BIND) || request._region != REGION_RO;
@@ -165,16 +156,33 @@ class GNAMemory : public GNAMemRequestsQueue {
         return heap.get();
     }
 
-    size_t getRWBytes() {
+    /**
+     * @brief lays out requests queued so far and returns size of read/write section they need,
+     * used to size requests that depend on it before commit
+     */
+    size_t calculateRWBytes() {
         updateSectionsSizes();
         return _rw_section_size;
     }
 
-    size_t getTotalBytes() {
-        updateSectionsSizes();
+    /**
+     * @brief size of read/write section, valid after commit
+     */
+    size_t getRWBytes() const {
+        return _rw_section_size;
+    }
+
+    size_t getTotalBytes() const {
         return _total;
     }
 
+    /**
+     * @brief number of bytes saved by sharing memory between scratch buffers not alive at the same time, valid after commit
+     */
+    size_t getScratchSavedBytes() const {
+        return _scratch_saved_bytes;
+    }
+
  protected:
     rRegion regionType() const override {
         return REGION_RW;
@@ -210,11 +218,114 @@ class GNAMemory : public GNAMemRequestsQueue {
     }
 
  protected:
+    static constexpr size_t NOT_PACKED = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief assigns offsets in the scratch section to the scratch buffers with known lifetimes,
+     * buffers are placed in the order of decreasing size to the lowest offset where they don't overlap
+     * with already placed buffers alive at the same time
+     */
+    void packScratchBuffers() {
+        struct Lifetime {
+            size_t index;
+            size_t size;
+            int32_t first;
+            int32_t last;
+        };
+
+        _scratch_offsets.assign(_future_heap.size(), NOT_PACKED);
+        _scratch_section_size = 0;
+        _scratch_saved_bytes = 0;
+
+        std::vector<Lifetime> scratches;
+        size_t max_alignment = 1;
+        for (size_t i = 0; i != _future_heap.size(); i++) {
+            auto &re = _future_heap[i];
+            if (re._type == REQUEST_BIND || re._region != REGION_RW) continue;
+            max_alignment = std::max(max_alignment, re._alignment);
+
+            if (!re._scratch || re._layer_index < 0) continue;
+
+            Lifetime lifetime = {i, ALIGN(re._num_elements * re._element_size + re._padding, re._alignment),
+                                 re._layer_index, re._layer_index};
+            bool bounded = true;
+            iterate_binded(re, [&](MemRequest & reference, MemRequest & binded) {
+                if (binded._layer_index < 0) {
+                    bounded = false;
+                }
+                lifetime.first = std::min(lifetime.first, binded._layer_index);
+                lifetime.last = std::max(lifetime.last, binded._layer_index);
+            });
+            // used outside of compiled layers, ex. by network outputs
+            if (!bounded) continue;
+
+            scratches.push_back(lifetime);
+        }
+
+        std::stable_sort(scratches.begin(), scratches.end(), [](const Lifetime & lhs, const Lifetime & rhs) {
+            return lhs.size > rhs.size;
+        });
+
+        std::vector<const Lifetime*> placed;
+        std::vector<const Lifetime*> overlapped;
+        for (auto &scratch : scratches) {
+            overlapped.clear();
+            for (auto other : placed) {
+                if (other->first <= scratch.last && scratch.first <= other->last) {
+                    overlapped.push_back(other);
+                }
+            }
+            std::sort(overlapped.begin(), overlapped.end(), [this](const Lifetime * lhs, const Lifetime * rhs) {
+                return _scratch_offsets[lhs->index] < _scratch_offsets[rhs->index];
+            });
+
+            auto alignment = _future_heap[scratch.index]._alignment;
+            size_t offset = 0;
+            for (auto other : overlapped) {
+                if (offset + scratch.size <= _scratch_offsets[other->index]) break;
+                offset = std::max(offset, ALIGN(_scratch_offsets[other->index] + other->size, alignment));
+            }
+
+            _scratch_offsets[scratch.index] = offset;
+            _scratch_section_size = std::max(_scratch_section_size, offset + scratch.size);
+            _scratch_saved_bytes += scratch.size;
+            placed.push_back(&scratch);
+        }
+
+        _scratch_section_size = ALIGN(_scratch_section_size, max_alignment);
+        _scratch_saved_bytes -= std::min(_scratch_saved_bytes, _scratch_section_size);
+    }
+
+    /**
+     * @brief looking for expandable bind requests
+     */
+    void updatePaddings() {
+        for (auto &originated : _future_heap) {
+            if (originated._type & REQUEST_BIND) continue;
+            size_t offset = 0;
+            iterate_binded(originated, [&](MemRequest & reference, MemRequest & binded) {
+                if (&originated == &reference) {
+                    offset = 0;
+                }
+                offset += binded._offset;
+                auto current = offset + ALIGN(binded._num_elements * binded._element_size, binded._alignment);
+                auto original_no_pad = ALIGN(originated._num_elements * originated._element_size, originated._alignment);
+                auto original_with_pad = ALIGN(originated._num_elements * originated._element_size + originated._padding, originated._alignment);
+
+                originated._padding = ALIGN(std::max(original_with_pad, current), originated._alignment) - original_no_pad;
+            });
+        }
+    }
+
     void updateSectionsSizes() {
+        updatePaddings();
+        packScratchBuffers();
+
         // count total size and size of read/write regions
-        _rw_section_size = 0;
+        _rw_section_size = _scratch_section_size;
         _ro_section_size = 0;
-        for (auto &re : _future_heap) {
+        for (size_t i = 0; i != _future_heap.size(); i++) {
+            auto &re = _future_heap[i];
             auto current = ALIGN(re._num_elements * re._element_size + re._padding, re._alignment);
 #ifdef GNA_HEAP_PROFILER
             std::cout << "chunk: " << " region: " << re._region << ", " <<
@@ -226,6 +337,7 @@ class GNAMemory : public GNAMemRequestsQueue {
                     re._alignment << std::endl;
 #endif
             if (re._type == REQUEST_BIND) continue;
+            if (_scratch_offsets[i] != NOT_PACKED) continue;
 
             if (re._region == REGION_RW) {
                 _rw_section_size += current;
@@ -237,5 +349,8 @@ class GNAMemory : public GNAMemRequestsQueue {
         _ro_section_size = ALIGN(_ro_section_size, _page_alignment);
     }
 };
+
+template<class Allocator>
+constexpr size_t GNAMemory<Allocator>::NOT_PACKED;
 }  // namespace memory
 }  // namespace GNAPluginNS
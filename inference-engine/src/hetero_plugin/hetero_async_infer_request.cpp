@@ -4,9 +4,11 @@
 
 #include <utility>
 #include <memory>
+#include <string>
 #include "hetero_async_infer_request.hpp"
 #include <ie_util_internal.hpp>
 #include <ie_profiling.hpp>
+#include <ie_tracer.hpp>
 
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
@@ -20,24 +22,36 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const HeteroInferRequest::Ptr&
     _pipeline.clear();
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(InferRequest* inferRequest) : _inferRequest{inferRequest} {
+            RequestExecutor(InferRequest* inferRequest, const std::string& traceName, int traceSession) :
+                _inferRequest{inferRequest}, _traceName{traceName}, _traceSession{traceSession} {
                 _inferRequest->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
                 [this] (InferRequest, StatusCode sts) mutable {
                     _status = sts;
+                    // The subrequest is traced from its start till its completion callback
+                    if (_traceSession != 0) {
+                        auto& tracer = Tracer::getInstance();
+                        tracer.addEvent(_traceSession, "HETERO", _traceName, _startTime, tracer.now());
+                    }
                     auto capturedTask = std::move(_task);
                     capturedTask();
                 });
             }
             void run(Task task) override {
                 _task = std::move(task);
+                _startTime = Tracer::getInstance().now();
                 _inferRequest->StartAsync();
             };
             InferRequest*   _inferRequest = nullptr;
+            std::string     _traceName;
+            int             _traceSession = 0;
+            int64_t         _startTime = 0;
             StatusCode      _status = StatusCode::OK;
             Task            _task;
         };
 
-        auto reuestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request.get());
+        auto& desc = _heteroInferRequest->_inferRequests[requestId];
+        auto reuestExecutor = std::make_shared<RequestExecutor>(desc._request.get(), desc._traceName,
+                                                                _heteroInferRequest->getTraceSession());
         _pipeline.emplace_back(reuestExecutor, [reuestExecutor] {
             if (StatusCode::OK != reuestExecutor->_status) {
                 THROW_IE_EXCEPTION << InferenceEngine::details::as_status << reuestExecutor->_status;
@@ -31,6 +31,7 @@
 #include "precision_utils.h"
 #include "hetero_plugin.hpp"
 #include "network_serializer.h"
+#include "ie_tracer.hpp"
 
 using namespace InferenceEngine;
 using namespace details;
@@ -338,6 +339,23 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(InferenceEngine::ICNNNetwork&
     }
 
     networks = std::move(descs);
+
+    auto itTraceFile = config.find(CONFIG_KEY(TRACE_FILE));
+    if (itTraceFile != config.end() && !itTraceFile->second.empty()) {
+        _traceFile = itTraceFile->second;
+        _traceSession = Tracer::getInstance().startSession();
+    }
+}
+
+HeteroExecutableNetwork::~HeteroExecutableNetwork() {
+    if (_traceSession != 0) {
+        auto& tracer = Tracer::getInstance();
+        try {
+            tracer.write(_traceSession, _traceFile);
+        } catch (...) {
+        }
+        tracer.endSession(_traceSession);
+    }
 }
 
 namespace  {
@@ -567,12 +585,15 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     for (auto&& subnetwork : networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
-        desc._profilingTask = ProfilingTask{"Infer" + std::to_string(index++)};
+        desc._profilingTask = ProfilingTask{"Infer" + std::to_string(index)};
+        desc._traceName = "Infer" + std::to_string(index++) + " on " + subnetwork._device;
         inferRequests.push_back(desc);
     }
-    return std::make_shared<HeteroInferRequest>(networkInputs,
-                                                networkOutputs,
-                                                inferRequests);
+    auto request = std::make_shared<HeteroInferRequest>(networkInputs,
+                                                        networkOutputs,
+                                                        inferRequests);
+    request->setTraceSession(_traceSession);
+    return request;
 }
 
 void HeteroExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
@@ -598,6 +619,8 @@ void HeteroExecutableNetwork::GetConfig(const std::string &name, InferenceEngine
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == CONFIG_KEY(TRACE_FILE)) {
+        result = _traceFile;
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork config key: " << name;
     }
@@ -614,7 +637,8 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
         result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
-            CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)});
+            CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
+            CONFIG_KEY(TRACE_FILE)});
     } else if (METRIC_KEY(NETWORK_NAME) == name) {
         result = IE_SET_METRIC(NETWORK_NAME, _name);
     } else if (METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
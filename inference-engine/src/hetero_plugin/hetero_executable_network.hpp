@@ -50,7 +50,7 @@ public:
                             const std::map<std::string, std::string>&   config,
                             Engine*                                     plugin);
 
-    virtual ~HeteroExecutableNetwork() = default;
+    virtual ~HeteroExecutableNetwork();
 
     InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                                                       InferenceEngine::OutputsDataMap networkOutputs) override;
@@ -75,6 +75,10 @@ private:
     std::string                         _name;
     std::vector<std::string>            _affinities;
     std::map<std::string, std::string>  _config;
+    // The timeline is written to the file when the network is destroyed, empty if the tracing is disabled
+    std::string                         _traceFile;
+    // Session of the Tracer the requests record to, 0 if the tracing is disabled
+    int                                 _traceSession = 0;
 };
 
 }  // namespace HeteroPlugin
@@ -6,6 +6,7 @@
 #include <ie_blob.h>
 #include <ie_plugin.hpp>
 #include <ie_util_internal.hpp>
+#include <ie_tracer.hpp>
 #include <description_buffer.hpp>
 #include <debug.h>
 #include <ie_layouts.h>
@@ -71,6 +72,7 @@ void HeteroInferRequest::InferImpl() {
     size_t i = 0;
     for (auto &&desc : _inferRequests) {
         IE_PROFILING_AUTO_SCOPE_TASK(desc._profilingTask);
+        TraceScope trace(_traceSession, "HETERO", desc._traceName);
         auto &r = desc._request;
         assert(nullptr != r);
         r->Infer();
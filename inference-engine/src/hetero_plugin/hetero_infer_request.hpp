@@ -30,6 +30,7 @@ public:
         InferenceEngine::ExecutableNetwork  _network;
         InferenceEngine::InferRequest::Ptr  _request;
         InferenceEngine::ProfilingTask      _profilingTask;
+        std::string                         _traceName;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
@@ -100,6 +100,9 @@ Engine::Configs Engine::GetSupportedConfig(const Engine::Configs& config, const
     std::vector<std::string> supportedConfigKeys = pluginApi->GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), {});
     Engine::Configs supportedConfig;
     for (auto&& key : supportedConfigKeys) {
+        // The timeline of the subnetworks is written by the HETERO network, they do not open their own traces
+        if (key == CONFIG_KEY(TRACE_FILE))
+            continue;
         auto itKey = config.find(key);
         if (config.end() != itKey) {
             supportedConfig[key] = itKey->second;
@@ -309,7 +312,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
             "TARGET_FALLBACK",
-            CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)});
+            CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
+            CONFIG_KEY(TRACE_FILE)});
     } else {
         THROW_IE_EXCEPTION << "Unsupported Plugin metric: " << name;
     }
@@ -321,6 +325,9 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == CONFIG_KEY(TRACE_FILE)) {
+        auto it = _config.find(CONFIG_KEY(TRACE_FILE));
+        return { it != _config.end() ? it->second : std::string{} };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
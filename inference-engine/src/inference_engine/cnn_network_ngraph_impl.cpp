@@ -13,6 +13,7 @@
 #include <ie_ir_reader.hpp>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <unordered_set>
 #include <ngraph/descriptor/output.hpp>
@@ -157,6 +158,7 @@
 #include "ie_util_internal.hpp"
 #include "ie_cnn_layer_builder_ngraph.h"
 #include "ie_ngraph_utils.hpp"
+#include "ie_parallel.hpp"
 #include "ie_profiling.hpp"
 #include "network_serializer.h"
 #include "ngraph_ops/eltwise.hpp"
@@ -1090,25 +1092,51 @@ void CNNNetworkNGraphImpl::convertFunctionToICNNNetwork(std::shared_ptr<::ngraph
         }
     }
 
-    // Create layers and output data
+    std::vector<std::shared_ptr<::ngraph::Node>> layers;
     for (const auto& layer : graph->get_ops()) {
         if (isInternalLayer(layer, op_names, keep_constants)) continue;
+        layers.push_back(layer);
+    }
 
-        // TODO: remove this rt info when all blobs will be inputs
-        InferenceEngine::Parameter attr(keep_constants);
-        auto & rt_info = layer->get_rt_info();
-        rt_info["keep_constants"] = attr.asVariant();
-
-        CNNLayerPtr cnnLayer = createCNNLayer(layer);
-        for (const auto& rt : layer->get_rt_info()) {
-            Parameter param(rt.second);
-            if (param.empty()) continue;
-            if (details::CaselessEq<std::string>()(rt.first, "affinity")) {
-                cnnLayer->affinity = param.as<std::string>();
-            } else if (param.is<std::string>()) {
-                cnnLayer->params[rt.first] = param.as<std::string>();
+    // Layers are converted independently of each other, so this part is done in parallel
+    // and only the creation of data objects and connections below stays sequential
+    std::vector<CNNLayerPtr> cnnLayers(layers.size());
+    {
+        IE_PROFILING_AUTO_SCOPE(CreateCNNLayers)
+        std::mutex exceptionMutex;
+        std::exception_ptr exception = nullptr;
+        parallel_for(layers.size(), [&](size_t i) {
+            try {
+                const auto& layer = layers[i];
+
+                // TODO: remove this rt info when all blobs will be inputs
+                InferenceEngine::Parameter attr(keep_constants);
+                auto & rt_info = layer->get_rt_info();
+                rt_info["keep_constants"] = attr.asVariant();
+
+                CNNLayerPtr cnnLayer = createCNNLayer(layer);
+                for (const auto& rt : layer->get_rt_info()) {
+                    Parameter param(rt.second);
+                    if (param.empty()) continue;
+                    if (details::CaselessEq<std::string>()(rt.first, "affinity")) {
+                        cnnLayer->affinity = param.as<std::string>();
+                    } else if (param.is<std::string>()) {
+                        cnnLayer->params[rt.first] = param.as<std::string>();
+                    }
+                }
+                cnnLayers[i] = cnnLayer;
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!exception) exception = std::current_exception();
             }
-        }
+        });
+        if (exception) std::rethrow_exception(exception);
+    }
+
+    // Create output data
+    for (size_t layerId = 0; layerId < layers.size(); layerId++) {
+        const auto& layer = layers[layerId];
+        const auto& cnnLayer = cnnLayers[layerId];
         size_t inputCount(0);
         for (size_t i = 0; i < layer->get_input_size(); i++) {
             const auto& input = layer->get_inputs()[i];
@@ -85,6 +85,10 @@ public:
         TO_STATUS(_impl->SetBatch(batch_size));
     }
 
+    StatusCode SetPriority(int priority, ResponseDesc* resp) noexcept override {
+        TO_STATUS(_impl->SetPriority(priority));
+    }
+
 protected:
     ~InferRequestBase() = default;
 };
@@ -82,6 +82,15 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute InferenceEngine::Task inside task executor context before the queued tasks with lower priority.
+     * Default runWithPriority() method implementation ignores the priority and uses run() pure virtual method
+     * @param task - task to start
+     * @param priority - priority of the task, tasks with higher values are started first,
+     *        tasks with the same priority are started in the order of submission
+     */
+    virtual void runWithPriority(Task task, int priority);
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      * Default runAndWait() method implementation uses run() pure virtual method
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_priority_task_queue.hpp
+ * @brief A header file for the queue of tasks ordered by priority used by task executors
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "cpp_interfaces/ie_itask_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @class PriorityTaskQueue
+ * @brief Queue of tasks which pops the task with the highest priority first and
+ *        the tasks with the same priority in the order of submission.
+ * @note  The queue is not thread safe, executors guard it by their own mutexes
+ */
+class PriorityTaskQueue {
+public:
+    void push(Task task, int priority = 0) {
+        _queue.push(Entry{priority, _sequence++, std::move(task)});
+    }
+
+    Task pop() {
+        // std::priority_queue gives only a const access to the top entry
+        Task task = std::move(const_cast<Entry&>(_queue.top()).task);
+        _queue.pop();
+        return task;
+    }
+
+    bool empty() const {
+        return _queue.empty();
+    }
+
+    std::size_t size() const {
+        return _queue.size();
+    }
+
+private:
+    struct Entry {
+        int priority;
+        std::uint64_t sequence;
+        Task task;
+
+        bool operator<(const Entry& other) const {
+            return priority != other.priority ? priority < other.priority : sequence > other.sequence;
+        }
+    };
+
+    std::priority_queue<Entry> _queue;
+    std::uint64_t _sequence = 0;
+};
+
+}  // namespace InferenceEngine
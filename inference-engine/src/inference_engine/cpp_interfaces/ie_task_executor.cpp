@@ -21,27 +21,24 @@ namespace InferenceEngine {
 TaskExecutor::TaskExecutor(std::string name): _isStopped(false), _name(name) {
     _thread = std::make_shared<std::thread>([&] {
         annotateSetThreadName(("TaskExecutor thread for " + _name).c_str());
-        while (!_isStopped) {
-            bool isQueueEmpty;
+        while (true) {
             Task currentTask;
             {  // waiting for the new task or for stop signal
                 std::unique_lock<std::mutex> lock(_queueMutex);
                 _queueCondVar.wait(lock, [&]() {
                     return !_taskQueue.empty() || _isStopped;
                 });
-                isQueueEmpty = _taskQueue.empty();
-                if (!isQueueEmpty) currentTask = _taskQueue.front();
+                // tasks are popped before the execution, as a task with higher priority can be queued meanwhile
+                if (_taskQueue.empty()) break;
+                currentTask = _taskQueue.pop();
+                _isRunning = true;
             }
-            if (_isStopped && isQueueEmpty) break;
-            if (!isQueueEmpty) {
-                currentTask();
-                std::unique_lock<std::mutex> lock(_queueMutex);
-                _taskQueue.pop();
-                isQueueEmpty = _taskQueue.empty();
-                if (isQueueEmpty) {
-                    // notify dtor, that all tasks were completed
-                    _queueCondVar.notify_all();
-                }
+            currentTask();
+            std::unique_lock<std::mutex> lock(_queueMutex);
+            _isRunning = false;
+            if (_taskQueue.empty()) {
+                // notify dtor, that all tasks were completed
+                _queueCondVar.notify_all();
             }
         }
     });
@@ -50,11 +47,9 @@ TaskExecutor::TaskExecutor(std::string name): _isStopped(false), _name(name) {
 TaskExecutor::~TaskExecutor() {
     {
         std::unique_lock<std::mutex> lock(_queueMutex);
-        if (!_taskQueue.empty()) {
-            _queueCondVar.wait(lock, [this]() {
-                return _taskQueue.empty();
-            });
-        }
+        _queueCondVar.wait(lock, [this]() {
+            return _taskQueue.empty() && !_isRunning;
+        });
         _isStopped = true;
         _queueCondVar.notify_all();
     }
@@ -65,8 +60,12 @@ TaskExecutor::~TaskExecutor() {
 }
 
 void TaskExecutor::run(Task task) {
+    runWithPriority(std::move(task), 0);
+}
+
+void TaskExecutor::runWithPriority(Task task, int priority) {
     std::unique_lock<std::mutex> lock(_queueMutex);
-    _taskQueue.push(std::move(task));
+    _taskQueue.push(std::move(task), priority);
     _queueCondVar.notify_all();
 }
 
@@ -14,6 +14,7 @@
 
 #include "cpp_interfaces/exception2status.hpp"
 #include "cpp_interfaces/ie_itask_executor.hpp"
+#include "cpp_interfaces/ie_priority_task_queue.hpp"
 #include "details/ie_exception.hpp"
 #include "ie_api.h"
 
@@ -29,11 +30,20 @@ public:
 
     void run(Task task) override;
 
+    /**
+     * @brief Add task for execution before the queued tasks with lower priority and notify working thread about new
+     * task
+     * @param task - task to start
+     * @param priority - priority of the task, tasks with higher values are started first
+     */
+    void runWithPriority(Task task, int priority) override;
+
 private:
     std::shared_ptr<std::thread> _thread;
     std::mutex _queueMutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    PriorityTaskQueue _taskQueue;
+    bool _isRunning = false;
     bool _isStopped;
     std::string _name;
 };
@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "ie_infer_async_request_thread_safe_internal.hpp"
+#include "ie_tracer.hpp"
 #include "ie_util_internal.hpp"
 
 namespace InferenceEngine {
@@ -153,6 +154,7 @@ public:
 
     void Infer_ThreadUnsafe() override {
         _syncRequest->checkBlobs();
+        TraceScope trace(_syncRequest->getTraceSession(), "Pipeline", "Infer");
         _syncRequest->InferImpl();
     }
 
@@ -193,6 +195,10 @@ public:
         _syncRequest->SetBatch(batch);
     }
 
+    void SetPriority_ThreadUnsafe(int priority) override {
+        _syncRequest->SetPriority(priority);
+    }
+
     void SetPointerToPublicInterface(InferenceEngine::IInferRequest::Ptr ptr) {
         _publicInterface = std::shared_ptr<IInferRequest>(ptr.get(), [](IInferRequest*) {});
     }
@@ -205,6 +211,7 @@ protected:
     void RunFirstStage() {
         _itStage = _pipeline.begin();
         _promise = {};
+        _startTime = Tracer::getInstance().now();
         bool stop = [&] {
             std::lock_guard<std::mutex> lock(_mutex);
             if (!_stop) {
@@ -228,7 +235,7 @@ protected:
             try {
                 auto& firstStageExecutor = std::get<Stage_e::executor>(*_itStage);
                 IE_ASSERT(nullptr != firstStageExecutor);
-                firstStageExecutor->run(MakeNextStageTask());
+                firstStageExecutor->runWithPriority(MakeNextStageTask(), _syncRequest->GetPriority());
             } catch (...) {
                 _promise.set_exception(std::current_exception());
                 throw;
@@ -251,17 +258,30 @@ protected:
             StatusCode requestStatus = StatusCode::OK;
             std::exception_ptr localCurrentException = nullptr;
             auto& thisStage = *_itStage;
+            auto stageIndex = std::distance(_pipeline.begin(), _itStage);
             auto copyItStage = ++_itStage;
 
             try {
                 auto& stageTask = std::get<Stage_e::task>(thisStage);
                 IE_ASSERT(nullptr != stageTask);
+                // Time from the start till the first stage is taken by an executor shows the idle gaps of the streams
+                auto& tracer = Tracer::getInstance();
+                const int traceSession = _syncRequest->getTraceSession();
+                const bool traced = traceSession != 0;
+                const int64_t stageBegin = traced ? tracer.now() : 0;
+                if (traced && 0 == stageIndex) {
+                    tracer.addEvent(traceSession, "Pipeline", "Queued", _startTime, stageBegin);
+                }
                 stageTask();
+                if (traced) {
+                    tracer.addEvent(traceSession, "Pipeline", "Stage " + std::to_string(stageIndex), stageBegin,
+                                    tracer.now());
+                }
                 if (_pipeline.end() != _itStage) {
                     auto nextStage = *_itStage;
                     auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                     IE_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(MakeNextStageTask());
+                    nextStageExecutor->runWithPriority(MakeNextStageTask(), _syncRequest->GetPriority());
                 }
             } catch (InferenceEngine::details::InferenceEngineException& ie_ex) {
                 requestStatus = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
@@ -277,6 +297,7 @@ protected:
                     auto callback = _callback.load();
                     if (setIsRequestBusy(false)) {
                         if (nullptr != callback) {
+                            TraceScope trace(_syncRequest->getTraceSession(), "Pipeline", "Callback");
                             InferenceEngine::CurrentException() = localCurrentException;
                             try {
                                 callback(_publicInterface, requestStatus);
@@ -351,5 +372,7 @@ protected:
     mutable std::mutex _mutex;
     Futures _futures;
     bool _stop = false;
+    // Time of the last start in microseconds of the Tracer
+    int64_t _startTime = 0;
 };
 }  // namespace InferenceEngine
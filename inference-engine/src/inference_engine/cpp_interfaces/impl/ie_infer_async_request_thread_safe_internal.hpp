@@ -110,6 +110,11 @@ public:
         SetBatch_ThreadUnsafe(batch);
     };
 
+    void SetPriority(int priority) override {
+        CheckBusy();
+        SetPriority_ThreadUnsafe(priority);
+    };
+
     /**
      * @brief methods with _ThreadUnsafe prefix are to implement in plugins
      * or in default wrapper (e.g. AsyncInferRequestThreadSafeDefault)
@@ -136,6 +141,8 @@ public:
     virtual void GetPreProcess_ThreadUnsafe(const char* name, const PreProcessInfo** info) const = 0;
 
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
+
+    virtual void SetPriority_ThreadUnsafe(int priority) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -18,6 +18,7 @@
 #include "ie_compound_blob.h"
 #include "ie_memcpy.h"
 #include "ie_preprocess_data.hpp"
+#include "ie_tracer.hpp"
 
 namespace InferenceEngine {
 
@@ -222,6 +223,31 @@ public:
         THROW_IE_EXCEPTION << "Dynamic batch is not supported";
     };
 
+    void SetPriority(int priority) override {
+        _priority = priority;
+    }
+
+    /**
+     * @brief Gets the priority the executors and schedulers of the plugin order the request by.
+     */
+    int GetPriority() const {
+        return _priority;
+    }
+
+    /**
+     * @brief Sets the session of the Tracer the request records its timeline to, 0 disables the tracing.
+     */
+    void setTraceSession(int session) {
+        _traceSession = session;
+    }
+
+    /**
+     * @brief Gets the session of the Tracer the request records its timeline to.
+     */
+    int getTraceSession() const {
+        return _traceSession;
+    }
+
     /**
      * @brief Checks and executes input data pre-processing if needed.
      */
@@ -231,6 +257,7 @@ public:
             // using preconfigured resize algorithm.
             auto it = _preProcData.find(input.first);
             if (it != _preProcData.end()) {
+                TraceScope trace(_traceSession, "Preprocessing", input.first);
                 _preProcData[input.first]->execute(input.second, _networkInputs[input.first]->getPreProcess(), serial,
                                                    m_curBatch);
             }
@@ -245,6 +272,8 @@ protected:
     ExecutableNetworkInternalPtr _exeNetwork;
     std::map<std::string, PreProcessDataPtr> _preProcData;  // pre-process data per input
     int m_curBatch;                                         // current batch value used in dynamic batching
+    int _priority = 0;                                      // priority of the request, higher values go first
+    int _traceSession = 0;                                  // session of the Tracer, 0 if the request is not traced
 
 protected:
     /**
@@ -76,6 +76,12 @@ public:
      * @param batch - new batch size to be used by all the following inference calls for this request.
      */
     virtual void SetBatch(int batch) = 0;
+
+    /**
+     * @brief Sets the priority of the request over the requests of the same and other executable networks.
+     * @param priority - new priority to be used by all the following inference calls for this request.
+     */
+    virtual void SetPriority(int priority) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -24,6 +24,36 @@ namespace InferenceEngine {
 
 namespace Builder {
 
+/**
+ * @brief Allocator which exposes the data of nGraph Constant operation and keeps the operation alive
+ * while the blob is used, so constants are not copied during conversion to CNNNetworkImpl
+ */
+class ConstAllocatorWrapper : public IAllocator {
+public:
+    explicit ConstAllocatorWrapper(std::shared_ptr<ngraph::op::Constant> constOp): _constOp(std::move(constOp)) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}  // NOLINT
+
+    void* alloc(size_t) noexcept override {
+        return const_cast<void*>(_constOp->get_data_ptr());
+    }
+
+    bool free(void*) noexcept override {  // NOLINT
+        return true;
+    }
+
+private:
+    std::shared_ptr<ngraph::op::Constant> _constOp;
+};
+
 class INodeConverter {
 public:
     virtual CNNLayer::Ptr createLayer(const std::shared_ptr<ngraph::Node>& layer) const = 0;
@@ -71,7 +101,9 @@ private:
         }
 
         TensorDesc td(dataPrecision, {shapeSize}, Layout::C);
-        return make_blob_with_precision(td, const_cast<void *>(constLayer->get_data_ptr()));
+        auto blob = make_blob_with_precision(td, shared_from_irelease(new ConstAllocatorWrapper(constLayer)));
+        blob->allocate();
+        return blob;
     }
 };
 
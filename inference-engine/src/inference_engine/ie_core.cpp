@@ -29,6 +29,7 @@
 #include "ie_profiling.hpp"
 #include "ie_util_internal.hpp"
 #include "multi-device/multi_device_config.hpp"
+#include "batch/batch_plugin_config.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -416,6 +417,9 @@ std::map<std::string, Version> Core::GetVersions(const std::string& deviceName)
         } else if (deviceName.find("MULTI") == 0) {
             deviceNames.push_back("MULTI");
             deviceNames = DeviceIDParser::getMultiDevices(deviceName.substr(6));
+        } else if (deviceName.find("BATCH:") == 0) {
+            deviceNames.push_back(deviceName.substr(6));
+            deviceNames.push_back("BATCH");
         } else {
             deviceNames.push_back(deviceName);
         }
@@ -455,6 +459,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[InferenceEngine::BatchConfigParams::KEY_BATCH_DEVICE] = deviceName.substr(6);
     } else {
         DeviceIDParser parser(deviceName_);
         deviceName_ = parser.getDeviceName();
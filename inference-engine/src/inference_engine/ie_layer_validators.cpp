@@ -2119,6 +2119,24 @@ void CTCGreedyDecoderValidator::checkShapes(const CNNLayer* layer, const std::ve
 
 CTCGreedyDecoderValidator::CTCGreedyDecoderValidator(const std::string& _type): LayerValidator(_type) {}
 
+void CTCBeamSearchDecoderValidator::checkParams(const CNNLayer* layer) {
+    // Throws for the values which are not boolean
+    layer->GetParamAsBool("ctc_merge_repeated", true);
+    if (layer->GetParamAsInt("beam_width", 10) < 1) {
+        THROW_IE_EXCEPTION << "CTCBeamSearchDecoder layer parameter beam_width should be positive";
+    }
+    float pruneThreshold = layer->GetParamAsFloat("prune_threshold", 0.0f);
+    if (pruneThreshold < 0.0f || pruneThreshold > 1.0f) {
+        THROW_IE_EXCEPTION << "CTCBeamSearchDecoder layer parameter prune_threshold should be in [0, 1] range";
+    }
+}
+
+void CTCBeamSearchDecoderValidator::checkShapes(const CNNLayer* layer, const std::vector<SizeVector>& inShapes) const {
+    checkNumOfInput(inShapes, {1, 2});
+}
+
+CTCBeamSearchDecoderValidator::CTCBeamSearchDecoderValidator(const std::string& _type): LayerValidator(_type) {}
+
 void DetectionOutputValidator::parseParams(CNNLayer* layer) {
     unsigned int num_classes = layer->GetParamAsUInt("num_classes");
     if (num_classes == 0) {
@@ -3016,6 +3034,7 @@ LayerValidators::LayerValidators() {
     REG_LAYER_VALIDATOR_FOR_TYPE(ArgMaxValidator, ArgMax);
     REG_LAYER_VALIDATOR_FOR_TYPE(BatchNormalizationValidator, BatchNormalization);
     REG_LAYER_VALIDATOR_FOR_TYPE(CTCGreedyDecoderValidator, CTCGreedyDecoder);
+    REG_LAYER_VALIDATOR_FOR_TYPE(CTCBeamSearchDecoderValidator, CTCBeamSearchDecoder);
     REG_LAYER_VALIDATOR_FOR_TYPE(ClampValidator, Clamp);
     REG_LAYER_VALIDATOR_FOR_TYPE(ConcatValidator, Concat);
     REG_LAYER_VALIDATOR_FOR_TYPE(ConstValidator, Const);
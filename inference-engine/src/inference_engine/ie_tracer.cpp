@@ -0,0 +1,166 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_tracer.hpp"
+
+#include <details/ie_exception.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <utility>
+
+namespace InferenceEngine {
+
+namespace {
+
+void writeEscaped(std::ostream& out, const std::string& value) {
+    for (char c : value) {
+        switch (c) {
+        case '"':
+            out << "\\\"";
+            break;
+        case '\\':
+            out << "\\\\";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec
+                    << std::setfill(' ');
+            } else {
+                out << c;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+constexpr size_t Tracer::eventsPerThread;
+
+Tracer::Tracer(): _start(std::chrono::steady_clock::now()) {}
+
+Tracer& Tracer::getInstance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+int Tracer::startSession() {
+    return ++_lastSession;
+}
+
+void Tracer::endSession(int session) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& buffer : _buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        std::vector<TraceEvent> kept;
+        for (size_t i = 0; i < buffer->events.size(); i++) {
+            auto& event = buffer->events[(buffer->next + i) % buffer->events.size()];
+            if (event.session != session)
+                kept.push_back(std::move(event));
+        }
+        buffer->events.swap(kept);
+        buffer->next = 0;
+    }
+
+    // Only the tracer refers to the buffers of the finished threads, they are released once nothing is left in them
+    _buffers.erase(std::remove_if(_buffers.begin(), _buffers.end(), [](const std::shared_ptr<ThreadBuffer>& buffer) {
+        return buffer.use_count() == 1 && buffer->events.empty();
+    }), _buffers.end());
+}
+
+int64_t Tracer::now() const noexcept {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _start).count();
+}
+
+Tracer::ThreadBuffer& Tracer::getThreadBuffer() {
+    // The tracer keeps the buffers of the finished threads until their events are written
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        buffer->threadId = ++_lastThreadId;
+        std::lock_guard<std::mutex> lock(_mutex);
+        _buffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void Tracer::addEvent(int session, const char* category, const std::string& name, int64_t begin, int64_t end,
+                      int stream) {
+    if (session == 0)
+        return;
+
+    auto& buffer = getThreadBuffer();
+    // The lock is taken by other threads only while the trace is written or a session ends
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    TraceEvent* event = nullptr;
+    if (buffer.events.size() < eventsPerThread) {
+        buffer.events.emplace_back();
+        event = &buffer.events.back();
+    } else {
+        event = &buffer.events[buffer.next];
+        buffer.next = (buffer.next + 1) % eventsPerThread;
+    }
+    // Names of the overwritten events are reused, so the steady state does not allocate
+    event->name.assign(name);
+    event->category = category;
+    event->begin = begin;
+    event->duration = end - begin;
+    event->stream = stream;
+    event->session = session;
+}
+
+void Tracer::write(int session, std::ostream& out) const {
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        buffers = _buffers;
+    }
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    const char* separator = "\n";
+    for (auto& buffer : buffers) {
+        std::lock_guard<std::mutex> lock(buffer->mutex);
+        for (size_t i = 0; i < buffer->events.size(); i++) {
+            auto& event = buffer->events[(buffer->next + i) % buffer->events.size()];
+            if (event.session != session)
+                continue;
+            out << separator << "{\"name\":\"";
+            writeEscaped(out, event.name);
+            out << "\",\"cat\":\"" << event.category << "\",\"ph\":\"X\",\"ts\":" << event.begin
+                << ",\"dur\":" << event.duration << ",\"pid\":1,\"tid\":" << buffer->threadId;
+            if (event.stream >= 0) {
+                out << ",\"args\":{\"stream\":" << event.stream << "}";
+            }
+            out << "}";
+            separator = ",\n";
+        }
+    }
+    out << "\n]}\n";
+}
+
+void Tracer::write(int session, const std::string& file) const {
+    std::ofstream out(file);
+    if (!out.is_open()) {
+        THROW_IE_EXCEPTION << "Cannot open trace file " << file;
+    }
+    write(session, out);
+}
+
+size_t Tracer::getBuffersCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _buffers.size();
+}
+
+void Tracer::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& buffer : _buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        buffer->events.clear();
+        buffer->next = 0;
+    }
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Built-in tracer of the inference execution which does not need ITT or VTune
+ * @file ie_tracer.hpp
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Interval of the timeline, the times are in microseconds since the creation of the tracer
+ */
+struct TraceEvent {
+    std::string name;
+    const char* category = nullptr;
+    int64_t begin = 0;
+    int64_t duration = 0;
+    // Stream of the plugin which executed the interval, negative if it is not known
+    int stream = -1;
+    // Session the event was recorded for
+    int session = 0;
+};
+
+/**
+ * @class Tracer
+ * @brief Collects the timeline of pipeline stages, preprocessing and graph nodes into per thread ring buffers
+ *        and writes it in Chrome trace event format, which is opened by chrome://tracing or Perfetto UI.
+ *        Buffers keep the last eventsPerThread events of every thread. Events belong to sessions: every executable
+ *        network loaded with KEY_TRACE_FILE has its own one and writes only its events. Nothing is recorded for
+ *        session 0, which is used by the networks without tracing.
+ */
+class INFERENCE_ENGINE_API_CLASS(Tracer) {
+public:
+    static constexpr size_t eventsPerThread = 1 << 16;
+
+    static Tracer& getInstance();
+
+    Tracer(Tracer const&) = delete;
+
+    void operator=(Tracer const&) = delete;
+
+    /**
+     * @brief Starts a new session
+     * @return Non-zero identifier of the session
+     */
+    int startSession();
+
+    /**
+     * @brief Drops the events of the session and the buffers of the finished threads which became empty
+     */
+    void endSession(int session);
+
+    /**
+     * @brief Returns current time in microseconds since the creation of the tracer
+     */
+    int64_t now() const noexcept;
+
+    /**
+     * @brief Records the interval of the session into the buffer of the calling thread, does nothing for session 0
+     */
+    void addEvent(int session, const char* category, const std::string& name, int64_t begin, int64_t end,
+                  int stream = -1);
+
+    /**
+     * @brief Writes the buffered events of the session as a Chrome trace JSON
+     */
+    void write(int session, std::ostream& out) const;
+
+    void write(int session, const std::string& file) const;
+
+    /**
+     * @brief Returns the number of per thread buffers kept by the tracer
+     */
+    size_t getBuffersCount() const;
+
+    void clear();
+
+private:
+    struct ThreadBuffer {
+        std::mutex mutex;
+        std::vector<TraceEvent> events;
+        // Position of the oldest event once the buffer is full
+        size_t next = 0;
+        int threadId = 0;
+    };
+
+    Tracer();
+
+    ThreadBuffer& getThreadBuffer();
+
+    std::atomic<int> _lastSession {0};
+    std::atomic<int> _lastThreadId {0};
+    std::chrono::steady_clock::time_point _start;
+    mutable std::mutex _mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+};
+
+/**
+ * @class TraceScope
+ * @brief Records the lifetime of the scope as an event of the session, does nothing for session 0
+ */
+class TraceScope {
+public:
+    TraceScope(int session, const char* category, const std::string& name, int stream = -1) {
+        if (session != 0) {
+            _session = session;
+            _category = category;
+            _name = name;
+            _stream = stream;
+            _begin = Tracer::getInstance().now();
+        }
+    }
+
+    ~TraceScope() {
+        if (_session != 0) {
+            auto& tracer = Tracer::getInstance();
+            tracer.addEvent(_session, _category, _name, _begin, tracer.now(), _stream);
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    int _session = 0;
+    const char* _category = nullptr;
+    std::string _name;
+    int64_t _begin = 0;
+    int _stream = -1;
+};
+
+}  // namespace InferenceEngine
@@ -170,6 +170,7 @@ REG_SHAPE_INFER_FOR_TYPE(EltWiseShapeProp, Mul);
 REG_SHAPE_INFER_FOR_TYPE(EltWiseShapeProp, Add);
 REG_SHAPE_INFER_FOR_TYPE(EltWiseShapeProp, Div);
 REG_SHAPE_INFER_FOR_TYPE(CTCGreedyDecoderShapeProp, CTCGreedyDecoder);
+REG_SHAPE_INFER_FOR_TYPE(CTCGreedyDecoderShapeProp, CTCBeamSearchDecoder);
 REG_SHAPE_INFER_FOR_TYPE(ProposalShapeProp, Proposal);
 REG_SHAPE_INFER_FOR_TYPE(ReorgYoloShapeProp, ReorgYolo);
 REG_SHAPE_INFER_FOR_TYPE(RegionYoloShapeProp, RegionYolo);
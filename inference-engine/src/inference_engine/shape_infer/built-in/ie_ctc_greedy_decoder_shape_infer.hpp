@@ -15,7 +15,7 @@ namespace InferenceEngine {
 namespace ShapeInfer {
 
 /**
- *@brief Implementation of Shape inference for CTCGreedyDecoder layer
+ *@brief Implementation of Shape inference for CTCGreedyDecoder and CTCBeamSearchDecoder layers
  */
 class CTCGreedyDecoderShapeProp : public BuiltInShapeInferImpl {
 public:
@@ -121,6 +121,63 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
             dumpQuantizedGraphToIr = val;
+        } else if (key == PluginConfigParams::KEY_CPU_AUTOTUNING) {
+            if (val == PluginConfigParams::YES) autoTuning = true;
+            else if (val == PluginConfigParams::NO) autoTuning = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_AUTOTUNING
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_TUNING_CACHE_FILE) {
+            // empty string means that the cache is not used
+            tuningCacheFile = val;
+        } else if (key == PluginConfigParams::KEY_CPU_HUGE_PAGES) {
+            if (val == PluginConfigParams::NO)
+                hugePages = HugePagesMode::Disabled;
+            else if (val == PluginConfigParams::CPU_HUGE_PAGES_TRANSPARENT)
+                hugePages = HugePagesMode::Transparent;
+            else if (val == PluginConfigParams::CPU_HUGE_PAGES_EXPLICIT)
+                hugePages = HugePagesMode::Explicit;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_HUGE_PAGES
+                                   << ". Expected only NO/CPU_HUGE_PAGES_TRANSPARENT/CPU_HUGE_PAGES_EXPLICIT";
+        } else if (key == PluginConfigParams::KEY_CPU_LATENCY_SAMPLING_PERIOD) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_LATENCY_SAMPLING_PERIOD
+                                   << ". Expected only non-negative numbers (period of sampling, 0 disables it)";
+            latencySamplingPeriod = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_LATENCY_DUMP_FILE) {
+            // empty string means that the histograms are not dumped
+            latencyDumpFile = val;
+        } else if (key == PluginConfigParams::KEY_CPU_LATENCY_DUMP_INTERVAL) {
+            int val_i = 0;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i <= 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_LATENCY_DUMP_INTERVAL
+                                   << ". Expected only positive numbers (seconds)";
+            latencyDumpInterval = val_i;
+        } else if (key == PluginConfigParams::KEY_TRACE_FILE) {
+            // empty string means that the tracing is disabled
+            traceFile = val;
+        } else if (key == PluginConfigParams::KEY_CPU_PRIORITY) {
+            size_t parsed = 0;
+            int val_i = 0;
+            try {
+                val_i = std::stoi(val, &parsed);
+            } catch (const std::exception&) {
+            }
+            // values with trailing characters like "1.5" are rejected too
+            if (parsed == 0 || parsed != val.size())
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PRIORITY
+                                   << ". Expected only integer numbers";
+            priority = val_i;
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
@@ -154,6 +211,22 @@ void Config::updateProperties() {
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(throughputStreams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(threadsNum) });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
+        if (autoTuning == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_AUTOTUNING, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_AUTOTUNING, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_TUNING_CACHE_FILE, tuningCacheFile });
+        if (hugePages == HugePagesMode::Transparent)
+            _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::CPU_HUGE_PAGES_TRANSPARENT });
+        else if (hugePages == HugePagesMode::Explicit)
+            _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::CPU_HUGE_PAGES_EXPLICIT });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_LATENCY_SAMPLING_PERIOD, std::to_string(latencySamplingPeriod) });
+        _config.insert({ PluginConfigParams::KEY_CPU_LATENCY_DUMP_FILE, latencyDumpFile });
+        _config.insert({ PluginConfigParams::KEY_CPU_LATENCY_DUMP_INTERVAL, std::to_string(latencyDumpInterval) });
+        _config.insert({ PluginConfigParams::KEY_TRACE_FILE, traceFile });
+        _config.insert({ PluginConfigParams::KEY_CPU_PRIORITY, std::to_string(priority) });
     }
 }
 
@@ -19,6 +19,12 @@ struct Config {
         On,
     };
 
+    enum HugePagesMode {
+        Disabled,
+        Transparent,
+        Explicit,
+    };
+
     enum InferenceThreadsBinding {NONE, CORES, NUMA} useThreadBinding = CORES;
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
@@ -26,10 +32,18 @@ struct Config {
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
+    bool autoTuning = false;
+    std::string tuningCacheFile = "";
     int batchLimit = 0;
     int throughputStreams = 1;
     int threadsNum = 0;
     LPTransformsMode lpTransformsMode = LPTransformsMode::On;
+    HugePagesMode hugePages = HugePagesMode::Disabled;
+    int latencySamplingPeriod = 0;
+    std::string latencyDumpFile = "";
+    int latencyDumpInterval = 10;
+    std::string traceFile = "";
+    int priority = 0;
 
     void readProperties(const std::map<std::string, std::string> &config);
     void updateProperties();
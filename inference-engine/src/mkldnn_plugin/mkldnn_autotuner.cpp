@@ -0,0 +1,283 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_autotuner.h"
+
+#include <details/ie_cnn_network_iterator.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <map>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+MKLDNNAutoTuner::MKLDNNAutoTuner(const Config &cfg, const MKLDNNExtensionManager::Ptr& extMgr)
+        : config(cfg), extensionManager(extMgr) {
+    // Graphs created for benchmarking are not interesting for dumping
+    config.dumpToDot = "";
+}
+
+std::map<std::string, MKLDNNTunedChoice> MKLDNNAutoTuner::Tune(const ICNNNetwork &network) {
+    LoadCache();
+
+    std::map<std::string, MKLDNNTunedChoice> choices;
+    details::CNNNetworkIterator i(const_cast<ICNNNetwork *>(&network));
+    for (; i != details::CNNNetworkIterator(); i++) {
+        auto cached = cache.find(GetLayerKey(network, *i));
+        if (cached != cache.end())
+            choices[(*i)->name] = cached->second;
+    }
+    if (!config.autoTuning)
+        return choices;
+
+    auto defaultGraph = CreateGraph(network, choices);
+    NodeTimes defaultTimes = Measure(*defaultGraph);
+
+    // Nodes with several candidates which are not known from the cache
+    struct Candidates {
+        MKLDNNNodePtr node;
+        int defaultIndex;
+        std::vector<double> costs;
+        std::vector<std::string> impls;
+    };
+    std::map<std::string, Candidates> tunable;
+    size_t rounds = 0;
+    for (auto &node : defaultGraph->GetNodes()) {
+        auto &supportedPrimitiveDescriptors = node->getSupportedPrimitiveDescriptors();
+        if (node->getType() == Input || node->getType() == Output || node->getType() == Reorder ||
+            !node->getCnnLayer() || node->isConstant() || supportedPrimitiveDescriptors.size() < 2 ||
+            choices.find(node->getName()) != choices.end())
+            continue;
+
+        Candidates &candidates = tunable[node->getName()];
+        candidates.node = node;
+        candidates.defaultIndex = static_cast<int>(node->getSelectedPrimitiveDescriptor() - &supportedPrimitiveDescriptors[0]);
+        candidates.costs.assign(supportedPrimitiveDescriptors.size(), std::numeric_limits<double>::max());
+        candidates.impls.resize(supportedPrimitiveDescriptors.size());
+        candidates.costs[candidates.defaultIndex] = GetNodeCost(node, defaultTimes);
+        candidates.impls[candidates.defaultIndex] = node->getPrimitiveDescriptorType();
+        rounds = std::max(rounds, supportedPrimitiveDescriptors.size());
+    }
+
+    // Every round forces the same candidate index for all the nodes, so the number of graphs to benchmark
+    // is limited by the largest number of candidates rather than by the size of the network
+    for (size_t r = 0; r < rounds; r++) {
+        std::map<std::string, MKLDNNTunedChoice> roundChoices = choices;
+        for (auto &item : tunable) {
+            auto &candidates = item.second;
+            if (r >= candidates.costs.size() || static_cast<int>(r) == candidates.defaultIndex)
+                continue;
+            MKLDNNTunedChoice choice;
+            choice.index = static_cast<int>(r);
+            choice.implType = candidates.node->getSupportedPrimitiveDescriptors()[r].getImplementationType();
+            roundChoices[item.first] = choice;
+        }
+        if (roundChoices.size() == choices.size())
+            continue;
+
+        MKLDNNGraph::Ptr graph;
+        NodeTimes times;
+        try {
+            graph = CreateGraph(network, roundChoices);
+            times = Measure(*graph);
+        } catch (const std::exception&) {
+            // Some candidates cannot be combined with the neighbours, they are just not considered
+            continue;
+        }
+
+        for (auto &node : graph->GetNodes()) {
+            auto candidates = tunable.find(node->getName());
+            if (candidates == tunable.end() || roundChoices.find(node->getName()) == roundChoices.end())
+                continue;
+            auto &supportedPrimitiveDescriptors = node->getSupportedPrimitiveDescriptors();
+            if (node->getSelectedPrimitiveDescriptor() != &supportedPrimitiveDescriptors[r])
+                continue;
+            candidates->second.costs[r] = GetNodeCost(node, times);
+            candidates->second.impls[r] = node->getPrimitiveDescriptorType();
+        }
+    }
+
+    std::map<std::string, MKLDNNTunedChoice> tuned = choices;
+    bool changed = false;
+    for (auto &item : tunable) {
+        auto &candidates = item.second;
+        int best = static_cast<int>(std::min_element(candidates.costs.begin(), candidates.costs.end()) - candidates.costs.begin());
+
+        MKLDNNTunedChoice choice;
+        choice.index = best;
+        choice.implType = candidates.node->getSupportedPrimitiveDescriptors()[best].getImplementationType();
+        choice.defaultImpl = candidates.impls[candidates.defaultIndex];
+        choice.tunedImpl = candidates.impls[best];
+        choice.defaultTime = candidates.costs[candidates.defaultIndex];
+        choice.tunedTime = candidates.costs[best];
+        tuned[item.first] = choice;
+        changed |= best != candidates.defaultIndex;
+    }
+
+    // Nodes were measured with the different neighbours, so the whole graph is checked to not become slower
+    if (changed) {
+        auto getTotal = [](const NodeTimes &times) {
+            double total = 0;
+            for (auto &time : times)
+                total += time.second;
+            return total;
+        };
+
+        bool slower = true;
+        try {
+            auto tunedGraph = CreateGraph(network, tuned);
+            slower = getTotal(Measure(*tunedGraph)) > getTotal(defaultTimes);
+        } catch (const std::exception&) {
+        }
+
+        if (slower) {
+            for (auto &item : tunable) {
+                auto &candidates = item.second;
+                MKLDNNTunedChoice &choice = tuned[item.first];
+                choice.index = candidates.defaultIndex;
+                choice.implType = candidates.node->getSupportedPrimitiveDescriptors()[candidates.defaultIndex].getImplementationType();
+                choice.tunedImpl = choice.defaultImpl;
+                choice.tunedTime = choice.defaultTime;
+            }
+        }
+    }
+
+    for (auto &item : tunable)
+        cache[GetLayerKey(network, item.second.node->getCnnLayer())] = tuned[item.first];
+    SaveCache();
+
+    return tuned;
+}
+
+MKLDNNGraph::Ptr MKLDNNAutoTuner::CreateGraph(const ICNNNetwork &network,
+                                              const std::map<std::string, MKLDNNTunedChoice> &choices) const {
+    auto graph = std::make_shared<MKLDNNGraph>();
+    graph->setConfig(config);
+    graph->setTunedChoices(choices);
+    graph->CreateGraph(network, extensionManager);
+    return graph;
+}
+
+MKLDNNAutoTuner::NodeTimes MKLDNNAutoTuner::Measure(MKLDNNGraph &graph) const {
+    // Uninitialized inputs may contain denormals or NaNs which distort timings
+    BlobMap inputs;
+    graph.getInputBlobs(inputs);
+    for (auto &input : inputs)
+        std::memset(input.second->buffer(), 0, input.second->byteSize());
+
+    NodeTimes times;
+    mkldnn::stream stream(mkldnn::stream::kind::eager);
+    for (int i = 0; i < warmupIterations + measureIterations; i++) {
+        for (auto &node : graph.GetNodes()) {
+            if (node->isConstant())
+                continue;
+
+            auto start = std::chrono::high_resolution_clock::now();
+            node->execute(stream);
+            auto finish = std::chrono::high_resolution_clock::now();
+
+            if (i >= warmupIterations)
+                times[node->getName()] += std::chrono::duration<double, std::micro>(finish - start).count() / measureIterations;
+        }
+    }
+    return times;
+}
+
+double MKLDNNAutoTuner::GetNodeCost(const MKLDNNNodePtr &node, const NodeTimes &times) {
+    auto getTime = [&](const MKLDNNNodePtr &n) {
+        auto time = times.find(n->getName());
+        return time != times.end() ? time->second : 0.0;
+    };
+
+    // Layouts of the candidate decide which reorders are inserted around the node
+    double cost = getTime(node);
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        auto parent = node->getParentEdgeAt(i)->getParent();
+        if (parent->getType() == Reorder)
+            cost += getTime(parent);
+    }
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        auto child = node->getChildEdgeAt(i)->getChild();
+        if (child->getType() == Reorder)
+            cost += getTime(child);
+    }
+    return cost;
+}
+
+std::string MKLDNNAutoTuner::GetLayerKey(const ICNNNetwork &network, const CNNLayerPtr &layer) {
+    std::ostringstream key;
+    key << network.getName() << "/" << layer->name;
+    for (auto &data : layer->insData) {
+        const TensorDesc &desc = data.lock()->getTensorDesc();
+        key << ":" << desc.getPrecision().name();
+        for (size_t d = 0; d < desc.getDims().size(); d++)
+            key << (d ? "x" : "_") << desc.getDims()[d];
+    }
+    return key.str();
+}
+
+void MKLDNNAutoTuner::LoadCache() {
+    cache.clear();
+    if (config.tuningCacheFile.empty())
+        return;
+
+    std::ifstream file(config.tuningCacheFile);
+    if (!file.is_open())
+        return;
+
+    // Tab separated lines: key, index, implementation type, default and tuned implementations and their times.
+    // A file which cannot be parsed is treated as empty, it is rewritten once the network is tuned.
+    std::map<std::string, MKLDNNTunedChoice> loaded;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty())
+            continue;
+
+        std::vector<std::string> fields;
+        std::istringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, '\t'))
+            fields.push_back(field);
+        if (fields.size() != 7)
+            return;
+
+        MKLDNNTunedChoice choice;
+        try {
+            choice.index = std::stoi(fields[1]);
+            choice.implType = static_cast<impl_desc_type>(std::stoi(fields[2]));
+            choice.defaultImpl = fields[3];
+            choice.tunedImpl = fields[4];
+            choice.defaultTime = std::stod(fields[5]);
+            choice.tunedTime = std::stod(fields[6]);
+        } catch (const std::exception&) {
+            return;
+        }
+        loaded[fields[0]] = choice;
+    }
+    cache = std::move(loaded);
+}
+
+void MKLDNNAutoTuner::SaveCache() const {
+    if (config.tuningCacheFile.empty())
+        return;
+
+    std::ofstream file(config.tuningCacheFile);
+    if (!file.is_open())
+        THROW_IE_EXCEPTION << "Cannot write tuning cache file " << config.tuningCacheFile;
+
+    for (auto &item : cache) {
+        const MKLDNNTunedChoice &choice = item.second;
+        file << item.first << "\t" << choice.index << "\t" << static_cast<int>(choice.implType) << "\t"
+             << choice.defaultImpl << "\t" << choice.tunedImpl << "\t"
+             << choice.defaultTime << "\t" << choice.tunedTime << "\n";
+    }
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "config.h"
+#include "mkldnn_graph.h"
+#include "mkldnn_extension_mngr.h"
+
+#include <ie_icnn_network.hpp>
+#include <map>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Chooses primitive descriptors of the graph nodes by benchmarking instead of the fixed implementations priority.
+ * Every candidate of a node is measured together with the reorders it induces around the node. Results are
+ * kept in the tuning cache file, so the subsequent network loadings skip benchmarking of the known nodes.
+ */
+class MKLDNNAutoTuner {
+public:
+    MKLDNNAutoTuner(const Config &config, const MKLDNNExtensionManager::Ptr& extMgr);
+
+    // Returns choices to be passed to MKLDNNGraph::setTunedChoices, keyed by node name
+    std::map<std::string, MKLDNNTunedChoice> Tune(const InferenceEngine::ICNNNetwork &network);
+
+private:
+    typedef std::map<std::string, double> NodeTimes;
+
+    void LoadCache();
+    void SaveCache() const;
+
+    MKLDNNGraph::Ptr CreateGraph(const InferenceEngine::ICNNNetwork &network,
+                                 const std::map<std::string, MKLDNNTunedChoice> &choices) const;
+    NodeTimes Measure(MKLDNNGraph &graph) const;
+
+    static std::string GetLayerKey(const InferenceEngine::ICNNNetwork &network, const InferenceEngine::CNNLayerPtr &layer);
+    static double GetNodeCost(const MKLDNNNodePtr &node, const NodeTimes &times);
+
+    Config config;
+    MKLDNNExtensionManager::Ptr extensionManager;
+    std::map<std::string, MKLDNNTunedChoice> cache;
+
+    static constexpr int warmupIterations = 2;
+    static constexpr int measureIterations = 10;
+};
+
+}  // namespace MKLDNNPlugin
@@ -10,7 +10,9 @@
 #include "mkldnn_async_infer_request.h"
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
+#include "mkldnn_autotuner.h"
 #include <ie_util_internal.hpp>
+#include <ie_tracer.hpp>
 #include <graph_tools.hpp>
 #include <cnn_network_int8_normalizer.hpp>
 #include <cpp_interfaces/ie_executor_manager.hpp>
@@ -21,6 +23,9 @@
 #include "low_precision_transformations/transformer.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <future>
 #include <unordered_set>
 
 using namespace MKLDNNPlugin;
@@ -32,19 +37,32 @@ using namespace InferenceEngine::details;
 InferenceEngine::InferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                           InferenceEngine::OutputsDataMap networkOutputs) {
+    InferenceEngine::InferRequestInternal::Ptr request;
     if (graphs.size() > 1)  // streams uses special requests that are not connected to graphs
-        return std::make_shared<MKLDNNGraphlessInferRequest>(networkInputs, networkOutputs);
+        request = std::make_shared<MKLDNNGraphlessInferRequest>(networkInputs, networkOutputs);
     else
-        return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs);
+        request = std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs);
+    // the network priority is the default one of its requests
+    request->SetPriority(graphs[0]->getProperty().priority);
+    request->setTraceSession(traceSession);
+    return request;
 }
 
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr) : extensionManager(extMgr) {
+    auto getElapsed = [](std::chrono::high_resolution_clock::time_point start) {
+        return std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    };
+    auto transformationsStart = std::chrono::high_resolution_clock::now();
+
     ICNNNetworkStats* pstats = nullptr;
     StatusCode s = network.getStats(&pstats, nullptr);
     // we are cloning network if we have statistics and we can transform network.
+    // The network read from IR v10 is converted from nGraph function here
     auto clonedNetwork = cloneNet(network);
+    loadPhases["ConvertNetwork"] = getElapsed(transformationsStart);
+    transformationsStart = std::chrono::high_resolution_clock::now();
 
     if (Precision::FP16 == network.getPrecision()) {
         clonedNetwork->setPrecision(Precision::FP32);
@@ -87,6 +105,16 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
             THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
         }
     }
+    loadPhases["NetworkTransformations"] = getElapsed(transformationsStart);
+
+    std::map<std::string, MKLDNNTunedChoice> tunedChoices;
+    if (cfg.autoTuning || !cfg.tuningCacheFile.empty()) {
+        auto tuningStart = std::chrono::high_resolution_clock::now();
+        MKLDNNAutoTuner tuner(cfg, extensionManager);
+        tunedChoices = tuner.Tune(*clonedNetwork);
+        loadPhases["AutoTuning"] = getElapsed(tuningStart);
+    }
+
     // general #threads logic
     const int env_threads = parallel_get_env_threads();
     const auto& numa_nodes = MKLDNNPlugin::cpu::getAvailableNUMANodes();
@@ -98,20 +126,59 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     const int threads_per_stream = std::max(1, threads/cfg.throughputStreams);
 
     // graph(s) initialization in taskExecutor threads (streams), in parallel (in case of streams)
+    // The first stream optimizes the graph, the others wait for its snapshot and only create memory and primitives
+    std::promise<MKLDNNGraphSnapshot::CPtr> snapshotPromise;
+    std::shared_future<MKLDNNGraphSnapshot::CPtr> snapshotFuture = snapshotPromise.get_future().share();
+    const bool shareSnapshot = cfg.throughputStreams > 1;
+
+    if (!cfg.traceFile.empty())
+        traceSession = InferenceEngine::Tracer::getInstance().startSession();
+
     std::vector<Task> tasks;
     const int workers_per_socket = std::max(1,
             static_cast<int>(std::ceil(static_cast<float>(cfg.throughputStreams)/numa_nodes_num)));
     for (int n = 0; n < cfg.throughputStreams; n++) {
         MKLDNNGraph::Ptr _graph = std::make_shared<MKLDNNGraph>();
         graphs.push_back(_graph);
-        tasks.push_back([=, &cfg, &clonedNetwork]() {
+        tasks.push_back([=, &cfg, &clonedNetwork, &snapshotPromise]() {
         _graph->setConfig(cfg);
+        _graph->setStreamId(n);
+        _graph->setTraceSession(traceSession);
+        _graph->setTunedChoices(tunedChoices);
          const int node = n / workers_per_socket;
          if (cfg.useThreadBinding)
             pin_current_thread_to_socket(numa_nodes[node]);
+        auto load = [&]() {
+            const ICNNNetwork &network = *clonedNetwork;
+            if (!shareSnapshot) {
+                _graph->CreateGraph(network, extensionManager, numa_nodes[node]);
+            } else if (n == 0) {
+                // Other streams must not wait forever if the snapshot can't be taken
+                bool published = false;
+                _graph->setSnapshotHandler([&](const MKLDNNGraphSnapshot::CPtr &snapshot) {
+                    snapshotPromise.set_value(snapshot);
+                    published = true;
+                });
+                try {
+                    _graph->CreateGraph(network, extensionManager, numa_nodes[node]);
+                } catch (...) {
+                    if (!published)
+                        snapshotPromise.set_exception(std::current_exception());
+                    throw;
+                }
+                _graph->setSnapshotHandler(nullptr);
+                if (!published)
+                    snapshotPromise.set_value(nullptr);
+            } else {
+                auto snapshot = snapshotFuture.get();
+                if (snapshot)
+                    _graph->CreateGraph(snapshot, numa_nodes[node]);
+                else
+                    _graph->CreateGraph(network, extensionManager, numa_nodes[node]);
+            }
+        };
         _graph->CreateArenaWithObserverAndLoadGraph(threads_per_stream, numa_nodes[node], n,
-                cfg.useThreadBinding,
-                clonedNetwork, extensionManager);
+                cfg.useThreadBinding, load);
         if (cfg.throughputStreams > 1)  // for streams, each worker thread has it's own graph
             MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph = _graph;
         });
@@ -129,6 +196,11 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         _taskExecutor->runAndWait(tasks);
     }
 
+    for (size_t n = 0; n < graphs.size(); n++) {
+        for (auto &phase : graphs[n]->GetLoadPhases())
+            loadPhases["stream" + std::to_string(n) + "/" + phase.name] += static_cast<float>(phase.time / 1000);
+    }
+
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
@@ -147,6 +219,74 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
             }
         }
     }
+
+    if (cfg.latencySamplingPeriod > 0 && !cfg.latencyDumpFile.empty()) {
+        auto file = cfg.latencyDumpFile;
+        auto interval = std::chrono::seconds(cfg.latencyDumpInterval);
+        latencyDumpThread = std::thread([this, file, interval] {
+            std::unique_lock<std::mutex> lock(latencyDumpMutex);
+            while (!latencyDumpCondition.wait_for(lock, interval, [this] { return latencyDumpStopped; }))
+                DumpLatencyHistograms(file);
+            // The samples collected after the last period are not lost
+            DumpLatencyHistograms(file);
+        });
+    }
+}
+
+MKLDNNExecNetwork::~MKLDNNExecNetwork() {
+    if (latencyDumpThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(latencyDumpMutex);
+            latencyDumpStopped = true;
+        }
+        latencyDumpCondition.notify_one();
+        latencyDumpThread.join();
+    }
+    if (traceSession != 0) {
+        auto& tracer = InferenceEngine::Tracer::getInstance();
+        try {
+            tracer.write(traceSession, graphs[0]->getProperty().traceFile);
+        } catch (...) {
+        }
+        tracer.endSession(traceSession);
+    }
+    graphs.clear();
+    extensionManager.reset();
+}
+
+std::map<std::string, MKLDNNLatencyHistogram::Counts> MKLDNNExecNetwork::GetLatencyHistograms() const {
+    std::map<std::string, MKLDNNLatencyHistogram::Counts> histograms;
+    for (auto &graph : graphs)
+        graph->GetLatencyHistograms(histograms);
+    return histograms;
+}
+
+void MKLDNNExecNetwork::DumpLatencyHistograms(const std::string &file) const {
+    std::ofstream out(file);
+    if (!out.is_open())
+        return;
+
+    // Tab separated lines: node name, number of samples, percentiles and the non-empty buckets, all in microseconds
+    out << "# node\tsamples\tp50\tp90\tp99\tp99.9\tmax\tbuckets (upper bound:samples)\n";
+    for (auto &histogram : GetLatencyHistograms()) {
+        auto &counts = histogram.second;
+        uint64_t samples = 0;
+        for (auto count : counts)
+            samples += count;
+
+        out << histogram.first << "\t" << samples;
+        for (double percentile : {50.0, 90.0, 99.0, 99.9, 100.0})
+            out << "\t" << MKLDNNLatencyHistogram::getPercentile(counts, percentile) / 1000.0;
+        out << "\t";
+        const char *separator = "";
+        for (size_t i = 0; i < counts.size(); i++) {
+            if (counts[i] == 0)
+                continue;
+            out << separator << MKLDNNLatencyHistogram::getUpperBound(static_cast<int>(i)) / 1000.0 << ":" << counts[i];
+            separator = ",";
+        }
+        out << "\n";
+    }
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
@@ -194,6 +334,9 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(CPU_LOAD_PHASES));
+        metrics.push_back(METRIC_KEY(CPU_NODE_LATENCY_HISTOGRAMS));
+        metrics.push_back(METRIC_KEY(CPU_ELIMINATED_DATA_MOVEMENT));
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -206,6 +349,23 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         auto option = engConfig._config.find(CONFIG_KEY(CPU_THROUGHPUT_STREAMS));
         IE_ASSERT(option != engConfig._config.end());
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(std::stoi(option->second)));
+    } else if (name == METRIC_KEY(CPU_LOAD_PHASES)) {
+        result = IE_SET_METRIC(CPU_LOAD_PHASES, loadPhases);
+    } else if (name == METRIC_KEY(CPU_NODE_LATENCY_HISTOGRAMS)) {
+        std::map<std::string, std::map<float, uint64_t>> histograms;
+        for (auto &histogram : GetLatencyHistograms()) {
+            auto &buckets = histograms[histogram.first];
+            for (size_t i = 0; i < histogram.second.size(); i++) {
+                if (histogram.second[i] != 0)
+                    buckets[MKLDNNLatencyHistogram::getUpperBound(static_cast<int>(i)) / 1000.0f] = histogram.second[i];
+            }
+        }
+        result = IE_SET_METRIC(CPU_NODE_LATENCY_HISTOGRAMS, histograms);
+    } else if (name == METRIC_KEY(CPU_ELIMINATED_DATA_MOVEMENT)) {
+        std::map<std::string, uint64_t> eliminated;
+        for (auto &item : graphs[0]->GetEliminatedBytes())
+            eliminated[item.first] = item.second;
+        result = IE_SET_METRIC(CPU_ELIMINATED_DATA_MOVEMENT, eliminated);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
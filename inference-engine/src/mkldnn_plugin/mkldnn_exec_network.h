@@ -13,6 +13,9 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 namespace MKLDNNPlugin {
 
@@ -29,10 +32,7 @@ public:
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
                       const MKLDNNExtensionManager::Ptr& extMgr);
 
-    virtual ~MKLDNNExecNetwork() {
-        graphs.clear();
-        extensionManager.reset();
-    }
+    virtual ~MKLDNNExecNetwork();
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -48,8 +48,20 @@ protected:
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<MKLDNNGraph::Ptr> graphs;
     std::vector<IMemoryStateInternal::Ptr> memoryStates;
+    // Durations of the loading phases in milliseconds, reported by the CPU_LOAD_PHASES metric
+    std::map<std::string, float> loadPhases;
+    // Session of the Tracer the graphs and requests record to, 0 if TRACE_FILE is not set
+    int traceSession = 0;
+
+    // Writes the latency histograms to the CPU_LATENCY_DUMP_FILE every CPU_LATENCY_DUMP_INTERVAL seconds
+    std::thread latencyDumpThread;
+    std::mutex latencyDumpMutex;
+    std::condition_variable latencyDumpCondition;
+    bool latencyDumpStopped = false;
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
+    std::map<std::string, MKLDNNLatencyHistogram::Counts> GetLatencyHistograms() const;
+    void DumpLatencyHistograms(const std::string &file) const;
 };
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
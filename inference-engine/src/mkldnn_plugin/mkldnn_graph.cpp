@@ -12,6 +12,9 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <chrono>
+#include <numeric>
+#include <functional>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -19,6 +22,8 @@
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
+#include "mkldnn_numa_allocator.h"
+#include "mkldnn_priority_scheduler.h"
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 
@@ -29,6 +34,7 @@
 #include <net_pass.h>
 #include <details/ie_cnn_network_tools.h>
 #include <ie_memcpy.h>
+#include <ie_tracer.hpp>
 
 #include <data_stats.h>
 #include "cnn_network_int8_normalizer.hpp"
@@ -92,12 +98,41 @@ void MKLDNNGraph::ApplyUnrollPasses(NET &net) {
 template void MKLDNNGraph::ApplyUnrollPasses(TensorIterator::Body&);
 template void MKLDNNGraph::ApplyUnrollPasses(ICNNNetwork&);
 
+namespace {
+
+// Appends the time spent in the scope to the load phases of the graph
+class LoadPhaseTimer {
+public:
+    LoadPhaseTimer(std::vector<MKLDNNLoadPhase> &phases, const std::string &name)
+            : phases(phases), name(name), start(std::chrono::high_resolution_clock::now()) {}
+
+    ~LoadPhaseTimer() {
+        auto finish = std::chrono::high_resolution_clock::now();
+        try {
+            phases.push_back({name, std::chrono::duration<double, std::micro>(finish - start).count()});
+        } catch (...) {
+        }
+    }
+
+private:
+    std::vector<MKLDNNLoadPhase> &phases;
+    std::string name;
+    std::chrono::high_resolution_clock::time_point start;
+};
+
+}  // namespace
+
 template<typename NET>
 void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr& extMgr, int _socket) {
     if (IsReady())
         ForgetGraphData();
+    loadPhases.clear();
     socket = _socket;
-    Replicate(net, extMgr);
+    allocator = CreateGraphAllocator(socket, config.hugePages);
+    {
+        LoadPhaseTimer timer(loadPhases, "Replicate");
+        Replicate(net, extMgr);
+    }
     InitGraph();
     status = Ready;
 }
@@ -333,26 +368,79 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
     }
 }
 
+void MKLDNNGraph::CreateGraph(const MKLDNNGraphSnapshot::CPtr &snapshot, int _socket) {
+    if (IsReady())
+        ForgetGraphData();
+    loadPhases.clear();
+    socket = _socket;
+    allocator = CreateGraphAllocator(socket, config.hugePages);
+    {
+        LoadPhaseTimer timer(loadPhases, "CopyNodes");
+        RestoreSnapshot(*snapshot);
+    }
+    CompleteGraph();
+    status = Ready;
+}
+
 void MKLDNNGraph::InitGraph() {
     SortTopologically();
     MKLDNNGraphOptimizer optimizer;
-    optimizer.ApplyCommonGraphOptimizations(*this);
-    SortTopologically();
+    {
+        LoadPhaseTimer timer(loadPhases, "GraphOptimizations");
+        optimizer.ApplyCommonGraphOptimizations(*this);
+        SortTopologically();
+    }
 
-    InitNodes();
+    {
+        LoadPhaseTimer timer(loadPhases, "InitNodes");
+        InitNodes();
 
-    for (auto &node : graphNodes) {
-        node->initOptimalPrimitiveDescriptor();
+        for (auto &node : graphNodes) {
+            node->initOptimalPrimitiveDescriptor();
+        }
     }
-    InitEdges();
 
-    optimizer.ApplyImplSpecificGraphOptimizations(*this);
+    {
+        LoadPhaseTimer timer(loadPhases, "InitEdges");
+        InitEdges();
 
-    SortTopologically();
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
+
+        SortTopologically();
+    }
 
-    Allocate();
+    if (snapshotHandler) {
+        MKLDNNGraphSnapshot::CPtr snapshot;
+        {
+            LoadPhaseTimer timer(loadPhases, "Snapshot");
+            snapshot = CreateSnapshot();
+        }
+        snapshotHandler(snapshot);
+    }
 
-    CreatePrimitives();
+    CompleteGraph();
+}
+
+void MKLDNNGraph::CompleteGraph() {
+    {
+        LoadPhaseTimer timer(loadPhases, "Allocate");
+        Allocate();
+    }
+
+    // Weights are placed near the stream which runs the graph
+    for (auto &graphNode : graphNodes)
+        graphNode->weightsAllocator = allocator;
+
+    {
+        LoadPhaseTimer timer(loadPhases, "CreatePrimitives");
+        CreatePrimitives();
+    }
+    // Reorders of the weights are done while the primitives are created, they are reported separately
+    double weightsReorderTime = 0;
+    for (auto &graphNode : graphNodes)
+        weightsReorderTime += graphNode->weightsReorderTime;
+    loadPhases.back().time -= weightsReorderTime;
+    loadPhases.push_back({"WeightsReorders", weightsReorderTime});
 
     // Do it before cleanup. Because it will lose original layers information
     for (auto &graphNode : graphNodes) {
@@ -398,12 +486,249 @@ void MKLDNNGraph::InitGraph() {
     }
 #endif
 
-    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (auto &graphNode : graphNodes) {
-        if (!graphNode->isConstant())
-            continue;
-        graphNode->execute(stream);
+    {
+        LoadPhaseTimer timer(loadPhases, "ConstantFolding");
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        for (auto &graphNode : graphNodes) {
+            if (!graphNode->isConstant())
+                continue;
+            graphNode->execute(stream);
+        }
+    }
+
+    {
+        LoadPhaseTimer timer(loadPhases, "SelectNodesThreads");
+        SelectNodesThreads();
     }
+
+    if (config.latencySamplingPeriod > 0)
+        latencyHistograms.reset(new MKLDNNLatencyHistogram[graphNodes.size()]);
+}
+
+MKLDNNNodePtr MKLDNNGraph::CopyNodeWithFused(const MKLDNNNodePtr &node) {
+    MKLDNNNodePtr copy(MKLDNNNode::CopyNode(*node));
+    if (!copy)
+        return nullptr;
+
+    // Fused nodes are copied as well, cleanup of the original graph releases their layers
+    for (auto &fused : node->fusedWith) {
+        auto fusedCopy = CopyNodeWithFused(fused);
+        if (!fusedCopy)
+            return nullptr;
+        copy->fusedWith.push_back(fusedCopy);
+    }
+    for (auto &merged : node->mergedWith) {
+        auto mergedCopy = CopyNodeWithFused(merged);
+        if (!mergedCopy)
+            return nullptr;
+        copy->mergedWith.push_back(mergedCopy);
+    }
+    return copy;
+}
+
+MKLDNNGraphSnapshot::CPtr MKLDNNGraph::CreateSnapshot() {
+    auto snapshot = std::make_shared<MKLDNNGraphSnapshot>();
+
+    std::unordered_map<const MKLDNNNode*, size_t> nodeIndices;
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto &node = graphNodes[i];
+        // Such nodes refer to the state which is not owned by the node or keep the whole subgraph inside
+        if (node->getType() == Generic || node->getType() == TensorIterator ||
+            node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            return nullptr;
+
+        auto copy = CopyNodeWithFused(node);
+        if (!copy)
+            return nullptr;
+        snapshot->nodes.push_back(copy);
+        nodeIndices[node.get()] = i;
+    }
+
+    std::unordered_map<const MKLDNNEdge*, size_t> edgeIndices;
+    for (size_t i = 0; i < graphEdges.size(); i++) {
+        auto &edge = graphEdges[i];
+        auto parent = nodeIndices.find(edge->getParent().get());
+        auto child = nodeIndices.find(edge->getChild().get());
+        if (parent == nodeIndices.end() || child == nodeIndices.end())
+            return nullptr;
+        snapshot->edges.push_back({parent->second, child->second, edge->parent_port, edge->child_port});
+        edgeIndices[edge.get()] = i;
+    }
+
+    auto getEdgeIndices = [&](const std::vector<MKLDNNEdgeWeakPtr> &edges, std::vector<size_t> &indices) {
+        for (auto &edge : edges) {
+            auto index = edgeIndices.find(edge.lock().get());
+            if (index == edgeIndices.end())
+                return false;
+            indices.push_back(index->second);
+        }
+        return true;
+    };
+    snapshot->parentEdges.resize(graphNodes.size());
+    snapshot->childEdges.resize(graphNodes.size());
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        if (!getEdgeIndices(graphNodes[i]->parentEdges, snapshot->parentEdges[i]) ||
+            !getEdgeIndices(graphNodes[i]->childEdges, snapshot->childEdges[i]))
+            return nullptr;
+    }
+
+    for (auto &input : inputNodes) {
+        auto index = nodeIndices.find(input.second.get());
+        if (index == nodeIndices.end())
+            return nullptr;
+        snapshot->inputNodes[input.first] = index->second;
+    }
+    for (auto &output : outputNodes) {
+        auto index = nodeIndices.find(output.get());
+        if (index == nodeIndices.end())
+            return nullptr;
+        snapshot->outputNodes.push_back(index->second);
+    }
+
+    snapshot->name = _name;
+    snapshot->meanImages = _meanImages;
+    snapshot->fusedChains = fusedChains;
+    snapshot->eliminatedPermuteBytes = eliminatedPermuteBytes;
+    snapshot->eliminatedReorderBytes = eliminatedReorderBytes;
+    return snapshot;
+}
+
+void MKLDNNGraph::RestoreSnapshot(const MKLDNNGraphSnapshot &snapshot) {
+    for (auto &node : snapshot.nodes) {
+        auto copy = CopyNodeWithFused(node);
+        if (!copy)
+            THROW_IE_EXCEPTION << "Cannot copy node " << node->getName();
+        copy->socket = socket;
+        graphNodes.push_back(copy);
+    }
+
+    for (auto &edge : snapshot.edges) {
+        graphEdges.push_back(std::make_shared<MKLDNNEdge>(graphNodes[edge.parent], graphNodes[edge.child],
+                                                          edge.parentPort, edge.childPort));
+    }
+    // Order of the edges defines the ports of the nodes, so it is restored exactly
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        for (auto index : snapshot.parentEdges[i])
+            graphNodes[i]->parentEdges.push_back(graphEdges[index]);
+        for (auto index : snapshot.childEdges[i])
+            graphNodes[i]->childEdges.push_back(graphEdges[index]);
+    }
+
+    for (auto &input : snapshot.inputNodes)
+        inputNodes[input.first] = graphNodes[input.second];
+    for (auto index : snapshot.outputNodes)
+        outputNodes.push_back(graphNodes[index]);
+
+    _name = snapshot.name;
+    _meanImages = snapshot.meanImages;
+    fusedChains = snapshot.fusedChains;
+    eliminatedPermuteBytes = snapshot.eliminatedPermuteBytes;
+    eliminatedReorderBytes = snapshot.eliminatedReorderBytes;
+
+    SortTopologically();
+}
+
+// Time of distributing empty work between all the threads in microseconds, the best of several runs
+static double measureForkOverhead(int threads) {
+    double overhead = std::numeric_limits<double>::max();
+    for (int i = 0; i < 16; i++) {
+        std::vector<int> touched(threads);
+        auto start = std::chrono::high_resolution_clock::now();
+        parallel_for(threads, [&](int ithr) {
+            touched[ithr] = 1;
+        });
+        auto finish = std::chrono::high_resolution_clock::now();
+        overhead = std::min(overhead, std::chrono::duration<double, std::micro>(finish - start).count());
+    }
+    return overhead;
+}
+
+// Time of copying one byte by a single thread in microseconds
+static double measureCopyCost() {
+    const size_t size = 1 << 20;
+    std::vector<char> src(size, 1), dst(size);
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < 4; i++) {
+        auto start = std::chrono::high_resolution_clock::now();
+        ie_memcpy(dst.data(), size, src.data(), size);
+        auto finish = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::micro>(finish - start).count());
+    }
+    return best / size;
+}
+
+void MKLDNNGraph::SelectNodesThreads() {
+    streamThreads = parallel_get_max_threads();
+
+    const double forkOverhead = streamThreads > 1 ? measureForkOverhead(streamThreads) : 0;
+    const double copyCost = streamThreads > 1 ? measureCopyCost() : 0;
+
+    auto getBytes = [](const InferenceEngine::TensorDesc &desc) {
+        return desc.getPrecision().size() *
+               std::accumulate(desc.getDims().begin(), desc.getDims().end(), size_t(1), std::multiplies<size_t>());
+    };
+
+    for (auto &node : graphNodes) {
+        int threads = streamThreads;
+
+        // Compute bound and extension nodes have no simple work estimation, so they always use the whole stream.
+        // Other nodes are mostly limited by memory, every thread should get more work than its forking costs.
+        bool computeBound = node->getType() == Convolution || node->getType() == Deconvolution ||
+                            node->getType() == BinaryConvolution || node->getType() == DeformableConvolution ||
+                            node->getType() == FullyConnected || node->getType() == Gemm ||
+                            node->getType() == RNNCell || node->getType() == RNNSeq ||
+                            node->getType() == TensorIterator || node->getType() == Generic;
+        if (streamThreads > 1 && !computeBound && !node->isConstant()) {
+            size_t bytes = 0;
+            for (size_t i = 0; i < node->getParentEdges().size(); i++)
+                bytes += getBytes(node->getParentEdgeAt(i)->getDesc());
+            for (size_t i = 0; i < node->getChildEdges().size(); i++)
+                bytes += getBytes(node->getChildEdgeAt(i)->getDesc());
+
+            double work = bytes * copyCost;
+            if (forkOverhead > 0 && work < forkOverhead * streamThreads)
+                threads = std::max(1, static_cast<int>(work / forkOverhead));
+        }
+        node->threadsNum = threads;
+    }
+
+    CreateNodesArenas();
+}
+
+void MKLDNNGraph::CreateNodesArenas() {
+    #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    nodeArenas.clear();
+    for (auto &node : graphNodes) {
+        int threads = node->threadsNum;
+        // Single thread nodes get a one slot arena too, in the stream arena their parallel loops would fork to all threads
+        if (threads > 0 && threads < streamThreads && nodeArenas.find(threads) == nodeArenas.end())
+            nodeArenas[threads] = std::unique_ptr<tbb::task_arena>(new tbb::task_arena(threads, 1));
+    }
+    #endif
+}
+
+void MKLDNNGraph::ExecuteWithThreads(int threads, const std::function<void()> &body) {
+    if (threads > 0 && threads < streamThreads) {
+        #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        auto arena = nodeArenas.find(threads);
+        if (arena != nodeArenas.end()) {
+            arena->second->execute(body);
+            return;
+        }
+        #elif IE_THREAD == IE_THREAD_OMP
+        omp_set_num_threads(threads);
+        body();
+        omp_set_num_threads(streamThreads);
+        return;
+        #endif
+    }
+    body();
+}
+
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr &node, mkldnn::stream &stream) {
+    ExecuteWithThreads(node->threadsNum, [&] {
+        node->execute(stream);
+    });
 }
 
 void MKLDNNGraph::InitNodes() {
@@ -422,6 +747,16 @@ void MKLDNNGraph::InitNodes() {
 
     for (auto &node : graphNodes) {
         node->selectOptimalPrimitiveDescriptor();
+
+        auto tuned = tunedChoices.find(node->getName());
+        if (tuned != tunedChoices.end()) {
+            // Choice is ignored if the node doesn't have the same candidates anymore
+            auto &supportedPrimitiveDescriptors = node->getSupportedPrimitiveDescriptors();
+            int index = tuned->second.index;
+            if (index >= 0 && index < supportedPrimitiveDescriptors.size() &&
+                supportedPrimitiveDescriptors[index].getImplementationType() == tuned->second.implType)
+                node->selectPrimitiveDescriptorByIndex(index);
+        }
     }
 }
 
@@ -628,7 +963,7 @@ void MKLDNNGraph::AllocateWithReuse() {
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)), allocator);
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
 
     for (int i = 0; i < edge_clasters.size(); i++) {
@@ -761,9 +1096,24 @@ void MKLDNNGraph::Infer(int batch) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    // Durations measured for the performance counters are also recorded into the histograms for sampled inferences
+    bool sampleLatencies = latencyHistograms && config.latencySamplingPeriod > 0 &&
+                           latencySamplingCounter++ % config.latencySamplingPeriod == 0;
+    auto &tracer = InferenceEngine::Tracer::getInstance();
+    const bool traced = traceSession != 0;
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+        // preemption point: no parallel region of the graph is active between the nodes
+        if (MKLDNNPriorityScheduler::mustYield()) {
+            const int64_t yieldBegin = traced ? tracer.now() : 0;
+            MKLDNNPriorityScheduler::getInstance().yield();
+            if (traced)
+                tracer.addEvent(traceSession, "Node", "Preempted", yieldBegin, tracer.now(), streamId);
+        }
+
+        PerfHelper perfHelper(graphNodes[i]->PerfCounter(),
+                              sampleLatencies && !graphNodes[i]->isConstant() ? &latencyHistograms[i] : nullptr);
 
         if (batch > 0)
             graphNodes[i]->setDynamicBatchLim(batch);
@@ -772,7 +1122,10 @@ void MKLDNNGraph::Infer(int batch) {
 
         if (!graphNodes[i]->isConstant()) {
             IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
-            graphNodes[i]->execute(stream);
+            const int64_t nodeBegin = traced ? tracer.now() : 0;
+            ExecuteNode(graphNodes[i], stream);
+            if (traced)
+                tracer.addEvent(traceSession, "Node", graphNodes[i]->getName(), nodeBegin, tracer.now(), streamId);
         }
 
         ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
@@ -897,6 +1250,28 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     if (!config.dumpToDot.empty()) dumpToDotFile(config.dumpToDot + "_perf.dot");
 }
 
+void MKLDNNGraph::GetLatencyHistograms(std::map<std::string, MKLDNNLatencyHistogram::Counts> &histograms) const {
+    if (!latencyHistograms)
+        return;
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        if (graphNodes[i]->isConstant())
+            continue;
+        latencyHistograms[i].accumulate(histograms[graphNodes[i]->getName()]);
+    }
+}
+
+std::map<std::string, size_t> MKLDNNGraph::GetEliminatedBytes() const {
+    // Permutes which only reinterpret channels last data are not executed either
+    size_t permuteBytes = eliminatedPermuteBytes;
+    for (auto& node : graphNodes) {
+        if (node->getType() == Permute && node->isInplace())
+            permuteBytes += 2 * node->getParentEdgeAt(0)->getDesc().getPrecision().size() *
+                            static_cast<size_t>(node->getParentEdgeAt(0)->getDims().size());
+    }
+    return {{"Permute", permuteBytes}, {"Reorder", eliminatedReorderBytes}};
+}
+
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
 }
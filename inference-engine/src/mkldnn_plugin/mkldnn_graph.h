@@ -11,7 +11,9 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "mkldnn_streams.h"
+#include "mkldnn_latency_histogram.h"
 
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -19,6 +21,60 @@
 
 namespace MKLDNNPlugin {
 
+// Node with the operations fused into it as post operations
+struct MKLDNNFusedChain {
+    std::string root;
+    std::vector<std::string> fused;
+    // Memory traffic of intermediate tensors which are not written and read back anymore
+    size_t savedBytes;
+};
+
+// Primitive descriptor chosen for a node by benchmarking of all its candidates
+struct MKLDNNTunedChoice {
+    int index;
+    // Used to check that the node still has the same candidate at the index
+    impl_desc_type implType;
+    std::string defaultImpl;
+    std::string tunedImpl;
+    // Execution time of the node and reorders around it in microseconds
+    double defaultTime;
+    double tunedTime;
+};
+
+// Duration of a phase of the graph loading in microseconds
+struct MKLDNNLoadPhase {
+    std::string name;
+    double time;
+};
+
+// Nodes and edges of the graph after all the optimizations and primitive descriptors selection. The graphs of
+// the other streams are created from it, so only the memory and the primitives are created for each of them.
+struct MKLDNNGraphSnapshot {
+    typedef std::shared_ptr<const MKLDNNGraphSnapshot> CPtr;
+
+    struct Edge {
+        size_t parent;
+        size_t child;
+        int parentPort;
+        int childPort;
+    };
+
+    // Copies of the nodes which are never executed, the graphs copy them again
+    std::vector<MKLDNNNodePtr> nodes;
+    std::vector<Edge> edges;
+    // Indices of the edges in the order they are stored in every node
+    std::vector<std::vector<size_t>> parentEdges;
+    std::vector<std::vector<size_t>> childEdges;
+    std::map<std::string, size_t> inputNodes;
+    std::vector<size_t> outputNodes;
+
+    std::string name;
+    std::map<std::string, MeanImage> meanImages;
+    std::vector<MKLDNNFusedChain> fusedChains;
+    size_t eliminatedPermuteBytes = 0;
+    size_t eliminatedReorderBytes = 0;
+};
+
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
@@ -40,6 +96,14 @@ public:
     }
 
     void setConfig(const Config &cfg);
+    // Index of the stream running the graph, it is reported in the timeline of the Tracer
+    void setStreamId(int id) {
+        streamId = id;
+    }
+    // Session of the Tracer the nodes are recorded to, 0 if the graph is not traced
+    void setTraceSession(int session) {
+        traceSession = session;
+    }
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty();
 
@@ -51,6 +115,18 @@ public:
                      const MKLDNNExtensionManager::Ptr& extMgr,
                      int socket = 0);
 
+    // Creates the same graph as the snapshot was taken from without repeating the optimizations
+    void CreateGraph(const MKLDNNGraphSnapshot::CPtr &snapshot, int socket = 0);
+
+    // The handler is called during the graph creation with its snapshot, null if the graph can't be copied
+    void setSnapshotHandler(const std::function<void(const MKLDNNGraphSnapshot::CPtr&)> &handler) {
+        snapshotHandler = handler;
+    }
+
+    const std::vector<MKLDNNLoadPhase>& GetLoadPhases() const {
+        return loadPhases;
+    }
+
     bool hasMeanImageFor(const std::string& name) {
         return _meanImages.find(name) != _meanImages.end();
     }
@@ -78,17 +154,34 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    // Adds the samples of the latency histograms of the nodes to the histograms with the same names
+    void GetLatencyHistograms(std::map<std::string, MKLDNNLatencyHistogram::Counts> &histograms) const;
+
+    const std::vector<MKLDNNFusedChain>& GetFusedChains() const {
+        return fusedChains;
+    }
+
+    // Per inference memory traffic of the permutes and reorders which are removed or reinterpret data in place,
+    // keyed by the layer type
+    std::map<std::string, size_t> GetEliminatedBytes() const;
+
+    void setTunedChoices(const std::map<std::string, MKLDNNTunedChoice> &choices) {
+        tunedChoices = choices;
+    }
+
+    const std::map<std::string, MKLDNNTunedChoice>& GetTunedChoices() const {
+        return tunedChoices;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
     void DropDWConvNode(const MKLDNNNodePtr& node);
 
+    // The load function creates the graph, it is called inside the arena of the stream
     void CreateArenaWithObserverAndLoadGraph(int threads_per_stream, int numa_node, int stream_id,
                                              Config::InferenceThreadsBinding  pinning,
-            std::shared_ptr<ICNNNetwork> clonedNetwork, const MKLDNNExtensionManager::Ptr& extensionManager) {
-        auto load = [clonedNetwork, extensionManager, numa_node, this](){
-            CreateGraph(static_cast<const ICNNNetwork&>(*clonedNetwork), extensionManager, numa_node);
-        };
+                                             const std::function<void()> &load) {
         #if(IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         if (Config::InferenceThreadsBinding::NUMA == pinning) {
             ptrArena = std::unique_ptr<tbb::task_arena>(
@@ -149,6 +242,11 @@ protected:
         #endif
     }
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
+    void SelectNodesThreads();
+    void CreateNodesArenas();
+    // Runs the body with the concurrency limited to the given number of threads
+    void ExecuteWithThreads(int threads, const std::function<void()> &body);
+    void ExecuteNode(const MKLDNNNodePtr &node, mkldnn::stream &stream);
 
     void ForgetGraphData() {
         status = NotReady;
@@ -158,7 +256,14 @@ protected:
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
+        fusedChains.clear();
+        eliminatedPermuteBytes = 0;
+        eliminatedReorderBytes = 0;
         _meanImages.clear();
+        latencyHistograms.reset();
+        #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        nodeArenas.clear();
+        #endif
     }
     Status status;
     Config config;
@@ -170,17 +275,38 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    // Allocator of the workspace and weights, null if the default one is used
+    std::shared_ptr<InferenceEngine::IAllocator> allocator;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
+    std::vector<MKLDNNFusedChain> fusedChains;
+    std::map<std::string, MKLDNNTunedChoice> tunedChoices;
+    // Per inference memory traffic of permutes and reorders removed by the graph optimizer
+    size_t eliminatedPermuteBytes = 0;
+    size_t eliminatedReorderBytes = 0;
+
+    // Number of threads the graph was loaded with
+    int streamThreads = 1;
+    int streamId = 0;
+    int traceSession = 0;
+
+    std::function<void(const MKLDNNGraphSnapshot::CPtr&)> snapshotHandler;
+    std::vector<MKLDNNLoadPhase> loadPhases;
+
+    // Latencies of graphNodes sampled with config.latencySamplingPeriod, null if the sampling is disabled
+    std::unique_ptr<MKLDNNLatencyHistogram[]> latencyHistograms;
+    unsigned latencySamplingCounter = 0;
 
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
     #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
     std::unique_ptr<tbb::task_arena> ptrArena;
+    // Narrower arenas for the nodes which don't benefit from the full width of the stream, keyed by concurrency
+    std::map<int, std::unique_ptr<tbb::task_arena>> nodeArenas;
     std::unique_ptr<tbb::task_scheduler_observer> ptrObserver;
     #endif
     mkldnn::engine eng;
@@ -188,6 +314,10 @@ protected:
     void Replicate(const ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
     void Replicate(const TensorIterator::Body &subgraph, const MKLDNNExtensionManager::Ptr& extMgr);
     void InitGraph();
+    void CompleteGraph();
+    MKLDNNGraphSnapshot::CPtr CreateSnapshot();
+    void RestoreSnapshot(const MKLDNNGraphSnapshot &snapshot);
+    static MKLDNNNodePtr CopyNodeWithFused(const MKLDNNNodePtr &node);
     void InitNodes();
     void InitEdges();
     void Allocate();
@@ -199,6 +329,7 @@ protected:
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
+    friend class MKLDNNGraphOptimizer;
     friend std::shared_ptr<InferenceEngine::ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph);
 
 private:
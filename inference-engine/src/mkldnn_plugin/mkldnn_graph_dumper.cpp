@@ -7,6 +7,7 @@
 #include "ie_util_internal.hpp"
 #include "exec_graph_info.hpp"
 #include "mkldnn_debug.h"
+#include "nodes/mkldnn_concat_node.h"
 
 #include <vector>
 #include <string>
@@ -38,9 +39,29 @@ std::shared_ptr<ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph) {
     net->setName(graph._name);
     std::map<MKLDNNNodePtr, CNNLayerPtr> node2layer;
 
+    std::map<std::string, const MKLDNNFusedChain*> fusedChains;
+    for (auto &chain : graph.fusedChains)
+        fusedChains[chain.root] = &chain;
+
     // Copy all nodes to network
     for (auto &node : graph.graphNodes) {
         auto layer = convert_node(node);
+
+        // Implementation which would be used without autotuning
+        auto tuned = graph.tunedChoices.find(node->getName());
+        if (tuned != graph.tunedChoices.end() && tuned->second.tunedImpl != tuned->second.defaultImpl)
+            layer->params["defaultPrimitiveType"] = tuned->second.defaultImpl;
+
+        // Post operations merged into the node and the traffic of their intermediate tensors
+        auto chain = fusedChains.find(node->getName());
+        if (chain != fusedChains.end()) {
+            std::string fusedStr;
+            for (auto &name : chain->second->fused)
+                fusedStr += (fusedStr.empty() ? "" : ",") + name;
+            layer->params["fusedPostOps"] = fusedStr;
+            layer->params["fusedSavedBytes"] = std::to_string(chain->second->savedBytes);
+        }
+
         node2layer[node] = layer;
         net->addLayer(layer);
     }
@@ -171,6 +192,14 @@ void copy_node_metadata(const MKLDNNNodePtr &node, CNNLayer::Ptr &layer) {
     }
 
     layer->params[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
+
+    // Intra-op parallelism chosen for the node
+    layer->params["threads"] = std::to_string(node->getThreadsNum());
+
+    // Copies removed by inplace concatenation
+    auto concatNode = dynamic_cast<MKLDNNConcatNode*>(node.get());
+    if (concatNode && concatNode->isOptimized())
+        layer->params["inPlaceSavedBytes"] = std::to_string(concatNode->getInPlaceSavedBytes());
 }
 
 void drawer_callback(const InferenceEngine::CNNLayerPtr layer,
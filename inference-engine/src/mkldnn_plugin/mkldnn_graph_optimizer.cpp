@@ -16,6 +16,7 @@
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
+#include "nodes/mkldnn_power_node.h"
 
 #include <blob_factory.hpp>
 #include <ie_layers_internal.hpp>
@@ -25,6 +26,8 @@
 #include <list>
 #include <memory>
 #include <set>
+#include <numeric>
+#include <functional>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -32,10 +35,18 @@ using namespace InferenceEngine;
 
 MKLDNNGraphOptimizer::MKLDNNGraphOptimizer() {}
 
+static size_t getTensorBytes(const TensorDesc &desc) {
+    return desc.getPrecision().size() *
+           std::accumulate(desc.getDims().begin(), desc.getDims().end(), size_t(1), std::multiplies<size_t>());
+}
+
 void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     MergeConversions(graph);
     graph.RemoveDroppedNodes();
 
+    RemoveInversePermutes(graph);
+    graph.RemoveDroppedNodes();
+
     FuseBroadcastAndEltwise(graph);
     graph.RemoveDroppedNodes();
 
@@ -45,35 +56,7 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionAndZeroPoints(graph);
     graph.RemoveDroppedNodes();
 
-#if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
-    FuseConvolutionAndDepthwise(graph);
-    graph.RemoveDroppedNodes();
-#endif
-
-#if defined(COMPILED_CPU_MKLDNN_ACTIVATION_NODE)
-    FuseConvolutionAndActivation(graph);
-    graph.RemoveDroppedNodes();
-    FuseFullyConnectedAndActivation(graph);
-    graph.RemoveDroppedNodes();
-#endif
-
-#if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
-    FuseConvolutionAndDepthwise(graph);
-    graph.RemoveDroppedNodes();
-#endif
-
-    FuseConvolutionAndQuantize(graph);
-    graph.RemoveDroppedNodes();
-
-    graph.SortTopologically();
-    graph.RemoveDroppedEdges();
-
-#if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
-    FuseConvolutionAndDepthwise(graph);
-    graph.RemoveDroppedNodes();
-#endif
-
-    FusePoolingAndQuantize(graph);
+    FusePostOpsChains(graph);
     graph.RemoveDroppedNodes();
 
     graph.SortTopologically();
@@ -98,16 +81,16 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     graph.RemoveDroppedNodes();
 #endif
 
-    FuseConvolutionAndSimpleOperation(graph);
-    graph.RemoveDroppedNodes();
-
-    FuseMVNAndSimpleOperation(graph);
+    // Chains are extended once more after the convolutions are merged with sums and depthwise convolutions
+    FusePostOpsChains(graph);
     graph.RemoveDroppedNodes();
 
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
 
     graph.RemoveDroppedEdges();
+
+    CollectFusedChains(graph);
 }
 
 void MKLDNNGraphOptimizer::ApplyImplSpecificGraphOptimizations(MKLDNNGraph &graph) {
@@ -170,6 +153,63 @@ void MKLDNNGraphOptimizer::MergeConversions(MKLDNNGraph& graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::RemoveInversePermutes(MKLDNNGraph &graph) {
+    graph.eliminatedPermuteBytes = 0;
+
+    auto getOrder = [](const MKLDNNNodePtr &node) {
+        std::vector<int> order = node->getCnnLayer()->GetParamAsInts("order");
+        return SizeVector(order.begin(), order.end());
+    };
+
+    auto isIdentity = [](const SizeVector &order) {
+        for (size_t i = 0; i < order.size(); i++) {
+            if (order[i] != i)
+                return false;
+        }
+        return true;
+    };
+
+    // Both reading and writing of the permuted tensor are gone
+    auto dropPermute = [&](const MKLDNNNodePtr &node) {
+        graph.eliminatedPermuteBytes += 2 * getTensorBytes(node->getCnnLayer()->insData[0].lock()->getTensorDesc());
+        graph.DropNode(node);
+    };
+
+    std::set<MKLDNNNodePtr> processed;
+    for (auto &node : graph.GetNodes()) {
+        if (node->getType() != Permute || processed.find(node) != processed.end() ||
+            node->getParentEdges().size() != 1 || node->getChildEdges().size() != 1)
+            continue;
+
+        SizeVector order = getOrder(node);
+        if (isIdentity(order)) {
+            processed.insert(node);
+            dropPermute(node);
+            continue;
+        }
+
+        auto child = node->getChildEdgeAt(0)->getChild();
+        if (child->getType() != Permute || processed.find(child) != processed.end() ||
+            child->getParentEdges().size() != 1)
+            continue;
+
+        // Applying the second permutation after the first one gives the order of the whole pair
+        SizeVector childOrder = getOrder(child);
+        if (childOrder.size() != order.size())
+            continue;
+        SizeVector combined(order.size());
+        for (size_t i = 0; i < order.size(); i++)
+            combined[i] = order[childOrder[i]];
+        if (!isIdentity(combined))
+            continue;
+
+        processed.insert(node);
+        processed.insert(child);
+        dropPermute(node);
+        dropPermute(child);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
     auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
         auto& edges = graph.GetEdges();
@@ -469,160 +509,6 @@ void MKLDNNGraphOptimizer::FuseBatchNormWithScale(MKLDNNGraph &graph) {
     }
 }
 
-#if defined(COMPILED_CPU_MKLDNN_ACTIVATION_NODE)
-void MKLDNNGraphOptimizer::FuseConvolutionAndActivation(MKLDNNGraph &graph) {
-    auto isOneOf = [&](mkldnn::algorithm alg, std::vector<mkldnn::algorithm> algs) {
-        for (auto a : algs) {
-            if (alg == a) {
-                return true;
-            }
-        }
-        return false;
-    };
-
-    auto& graphNodes = graph.GetNodes();
-
-    auto isFusingSupported = [&](MKLDNNNodePtr conv, MKLDNNNodePtr activation) {
-        if (!activation->getCnnLayer())
-            return false;
-
-        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(activation.get());
-
-        return activationNode &&
-            (activationNode->getAlgorithm() == eltwise_relu ||
-            (conv->getCnnLayer()->precision == Precision::FP32 &&
-             isOneOf(activationNode->getAlgorithm(), {eltwise_elu, eltwise_logistic, eltwise_bounded_relu, eltwise_clamp})));
-    };
-
-    for (int i = 0; i < graphNodes.size(); i++) {
-        if (graphNodes[i]->getType() == Convolution || graphNodes[i]->getType() == BinaryConvolution) {
-            auto conv = graphNodes[i];
-
-            auto fuse = [&] (MKLDNNNodePtr relu) {
-                conv->fuseWith(relu);
-            };
-
-            if (conv->getChildEdges().size() == 1) {
-                auto ch1 = conv->getChildEdgeAt(0)->getChild();
-
-                if (isFusingSupported(conv, ch1)) {
-                    fuse(ch1);
-
-                    if (ch1->getChildEdges().size() == 1) {
-                        auto ch2 = ch1->getChildEdgeAt(0)->getChild();
-
-                        if (isFusingSupported(conv, ch2)) {
-                            fuse(ch2);
-                            graph.DropNode(ch2);
-                        }
-                    }
-                    graph.DropNode(ch1);
-                } else {
-                    if (ch1->type == Pooling) {
-                        auto pool = ch1;
-
-                        auto* pLayer = dynamic_cast<PoolingLayer *>(pool->getCnnLayer().get());
-                        if (pLayer == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get pooling layer " << pool->getName();
-                        bool is_max_pool = pLayer->_type == PoolingLayer::PoolType::MAX;
-
-                        if (is_max_pool && pool->getChildEdges().size() == 1) {
-                            auto ch2 = pool->getChildEdgeAt(0)->getChild();
-                            if (isFusingSupported(conv, ch2)) {
-                                fuse(ch2);
-                                graph.DropNode(ch2);
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
-}
-
-void MKLDNNGraphOptimizer::FuseFullyConnectedAndActivation(MKLDNNGraph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isFusingSupported = [&](MKLDNNNodePtr fc, MKLDNNNodePtr activation) {
-        if (!activation->getCnnLayer())
-            return false;
-
-        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(activation.get());
-
-        // TODO: fuse on fp32 not optimized yet in mkl-dnn
-        return activationNode && fc->getCnnLayer()->precision != Precision::FP32 &&
-            (activationNode->getAlgorithm() == eltwise_relu);
-    };
-
-    for (int i = 0; i < graphNodes.size(); i++) {
-        if (graphNodes[i]->getType() == FullyConnected) {
-            auto fc = graphNodes[i];
-
-            auto fuse = [&] (MKLDNNNodePtr relu) {
-                fc->fuseWith(relu);
-            };
-
-            if (fc->getChildEdges().size() == 1) {
-                auto ch1 = fc->getChildEdgeAt(0)->getChild();
-
-                if (isFusingSupported(fc, ch1)) {
-                    fuse(ch1);
-                    graph.DropNode(ch1);
-                }
-            }
-        }
-    }
-}
-#endif
-
-#if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
-void MKLDNNGraphOptimizer::FuseConvolutionAndDepthwise(MKLDNNGraph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableConv = (node->getType() == Convolution) &&
-                             node->getCnnLayer()->precision == Precision::FP32;
-        bool isSutableBinConv = node->getType() == BinaryConvolution;
-        return (isSutableConv || isSutableBinConv) && node->getChildEdges().size() == 1;
-    };
-
-    auto isSutableChildNode = [](MKLDNNNodePtr node) {
-        if (node->getType() != Depthwise)
-            return false;
-
-        if (!node->getCnnLayer())
-            return false;
-
-        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
-        if (depthwiseNode == nullptr)
-            THROW_IE_EXCEPTION << "Cannot get depthwise node " << node->getName();
-        return ((depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_scale_shift && depthwiseNode->isWithBiases()) ||
-                (depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_prelu));
-    };
-
-    for (int i = 0; i < graphNodes.size(); i++) {
-        auto conv = graphNodes[i];
-        if (!isSutableParentNode(conv)) continue;
-
-        auto depthwise0 = conv->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(depthwise0)) continue;
-
-        conv->fuseWith(depthwise0);
-
-        if (depthwise0->getChildEdges().size() == 1) {
-            auto depthwise1 = depthwise0->getChildEdgeAt(0)->getChild();
-
-            if (isSutableChildNode(depthwise1)) {
-                conv->fuseWith(depthwise1);
-                graph.DropNode(depthwise1);
-            }
-        }
-
-        graph.DropNode(depthwise0);
-    }
-}
-#endif
-
 void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -767,71 +653,7 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
     }
 }
 
-#if defined(COMPILED_CPU_MKLDNN_QUANTIZE_NODE)
-void MKLDNNGraphOptimizer::FuseConvolutionAndQuantize(MKLDNNGraph &graph) {
-    auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
-        auto& edges = graph.GetEdges();
-        for (auto it = edges.begin(); it != edges.end(); it++) {
-            if ((*it) == edge) {
-                edges.erase(it);
-                return;
-            }
-        }
-    };
-
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableBinConv = node->getType() == Convolution;
-
-        if (isSutableBinConv) {
-            auto *convLayer = dynamic_cast<ConvolutionLayer *>(node->getCnnLayer().get());
-            if (convLayer == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get convolution layer " << node->getName();
-
-            return isSutableBinConv && node->getChildEdges().size() == 1;
-        } else {
-            return false;
-        }
-    };
-
-    auto isSutableChildNode = [](MKLDNNNodePtr node) {
-        if (!node->getCnnLayer())
-            return false;
-
-        if (node->getType() != Quantize)
-            return false;
-
-        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
-        if (quantizeNode == nullptr)
-            THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
-
-        return !quantizeNode->isBinarization();
-    };
-
-    for (int i = 0; i < graphNodes.size(); i++) {
-        auto parent = graphNodes[i];
-        if (!isSutableParentNode(parent)) continue;
-
-        auto child = parent->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(child)) continue;
-
-        parent->fuseWith(child);
-
-        auto parents = child->parentEdges;
-        for (size_t j = 0; j < parents.size(); j++) {
-            auto p_edge = parents[j].lock();
-            if (p_edge->getParent()->getType() == Convolution)
-                continue;
-
-            removeEdge(graph, p_edge);
-        }
-
-        graph.DropNode(child);
-    }
-}
-
-void MKLDNNGraphOptimizer::FuseConvolutionAndSimpleOperation(MKLDNNGraph &graph) {
+void MKLDNNGraphOptimizer::FusePostOpsChains(MKLDNNGraph &graph) {
     auto isOneOf = [&](mkldnn::algorithm alg, std::vector<mkldnn::algorithm> algs) {
         for (auto a : algs) {
             if (alg == a) {
@@ -854,125 +676,176 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndSimpleOperation(MKLDNNGraph &graph)
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        return node->getType() == Convolution &&
-               node->getChildEdges().size() == 1 &&
-               node->getCnnLayer()->precision == Precision::FP32;
+        if (node->getChildEdges().size() != 1)
+            return false;
+
+        switch (node->getType()) {
+            case Convolution:
+                // Post operations of int8 convolutions are not extended after quantization, sum or fused depthwise convolution
+                return node->getCnnLayer()->precision == Precision::FP32 ||
+                       (!node->isFusedWith(Quantize) && !node->isFusedWith(Eltwise) && !node->isFusedWith(Convolution));
+            case BinaryConvolution:
+                // Binarization is fused by FuseBinaryConvolutionAndQuantize
+                return !node->isFusedWith(Quantize);
+            case FullyConnected:
+                // TODO: fuse on fp32 not optimized yet in mkl-dnn
+                return node->getCnnLayer()->precision != Precision::FP32;
+            case Pooling: {
+                auto *poolingLayer = dynamic_cast<PoolingLayer *>(node->getCnnLayer().get());
+                if (poolingLayer == nullptr)
+                    THROW_IE_EXCEPTION << "Cannot get Pooling layer " << node->getName();
+                return poolingLayer->_type == PoolingLayer::AVG && !node->isFusedWith(Quantize);
+            }
+            case MVN: {
+                if (node->inDims[0].ndims() != 4 && node->inDims[0].ndims() != 5)
+                    return false;
+                auto *mvnLayer = dynamic_cast<MVNLayer *>(node->getCnnLayer().get());
+                if (mvnLayer == nullptr)
+                    THROW_IE_EXCEPTION << "Cannot get MVN layer " << node->getName();
+                return mvnLayer->across_channels == 0 && mvnLayer->normalize == 1;
+            }
+            default:
+                return false;
+        }
     };
 
-    auto isSutableChildNode = [&](MKLDNNNodePtr node) {
+    // Operations which setPostOps() of the parent node is able to append
+    auto isSutableChildNode = [&](MKLDNNNodePtr parent, MKLDNNNodePtr node) {
         if (!node->getCnnLayer())
             return false;
 
+        const Type parentType = parent->getType();
+        const bool isFP32Conv = parentType == Convolution && parent->getCnnLayer()->precision == Precision::FP32;
+        const bool isFP32BinConv = parentType == BinaryConvolution && parent->getCnnLayer()->precision == Precision::FP32;
+
+#if defined(COMPILED_CPU_MKLDNN_QUANTIZE_NODE)
         if (node->getType() == Quantize) {
+            if (!IsOneOf(parentType, {Convolution, Pooling, MVN}))
+                return false;
+
             auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
             if (quantizeNode == nullptr)
                 THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
-
             return !quantizeNode->isBinarization();
-        } else if (node->getType() == Depthwise) {
+        }
+#endif
+        if (node->getType() == Depthwise) {
             auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode*>(node.get());
             if (depthwiseNode == nullptr)
                 THROW_IE_EXCEPTION << "Cannot get depthwise layer " << node->getName();
 
-            return ((depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_scale_shift && depthwiseNode->isWithBiases()) ||
-                    (depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_prelu));
+            if (isFP32Conv || parentType == BinaryConvolution)
+                return (depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_scale_shift && depthwiseNode->isWithBiases()) ||
+                       (depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_prelu);
+            if (parentType == MVN)
+                return depthwiseNode->getCnnLayer()->type == "ScaleShift";
+            return false;
         } else if (node->getType() == Activation) {
             auto* activationNode = dynamic_cast<MKLDNNActivationNode*>(node.get());
             if (activationNode == nullptr)
                 THROW_IE_EXCEPTION << "Cannot get activation layer " << node->getName();
 
-            return isOneOf(activationNode->getAlgorithm(), {eltwise_relu, eltwise_elu, eltwise_logistic, eltwise_bounded_relu, eltwise_clamp});
+            if (activationNode->getAlgorithm() == eltwise_relu)
+                return IsOneOf(parentType, {Convolution, BinaryConvolution, FullyConnected, MVN});
+            return (isFP32Conv || isFP32BinConv) &&
+                   isOneOf(activationNode->getAlgorithm(), {eltwise_elu, eltwise_logistic, eltwise_bounded_relu, eltwise_clamp});
+        } else if (node->getType() == Power) {
+            auto* powerNode = dynamic_cast<MKLDNNPowerNode*>(node.get());
+            if (powerNode == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get power layer " << node->getName();
+
+            mkldnn::algorithm alg;
+            float alpha, beta;
+            return isFP32Conv && powerNode->getEltwiseEquivalent(alg, alpha, beta);
         }
 
         return false;
     };
 
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSutableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
-
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(childNode)) {
-            parent++;
-            continue;
-        }
-
-        parentNode->fuseWith(childNode);
-
-        if (childNode->getType() == Quantize) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Convolution)
-                    continue;
+    // Quantized output is final for all nodes except fp32 convolution and MVN, which keep fusing after it
+    auto canContinueAfter = [](MKLDNNNodePtr parent, MKLDNNNodePtr node) {
+        if (node->getType() != Quantize)
+            return true;
+        return parent->getType() == MVN ||
+               (parent->getType() == Convolution && parent->getCnnLayer()->precision == Precision::FP32);
+    };
 
-                removeEdge(graph, p_edge);
-            }
-        }
+    auto isMaxPooling = [](MKLDNNNodePtr node) {
+        if (node->getType() != Pooling)
+            return false;
+        auto *poolingLayer = dynamic_cast<PoolingLayer *>(node->getCnnLayer().get());
+        if (poolingLayer == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get Pooling layer " << node->getName();
+        return poolingLayer->_type == PoolingLayer::MAX;
+    };
 
-        graph.DropNode(childNode);
-    }
-}
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto parentNode = graphNodes[i];
+        if (!isSutableParentNode(parentNode))
+            continue;
 
-void MKLDNNGraphOptimizer::FuseBinaryConvolutionAndQuantize(MKLDNNGraph &graph) {
-    auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
-        auto& edges = graph.GetEdges();
-        for (auto it = edges.begin(); it != edges.end(); it++) {
-            if ((*it) == edge) {
-                edges.erase(it);
-                return;
+        while (parentNode->getChildEdges().size() == 1) {
+            auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+            if (!isSutableChildNode(parentNode, childNode)) {
+                // Supported activations are monotonic, so the convolution may apply them before max pooling
+                if (IsOneOf(parentNode->getType(), {Convolution, BinaryConvolution}) &&
+                        isMaxPooling(childNode) && childNode->getChildEdges().size() == 1) {
+                    auto activationNode = childNode->getChildEdgeAt(0)->getChild();
+                    if (activationNode->getType() == Activation && isSutableChildNode(parentNode, activationNode)) {
+                        parentNode->fuseWith(activationNode);
+                        graph.DropNode(activationNode);
+                    }
+                }
+                break;
             }
-        }
-    };
 
-    auto& graphNodes = graph.GetNodes();
+            parentNode->fuseWith(childNode);
 
-    auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableBinConv = node->getType() == BinaryConvolution;
-        return isSutableBinConv && node->getChildEdges().size() == 1;
-    };
-
-    auto isSutableChildNode = [](MKLDNNNodePtr node) {
-        if (!node->getCnnLayer())
-            return false;
+            if (childNode->getType() == Quantize) {
+                auto parentEdges = childNode->parentEdges;
+                for (auto &parentEdge : parentEdges) {
+                    auto p_edge = parentEdge.lock();
+                    if (p_edge->getParent() == parentNode)
+                        continue;
 
-        if (node->getType() != Quantize)
-            return false;
+                    removeEdge(graph, p_edge);
+                }
+            }
 
-        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
-        if (quantizeNode == nullptr)
-            THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
+            graph.DropNode(childNode);
 
-        return quantizeNode->isBinarization();
-    };
+            if (!canContinueAfter(parentNode, childNode))
+                break;
+        }
+    }
+}
 
-    for (int i = 0; i < graphNodes.size(); i++) {
-        auto parent = graphNodes[i];
-        if (!isSutableParentNode(parent)) continue;
+void MKLDNNGraphOptimizer::CollectFusedChains(MKLDNNGraph &graph) {
+    graph.fusedChains.clear();
 
-        auto child = parent->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(child)) continue;
+    for (auto &node : graph.GetNodes()) {
+        auto &fusedWith = node->getFusedWith();
+        if (fusedWith.empty())
+            continue;
 
-        parent->fuseWith(child);
+        MKLDNNFusedChain chain;
+        chain.root = node->getName();
+        chain.savedBytes = 0;
+        for (auto &fusedNode : fusedWith) {
+            chain.fused.push_back(fusedNode->getName());
 
-        auto parents = child->parentEdges;
-        for (size_t i = 0; i < parents.size(); i++) {
-            auto p_edge = parents[i].lock();
-            if (p_edge->getParent()->getType() == BinaryConvolution)
+            // The tensor passed to the fused operation is neither written nor read back anymore
+            auto layer = fusedNode->getCnnLayer();
+            if (!layer || layer->insData.empty())
                 continue;
-
-            removeEdge(graph, p_edge);
+            chain.savedBytes += 2 * getTensorBytes(layer->insData[0].lock()->getTensorDesc());
         }
-
-        graph.DropNode(child);
+        graph.fusedChains.push_back(chain);
     }
 }
 
-void MKLDNNGraphOptimizer::FusePoolingAndQuantize(MKLDNNGraph &graph) {
+#if defined(COMPILED_CPU_MKLDNN_QUANTIZE_NODE)
+void MKLDNNGraphOptimizer::FuseBinaryConvolutionAndQuantize(MKLDNNGraph &graph) {
     auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
         auto& edges = graph.GetEdges();
         for (auto it = edges.begin(); it != edges.end(); it++) {
@@ -986,17 +859,8 @@ void MKLDNNGraphOptimizer::FusePoolingAndQuantize(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutablePooling = node->getType() == Pooling;
-
-        if (isSutablePooling) {
-            auto *poolingLayer = dynamic_cast<PoolingLayer *>(node->getCnnLayer().get());
-            if (poolingLayer == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get Pooling layer " << node->getName();
-
-            return node->getChildEdges().size() == 1 && poolingLayer->_type == PoolingLayer::AVG;
-        } else {
-            return false;
-        }
+        bool isSutableBinConv = node->getType() == BinaryConvolution;
+        return isSutableBinConv && node->getChildEdges().size() == 1;
     };
 
     auto isSutableChildNode = [](MKLDNNNodePtr node) {
@@ -1010,7 +874,7 @@ void MKLDNNGraphOptimizer::FusePoolingAndQuantize(MKLDNNGraph &graph) {
         if (quantizeNode == nullptr)
             THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
 
-        return !quantizeNode->isBinarization();
+        return quantizeNode->isBinarization();
     };
 
     for (int i = 0; i < graphNodes.size(); i++) {
@@ -1025,7 +889,7 @@ void MKLDNNGraphOptimizer::FusePoolingAndQuantize(MKLDNNGraph &graph) {
         auto parents = child->parentEdges;
         for (size_t i = 0; i < parents.size(); i++) {
             auto p_edge = parents[i].lock();
-            if (p_edge->getParent()->getType() == Pooling)
+            if (p_edge->getParent()->getType() == BinaryConvolution)
                 continue;
 
             removeEdge(graph, p_edge);
@@ -1259,88 +1123,6 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
 }
 #endif
 
-void MKLDNNGraphOptimizer::FuseMVNAndSimpleOperation(MKLDNNGraph &graph) {
-    auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
-        auto& edges = graph.GetEdges();
-        for (auto it = edges.begin(); it != edges.end(); it++) {
-            if ((*it) == edge) {
-                edges.erase(it);
-                return;
-            }
-        }
-    };
-
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableMVN = (node->getType() == MVN) && (node->inDims[0].ndims() == 4 || node->inDims[0].ndims() == 5);
-
-        if (isSutableMVN) {
-            auto *mvnLayer = dynamic_cast<MVNLayer *>(node->getCnnLayer().get());
-            if (mvnLayer == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get MVN layer " << node->getName();
-
-            return node->getChildEdges().size() == 1 && mvnLayer->across_channels == 0 && mvnLayer->normalize == 1;
-        } else {
-            return false;
-        }
-    };
-
-    auto isSutableChildNode = [](MKLDNNNodePtr node) {
-        if (!node->getCnnLayer())
-            return false;
-
-        if (node->getType() == Quantize) {
-            auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
-            if (quantizeNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
-            return !quantizeNode->isBinarization();
-        } else if (node->getType() == Depthwise) {
-            auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode*>(node.get());
-            if (depthwiseNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get depthwise layer " << node->getName();
-            return depthwiseNode->cnnLayer->type == "ScaleShift";
-        } else if (node->getType() == Activation) {
-            auto* activationNode = dynamic_cast<MKLDNNActivationNode*>(node.get());
-            if (activationNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get activation layer " << node->getName();
-            return activationNode->getAlgorithm() == eltwise_relu;
-        }
-
-        return false;
-    };
-
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSutableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
-
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(childNode)) {
-            parent++;
-            continue;
-        }
-
-        parentNode->fuseWith(childNode);
-
-        if (childNode->getType() == Quantize) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == MVN)
-                    continue;
-
-                removeEdge(graph, p_edge);
-            }
-        }
-
-        graph.DropNode(childNode);
-    }
-}
-
 void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     auto isOneOf = [&](mkldnn::algorithm alg, std::vector<mkldnn::algorithm> algs) {
         for (auto a : algs) {
@@ -1480,6 +1262,7 @@ void MKLDNNGraphOptimizer::RemoveIdentityOperator(MKLDNNGraph &graph) {
 
 #if defined (COMPILED_CPU_MKLDNN_REORDER_NODE)
 void MKLDNNGraphOptimizer::DropDoubleReorders(MKLDNNGraph &graph) {
+    graph.eliminatedReorderBytes = 0;
     std::set<MKLDNNNodePtr> processed;
     std::vector<MKLDNNNodePtr> newNodes;
     for (MKLDNNNodePtr& node : graph.GetNodes()) {
@@ -1522,6 +1305,12 @@ void MKLDNNGraphOptimizer::DropDoubleReorders(MKLDNNGraph &graph) {
             }
             if (!edge) THROW_IE_EXCEPTION << "Inappropriate graph processing";
 
+            // Reorders cancel each other, so the parent output is passed to the child as is
+            if (scales == nullptr && !edge->needReorder()) {
+                graph.eliminatedReorderBytes += 2 * getTensorBytes(n->getInput()) + 2 * getTensorBytes(nn->getInput());
+                continue;
+            }
+            graph.eliminatedReorderBytes += 2 * getTensorBytes(nn->getInput());
 
             std::string layerName = edge->getParent()->getName() + "_ScaleReorder_" + edge->getChild()->getName();
             CNNLayerPtr layer(new CNNLayer({layerName,
@@ -21,26 +21,17 @@ private:
     void SLTMTransform(MKLDNNGraph& graph);
     void MergeConversions(MKLDNNGraph& graph);
     void MergeGroupConvolution(MKLDNNGraph& graph);
-#if defined(COMPILED_CPU_MKLDNN_ACTIVATION_NODE)
-    void FuseConvolutionAndActivation(MKLDNNGraph &graph);
-    void FuseFullyConnectedAndActivation(MKLDNNGraph &graph);
-#endif
-#if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
-    void FuseConvolutionAndDepthwise(MKLDNNGraph &graph);
-#endif
-    void FuseConvolutionAndSimpleOperation(MKLDNNGraph &graph);
     void FuseConvolutionAndDWConvolution(MKLDNNGraph &graph);
 #if defined(COMPILED_CPU_MKLDNN_QUANTIZE_NODE)
-    void FuseConvolutionAndQuantize(MKLDNNGraph &graph);
     void FuseBinaryConvolutionAndQuantize(MKLDNNGraph &graph);
-    void FusePoolingAndQuantize(MKLDNNGraph &graph);
 #endif
     void FuseBatchNormWithScale(MKLDNNGraph& graph);
+    void FusePostOpsChains(MKLDNNGraph &graph);
 #if defined(COMPILED_CPU_MKLDNN_ELTWISE_NODE)
     void FuseConvolutionSumAndConvolutionSumActivation(MKLDNNGraph &graph);
 #endif
-    void FuseMVNAndSimpleOperation(MKLDNNGraph &graph);
     void RemoveIdentityOperator(MKLDNNGraph& graph);
+    void RemoveInversePermutes(MKLDNNGraph& graph);
 
     void RemoveIOScaleShifts(MKLDNNGraph& graph);
 #if defined (COMPILED_CPU_MKLDNN_REORDER_NODE)
@@ -51,6 +42,8 @@ private:
     void FuseBroadcastAndEltwise(MKLDNNGraph &graph);
     void FuseEltwiseAndSimple(MKLDNNGraph &graph);
 
+    void CollectFusedChains(MKLDNNGraph &graph);
+
 
     bool IsOneOf(Type type, std::vector<Type> types);
 };
@@ -5,6 +5,7 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_streams.h"
+#include "mkldnn_priority_scheduler.h"
 #include <vector>
 #include <string>
 #include <map>
@@ -38,6 +39,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
         THROW_IE_EXCEPTION << "Network not loaded.";
     }
     auto infer = [this] {
+        // the inferences of other CPU networks with lower priority are preempted until this one completes
+        MKLDNNPriorityScheduler::Scope priorityScope(GetPriority());
+
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
 
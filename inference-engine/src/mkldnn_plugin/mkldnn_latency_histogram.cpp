@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_latency_histogram.h"
+
+#include <cmath>
+
+using namespace MKLDNNPlugin;
+
+constexpr int MKLDNNLatencyHistogram::subBucketsBits;
+constexpr int MKLDNNLatencyHistogram::maxValueBits;
+constexpr int MKLDNNLatencyHistogram::bucketsCount;
+
+MKLDNNLatencyHistogram::MKLDNNLatencyHistogram() {
+    for (auto &count : counts)
+        count.store(0, std::memory_order_relaxed);
+}
+
+void MKLDNNLatencyHistogram::accumulate(Counts &result) const {
+    result.resize(bucketsCount, 0);
+    for (int i = 0; i < bucketsCount; i++)
+        result[i] += counts[i].load(std::memory_order_relaxed);
+}
+
+int MKLDNNLatencyHistogram::getBucket(uint64_t nanoseconds) noexcept {
+    if (nanoseconds < (1ull << subBucketsBits))
+        return static_cast<int>(nanoseconds);
+    if (nanoseconds >= (1ull << maxValueBits))
+        return bucketsCount - 1;
+
+    int power = subBucketsBits;
+    while (nanoseconds >> (power + 1))
+        power++;
+    // The leading bit and the next subBucketsBits bits select the bucket
+    int shift = power - subBucketsBits;
+    return (shift << subBucketsBits) + static_cast<int>(nanoseconds >> shift);
+}
+
+uint64_t MKLDNNLatencyHistogram::getUpperBound(int bucket) noexcept {
+    if (bucket < (1 << subBucketsBits))
+        return bucket + 1;
+    int shift = (bucket >> subBucketsBits) - 1;
+    uint64_t mantissa = (bucket & ((1 << subBucketsBits) - 1)) + (1 << subBucketsBits);
+    return (mantissa + 1) << shift;
+}
+
+uint64_t MKLDNNLatencyHistogram::getPercentile(const Counts &counts, double percentile) {
+    uint64_t total = 0;
+    for (auto count : counts)
+        total += count;
+    if (total == 0)
+        return 0;
+
+    // Nearest rank of the percentile
+    auto rank = static_cast<uint64_t>(std::ceil(percentile / 100 * total));
+    if (rank == 0)
+        rank = 1;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+        seen += counts[i];
+        if (seen >= rank)
+            return getUpperBound(static_cast<int>(i));
+    }
+    return getUpperBound(static_cast<int>(counts.size()) - 1);
+}
@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Histogram of the latencies of a node with logarithmic buckets. Every power of two is split into 8 linear
+ * buckets, so the values are kept with the relative error below 12.5% from nanoseconds up to a minute.
+ * It is written by the stream running the graph without locks and may be read at the same time.
+ */
+class MKLDNNLatencyHistogram {
+public:
+    typedef std::vector<uint64_t> Counts;
+
+    static constexpr int subBucketsBits = 3;
+    static constexpr int maxValueBits = 36;
+    static constexpr int bucketsCount = (maxValueBits - subBucketsBits + 1) << subBucketsBits;
+
+    MKLDNNLatencyHistogram();
+
+    void record(uint64_t nanoseconds) noexcept {
+        counts[getBucket(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Adds the number of samples in every bucket to the counts
+    void accumulate(Counts &result) const;
+
+    static int getBucket(uint64_t nanoseconds) noexcept;
+    // Exclusive upper bound of the values in the bucket in nanoseconds
+    static uint64_t getUpperBound(int bucket) noexcept;
+    // Upper bound of the bucket containing the percentile of the samples, 0 if there are no samples
+    static uint64_t getPercentile(const Counts &counts, double percentile);
+
+private:
+    std::atomic<uint32_t> counts[bucketsCount];
+};
+
+}  // namespace MKLDNNPlugin
@@ -86,6 +86,24 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bo
     }
 }
 
+void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const std::shared_ptr<IAllocator>& allocator) {
+    if (!allocator) {
+        Create(desc);
+        return;
+    }
+
+    size_t size = memory::primitive_desc(desc, eng).get_size();
+    void* handle = allocator->alloc(size);
+    if (handle == nullptr)
+        THROW_IE_EXCEPTION << "Cannot allocate " << size << " bytes of memory";
+    allocatedData = std::shared_ptr<void>(handle, [allocator](void* handle) {
+        allocator->unlock(handle);
+        allocator->free(handle);
+    });
+
+    Create(desc, allocator->lock(handle));
+}
+
 void MKLDNNMemory::SetData(memory::data_type dataType, memory::format format, const void* data, size_t size, bool ftz) const {
     uint8_t itemSize = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(dataType));
 
@@ -1265,8 +1283,9 @@ MKLDNNMemoryDesc::MKLDNNMemoryDesc(const TensorDesc& tDesc):
     }
 
     if (notDefault) {
+        // Strides are given in the blocked order, e.g. the last one belongs to channels for nhwc
         for (size_t i = 0; i < strides.size() && i < desc.data.ndims; i++) {
-            desc.data.layout_desc.blocking.strides[0][i] = static_cast<ptrdiff_t>(strides[order[i]]);
+            desc.data.layout_desc.blocking.strides[0][order[i]] = static_cast<ptrdiff_t>(strides[i]);
         }
     }
 }
@@ -102,6 +102,8 @@ public:
                 const void* data = nullptr);
 
     void Create(const mkldnn::memory::desc& desc, const void* data = nullptr, bool pads_zeroing = true);
+    // Memory is allocated by the allocator and released together with this object
+    void Create(const mkldnn::memory::desc& desc, const std::shared_ptr<InferenceEngine::IAllocator>& allocator);
 
     void SetData(mkldnn::memory::data_type dataType, mkldnn::memory::format format, const void* data, size_t size, bool ftz = true) const;
     void SetData(const MKLDNNMemory& memory, bool ftz = true) const;
@@ -121,6 +123,7 @@ public:
 
 private:
     std::shared_ptr<mkldnn::memory> prim;
+    std::shared_ptr<void> allocatedData;
     mkldnn::engine eng;
 };
 
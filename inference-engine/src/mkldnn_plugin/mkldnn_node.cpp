@@ -8,6 +8,7 @@
 #include "details/caseless.hpp"
 #include <vector>
 #include <string>
+#include <chrono>
 #include <limits>
 #include <cstdint>
 #include <unordered_map>
@@ -134,6 +135,18 @@ void MKLDNNNode::AddNode(const std::string& name, CreatorByLayerFunction factory
     GetNodesHolder()->nodes[name] = factory;
 }
 
+void MKLDNNNode::AddCopier(const std::type_index& type, CopyFunction copier) {
+    GetNodesHolder()->copiers[type] = copier;
+}
+
+MKLDNNNode* MKLDNNNode::CopyNode(const MKLDNNNode& node) {
+    auto nodesHolder = GetNodesHolder();
+    auto copier = nodesHolder->copiers.find(typeid(node));
+    if (copier == nodesHolder->copiers.end())
+        return nullptr;
+    return copier->second(node);
+}
+
 MKLDNNNode::MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int _socket)
         : cnnLayer(layer), name(layer->name), typeStr(layer->type), type(TypeFromName(layer->type)), engine(eng),
           selectedPrimitiveDescriptorIndex(-1), permanent(false), temporary(false), constant(ConstantType::Unknown),
@@ -168,6 +181,16 @@ MKLDNNNode::MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::
     }
 }
 
+MKLDNNNode::MKLDNNNode(const MKLDNNNode& node)
+        : InferenceEngine::details::no_copy(), inDims(node.inDims), outDims(node.outDims),
+          internalBlobDesc(node.internalBlobDesc), implPriorities(node.implPriorities),
+          selectedPrimitiveDescriptorIndex(node.selectedPrimitiveDescriptorIndex), permanent(node.permanent),
+          temporary(node.temporary), dynBatchLim(node.dynBatchLim), constant(node.constant),
+          internalBlobs(node.internalBlobs), supportedPrimitiveDescriptors(node.supportedPrimitiveDescriptors),
+          descs(node.descs), ext_scales(node.ext_scales), cnnLayer(node.cnnLayer), engine(node.engine), name(node.name),
+          typeStr(node.typeStr), type(node.type), socket(node.socket), weight_caching(node.weight_caching),
+          profilingTask(node.profilingTask) {}
+
 void MKLDNNNode::addEdge(const MKLDNNEdgeWeakPtr& edge) {
     auto edgePtr = edge.lock();
     if (!edgePtr)
@@ -687,9 +710,10 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
             THROW_IE_EXCEPTION << "Destination memory didn't allocate for node " << getName()
                                << " from node " << getParentEdgeAt(i)->getParent()->getName() << ".";
     }
+    auto start = std::chrono::high_resolution_clock::now();
     std::vector<MKLDNNMemoryDesc> intDescs;
     for (auto &it : internalBlobDesc)
-        intDescs.push_back(it(itpd, 0));
+        intDescs.push_back(it(*this, itpd, 0));
 
     internalBlobMemory.clear();
     for (size_t i = 0; i < internalBlobs.size(); i++) {
@@ -709,7 +733,7 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
             memory.Create(MKLDNNMemoryDesc(newDesc.getDims(), newDesc.getDataType(), newFormat), internalBlob->buffer());
 
             MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
-            _ptr->Create(intDescs[i]);
+            _ptr->Create(intDescs[i], weightsAllocator);
             _ptr->SetData(memory);
 
             return _ptr;
@@ -731,6 +755,7 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
         internalBlobMemory.push_back(ptr);
     }
+    weightsReorderTime += std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - start).count();
 }
 
 bool MKLDNNNode::isInplace() const {
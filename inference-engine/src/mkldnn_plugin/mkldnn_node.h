@@ -10,6 +10,7 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <typeindex>
 #include <ie_common.h>
 #include <ie_profiling.hpp>
 #include "details/caseless.hpp"
@@ -28,8 +29,11 @@ using MKLDNNNodePtr = std::shared_ptr<MKLDNNNode>;
 using MKLDNNNodeWeakPtr = std::weak_ptr<MKLDNNNode>;
 
 using CreatorByLayerFunction = std::function<MKLDNNNode *(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket)>;
+using CopyFunction = std::function<MKLDNNNode *(const MKLDNNNode& node)>;
 struct MKLDNNNodesHolder {
     std::map<std::string, CreatorByLayerFunction> nodes;
+    // Keyed by the node class, only the classes which can be copied are present
+    std::map<std::type_index, CopyFunction> copiers;
 };
 
 enum Type {
@@ -216,6 +220,10 @@ public:
     static MKLDNNNode* CreateNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
                                   const MKLDNNExtensionManager::Ptr& extMgr, int socket = 0);
 
+    static void AddCopier(const std::type_index& type, CopyFunction copier);
+    // Returns a copy of the node without edges, primitive and internal blobs memory, null if the node can't be copied
+    static MKLDNNNode* CopyNode(const MKLDNNNode& node);
+
     ~MKLDNNNode() override = default;
 
     void addEdge(const MKLDNNEdgeWeakPtr& edge);
@@ -399,6 +407,14 @@ public:
         return execIndex;
     }
 
+    int getThreadsNum() const {
+        return threadsNum;
+    }
+
+    void setThreadsNum(int threads) {
+        threadsNum = threads;
+    }
+
     std::string getTypeStr() const {
         return typeStr;
     }
@@ -420,7 +436,17 @@ public:
                     -> MKLDNNNode* {
                         return new To(layer, eng, socket);
                     });
+            addCopier(std::is_copy_constructible<To>());
+        }
+
+    private:
+        static void addCopier(std::true_type) {
+            MKLDNNNode::AddCopier(typeid(To), [](const MKLDNNNode& node) -> MKLDNNNode* {
+                return new To(static_cast<const To&>(node));
+            });
         }
+
+        static void addCopier(std::false_type) {}
     };
 
 
@@ -441,8 +467,9 @@ protected:
 
     virtual std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr() const { return nullptr; }
 
-    typedef std::function<MKLDNNMemoryDesc (mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx)>
-            GetPrimitiveMemoryFormatFunc;
+    // The node is passed explicitly, so the functions stay valid for the copies of the node
+    typedef std::function<MKLDNNMemoryDesc (MKLDNNNode &node, mkldnn::primitive_desc_iterator &primitive_desc_it,
+                                      size_t idx)> GetPrimitiveMemoryFormatFunc;
     std::vector<GetPrimitiveMemoryFormatFunc> internalBlobDesc;
 
     std::vector <MKLDNNNodePtr> fusedWith;
@@ -452,6 +479,8 @@ protected:
     std::string originalLayers;  // contains names of the original layers separated by comma
 
     MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket);
+    // Copies the state selected by the graph optimizations, edges and everything created later are not copied
+    MKLDNNNode(const MKLDNNNode& node);
 
     int selectedPrimitiveDescriptorIndex = -1;
     bool permanent = false;
@@ -508,8 +537,14 @@ private:
     const std::string typeStr;
     Type type;
     int execIndex = -1;
+    // Number of threads chosen for the node by the graph, 0 if it is not chosen yet
+    int threadsNum = 0;
     int socket;
     bool weight_caching = false;
+    // Allocator of the internal blobs chosen by the graph, null if the default one is used
+    std::shared_ptr<InferenceEngine::IAllocator> weightsAllocator;
+    // Time spent by prepareMemory to reorder the weights into the layouts of the primitive, in microseconds
+    double weightsReorderTime = 0;
 
     std::string typeToStr(Type type);
 
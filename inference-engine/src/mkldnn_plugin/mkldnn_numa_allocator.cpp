@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_numa_allocator.h"
+
+#include <details/ie_irelease.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+#ifdef __linux__
+// Memory policy from <numaif.h>, the syscall is used directly to not depend on libnuma
+static constexpr int MPOL_BIND_POLICY = 2;
+
+static void bindToNumaNode(void* ptr, size_t length, int numaNode) {
+#ifdef SYS_mbind
+    const size_t bitsPerLong = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> nodeMask(numaNode / bitsPerLong + 1, 0);
+    nodeMask[numaNode / bitsPerLong] |= 1ul << (numaNode % bitsPerLong);
+    // Binding is an optimization only, kernels without NUMA support just reject it
+    syscall(SYS_mbind, ptr, length, MPOL_BIND_POLICY, nodeMask.data(), nodeMask.size() * bitsPerLong + 1, 0);
+#endif
+}
+#endif
+
+MKLDNNNumaAllocator::MKLDNNNumaAllocator(int numaNode, Config::HugePagesMode mode) : numaNode(numaNode), mode(mode) {}
+
+void* MKLDNNNumaAllocator::alloc(size_t size) noexcept {
+    if (size == 0)
+        return nullptr;
+
+    // A buffer smaller than a huge page would leave most of its page unused, such buffers are taken from the heap
+    const bool small = size < hugePageSize;
+    const size_t alignment = small ? smallBufferAlignment : hugePageSize;
+    const size_t length = (size + alignment - 1) / alignment * alignment;
+#ifdef __linux__
+    if (small) {
+        void* ptr = nullptr;
+        if (posix_memalign(&ptr, alignment, length) != 0)
+            return nullptr;
+        try {
+            std::lock_guard<std::mutex> lock(guard);
+            mappings[ptr] = {nullptr, 0};
+        } catch (...) {
+            std::free(ptr);
+            return nullptr;
+        }
+        return ptr;
+    }
+
+    void* ptr = MAP_FAILED;
+    if (mode == Config::HugePagesMode::Explicit) {
+        // Pages reserved by the administrator in /proc/sys/vm/nr_hugepages, transparent ones are used if there are none
+        ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+    if (ptr == MAP_FAILED) {
+        // Extra page is mapped to align the buffer, otherwise the kernel can't back its ends by huge pages.
+        // The unaligned head and the rest of the extra page are unmapped right away.
+        void* base = mmap(nullptr, length + hugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED)
+            return nullptr;
+        auto address = reinterpret_cast<uintptr_t>(base);
+        auto aligned = (address + hugePageSize - 1) / hugePageSize * hugePageSize;
+        if (aligned > address)
+            munmap(base, aligned - address);
+        munmap(reinterpret_cast<void*>(aligned + length), hugePageSize - (aligned - address));
+        ptr = reinterpret_cast<void*>(aligned);
+#ifdef MADV_HUGEPAGE
+        if (mode != Config::HugePagesMode::Disabled)
+            madvise(ptr, length, MADV_HUGEPAGE);
+#endif
+    }
+    if (numaNode >= 0)
+        bindToNumaNode(ptr, length, numaNode);
+
+    try {
+        std::lock_guard<std::mutex> lock(guard);
+        mappings[ptr] = {ptr, length};
+    } catch (...) {
+        munmap(ptr, length);
+        return nullptr;
+    }
+    return ptr;
+#else
+    void* ptr = nullptr;
+#if defined(_WIN32)
+    ptr = _aligned_malloc(length, alignment);
+#else
+    if (posix_memalign(&ptr, alignment, length) != 0)
+        ptr = nullptr;
+#endif
+    return ptr;
+#endif
+}
+
+bool MKLDNNNumaAllocator::free(void* handle) noexcept {
+    if (handle == nullptr)
+        return true;
+#ifdef __linux__
+    Mapping mapping;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = mappings.find(handle);
+        if (found == mappings.end())
+            return false;
+        mapping = found->second;
+        mappings.erase(found);
+    }
+    if (mapping.base == nullptr) {
+        std::free(handle);
+        return true;
+    }
+    return munmap(mapping.base, mapping.length) == 0;
+#elif defined(_WIN32)
+    _aligned_free(handle);
+    return true;
+#else
+    std::free(handle);
+    return true;
+#endif
+}
+
+std::shared_ptr<IAllocator> MKLDNNPlugin::CreateGraphAllocator(int numaNode, Config::HugePagesMode mode) {
+    if (mode == Config::HugePagesMode::Disabled)
+        return nullptr;
+    return details::shared_from_irelease(new MKLDNNNumaAllocator(numaNode, mode));
+}
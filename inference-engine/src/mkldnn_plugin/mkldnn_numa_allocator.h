@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "config.h"
+
+#include <ie_allocator.hpp>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Allocator of large long living buffers (graph workspaces and weights). Memory is mapped directly from the OS,
+ * backed by 2MB pages and bound to the NUMA node of the stream which uses it. Buffers smaller than a huge page
+ * come from the heap and rely on the first touch by the stream threads. On the systems without such controls
+ * it behaves like a plain aligned allocator.
+ */
+class MKLDNNNumaAllocator : public InferenceEngine::IAllocator {
+public:
+    MKLDNNNumaAllocator(int numaNode, Config::HugePagesMode mode);
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void* handle) noexcept override {}
+
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+    static constexpr size_t hugePageSize = 2 * 1024 * 1024;
+    static constexpr size_t smallBufferAlignment = 64;
+
+protected:
+    ~MKLDNNNumaAllocator() override = default;
+
+private:
+    // Base is null for the buffers allocated on the heap
+    struct Mapping {
+        void* base;
+        size_t length;
+    };
+
+    int numaNode;
+    Config::HugePagesMode mode;
+    std::unordered_map<void*, Mapping> mappings;
+    std::mutex guard;
+};
+
+// Returns the allocator for workspaces and weights of the graph running on the numaNode, null if the default one is used
+std::shared_ptr<InferenceEngine::IAllocator> CreateGraphAllocator(int numaNode, Config::HugePagesMode mode);
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_priority_scheduler.h"
+
+using namespace MKLDNNPlugin;
+
+thread_local bool MKLDNNPriorityScheduler::inScope = false;
+thread_local int MKLDNNPriorityScheduler::currentPriority = 0;
+thread_local bool MKLDNNPriorityScheduler::expired = false;
+
+constexpr std::chrono::milliseconds MKLDNNPriorityScheduler::maxPreemption;
+
+MKLDNNPriorityScheduler& MKLDNNPriorityScheduler::getInstance() {
+    static MKLDNNPriorityScheduler scheduler;
+    return scheduler;
+}
+
+MKLDNNPriorityScheduler::Scope::Scope(int priority) : registered(!inScope) {
+    if (registered) {
+        getInstance().enter(priority);
+        inScope = true;
+        currentPriority = priority;
+        expired = false;
+    }
+}
+
+MKLDNNPriorityScheduler::Scope::~Scope() {
+    if (registered) {
+        inScope = false;
+        getInstance().exit(currentPriority);
+    }
+}
+
+bool MKLDNNPriorityScheduler::mustYield() noexcept {
+    return inScope && !expired && getInstance().maxPriority.load(std::memory_order_relaxed) > currentPriority;
+}
+
+void MKLDNNPriorityScheduler::enter(int priority) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (running.empty() || priority > maxPriority.load(std::memory_order_relaxed))
+        maxPriority.store(priority, std::memory_order_relaxed);
+    running[priority]++;
+}
+
+void MKLDNNPriorityScheduler::exit(int priority) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = running.find(priority);
+        if (--it->second > 0)
+            return;
+        running.erase(it);
+        maxPriority.store(running.empty() ? std::numeric_limits<int>::min() : running.rbegin()->first,
+                          std::memory_order_relaxed);
+    }
+    // the preempted inferences check whether they can continue
+    finished.notify_all();
+}
+
+void MKLDNNPriorityScheduler::yield() {
+    std::unique_lock<std::mutex> lock(mutex);
+    expired = !finished.wait_for(lock, maxPreemption, [&] {
+        return maxPriority.load(std::memory_order_relaxed) <= currentPriority;
+    });
+}
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <map>
+#include <mutex>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Process-wide scheduler of the inferences of all CPU executable networks. The streams of different networks run
+ * in their own threads, so a running inference of a low priority network is preempted at the graph node boundaries
+ * while an inference with a higher priority is running, and the cores are given to the latter. The preempted inference
+ * continues when no inference with a higher priority is running or, so that a steady load of higher priorities does
+ * not starve it, after it waited for maxPreemption. Such inference is not preempted again until it completes.
+ */
+class MKLDNNPriorityScheduler {
+public:
+    // Longest wait of a preempted inference
+    static constexpr std::chrono::milliseconds maxPreemption {1000};
+
+    static MKLDNNPriorityScheduler& getInstance();
+
+    /**
+     * Registers the inference running in the current thread with the given priority until the end of the scope.
+     * Nested scopes (e.g. of the body of TensorIterator) keep the priority of the outer one.
+     */
+    class Scope {
+    public:
+        explicit Scope(int priority);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        bool registered;
+    };
+
+    // Cheap check done at every node boundary: whether the inference of the current thread must be preempted
+    static bool mustYield() noexcept;
+
+    // Blocks the inference of the current thread until no inference with a higher priority is running or
+    // maxPreemption passes
+    void yield();
+
+private:
+    MKLDNNPriorityScheduler() = default;
+
+    void enter(int priority);
+    void exit(int priority);
+
+    static thread_local bool inScope;
+    static thread_local int currentPriority;
+    // The inference of the thread waited for maxPreemption and is not preempted till its end
+    static thread_local bool expired;
+
+    std::mutex mutex;
+    std::condition_variable finished;
+    // Number of the running inferences by priority
+    std::map<int, int> running;
+    std::atomic<int> maxPriority {std::numeric_limits<int>::min()};
+};
+
+}  // namespace MKLDNNPlugin
@@ -15,6 +15,7 @@
 #include "mkldnn_graph.h"
 #include "ie_parallel.hpp"
 #include "mkldnn_streams.h"
+#include "mkldnn_priority_scheduler.h"
 #include "ie_compound_blob.h"
 
 using namespace mkldnn;
@@ -152,8 +153,7 @@ MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task>& init_t
                     std::unique_lock<std::mutex> lock(_queueMutex);
                     _queueCondVar.wait(lock, [&]() { return !_taskQueue.empty() || _isStopped; });
                     if (!_taskQueue.empty()) {
-                        currentTask = std::move(_taskQueue.front());
-                        _taskQueue.pop();
+                        currentTask = _taskQueue.pop();
                     }
                 }
                 if (currentTask)
@@ -188,9 +188,13 @@ MultiWorkerTaskExecutor::~MultiWorkerTaskExecutor() {
 }
 
 void MultiWorkerTaskExecutor::run(Task task) {
+    runWithPriority(std::move(task), 0);
+}
+
+void MultiWorkerTaskExecutor::runWithPriority(Task task, int priority) {
     {
         std::lock_guard<std::mutex> lock(_queueMutex);
-        _taskQueue.push(std::move(task));
+        _taskQueue.push(std::move(task), priority);
     }
     _queueCondVar.notify_one();
 }
@@ -226,6 +230,9 @@ void MKLDNNPlugin::MKLDNNGraphlessInferRequest::InferImpl() {
             THROW_IE_EXCEPTION << "Invalid dynamic batch size " << m_curBatch <<
                                " for this request.";
 
+        // the inferences of other CPU networks with lower priority are preempted until this one completes
+        MKLDNNPriorityScheduler::Scope priorityScope(GetPriority());
+
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
 
@@ -13,6 +13,7 @@
 #include <climits>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 #include <cpp_interfaces/ie_task_executor.hpp>
+#include <cpp_interfaces/ie_priority_task_queue.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn/system_conf.h"
 
@@ -124,6 +125,9 @@ public:
 
     void run(Task task) override;
 
+    /* Tasks of the higher priority requests are grabbed by the streams first */
+    void runWithPriority(Task task, int priority) override;
+
     static thread_local MultiWorkerTaskContext ptrContext;
 
     void stop();
@@ -132,7 +136,7 @@ private:
     std::vector<std::thread> _threads;
     std::mutex _queueMutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    PriorityTaskQueue _taskQueue;
     std::atomic<bool> _isStopped;
     std::string _name;
 };
@@ -0,0 +1,181 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "list.hpp"
+#include "base.hpp"
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <ie_parallel.hpp>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+// CTC prefix beam search over probabilities in [T, N, C] layout with the blank class C - 1.
+// Inputs and output have the same meaning as for CTCGreedyDecoder.
+class CTCBeamSearchDecoderImpl: public ExtLayerBase {
+public:
+    explicit CTCBeamSearchDecoderImpl(const CNNLayer* layer) {
+        try {
+            if (layer->insData.empty() || layer->insData.size() > 2 || layer->outData.size() != 1)
+                THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
+
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() != 3)
+                THROW_IE_EXCEPTION << "CTCBeamSearchDecoder supports only 3D probabilities input!";
+
+            beam_width_ = layer->GetParamAsInt("beam_width", 10);
+            if (beam_width_ < 1)
+                THROW_IE_EXCEPTION << "CTCBeamSearchDecoder beam_width should be positive!";
+
+            // Classes less probable than prune_threshold at a time step are not used to extend prefixes
+            prune_threshold_ = layer->GetParamAsFloat("prune_threshold", 0.0f);
+            merge_repeated_ = layer->GetParamAsBool("ctc_merge_repeated", true);
+
+            std::vector<DataConfigurator> inps;
+            inps.resize(layer->insData.size(), DataConfigurator(ConfLayout::PLN));
+            addConfig(layer, inps, {DataConfigurator(ConfLayout::PLN)});
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                       ResponseDesc *resp) noexcept override {
+        const float* probabilities = inputs[0]->buffer();
+        const float* sequence_indicators = inputs.size() > 1 ? inputs[1]->buffer().as<const float*>() : nullptr;
+        float* output_sequences = outputs[0]->buffer();
+
+        size_t T_ = inputs[0]->getTensorDesc().getDims()[0];
+        size_t N_ = inputs[0]->getTensorDesc().getDims()[1];
+        size_t C_ = inputs[0]->getTensorDesc().getDims()[2];
+
+        parallel_for(N_, [&](size_t n) {
+            size_t sequence_length = T_;
+            if (sequence_indicators != nullptr) {
+                for (size_t t = 1; t < T_; t++) {
+                    if (sequence_indicators[t * N_ + n] == 0) {
+                        sequence_length = t;
+                        break;
+                    }
+                }
+            }
+
+            std::vector<int> best = decode(probabilities + n * C_, sequence_length, N_ * C_, static_cast<int>(C_));
+
+            float* output = output_sequences + n * T_;
+            for (size_t i = 0; i < T_; i++) {
+                output[i] = i < best.size() ? static_cast<float>(best[i]) : -1.0f;
+            }
+        });
+        return OK;
+    }
+
+private:
+    // Log probabilities of a prefix to end with blank and with its last label
+    struct PrefixScore {
+        float blank = -std::numeric_limits<float>::infinity();
+        float label = -std::numeric_limits<float>::infinity();
+
+        float total() const {
+            return log_sum_exp(blank, label);
+        }
+    };
+
+    static float log_sum_exp(float a, float b) {
+        if (a == -std::numeric_limits<float>::infinity())
+            return b;
+        if (b == -std::numeric_limits<float>::infinity())
+            return a;
+        float max = (std::max)(a, b);
+        return max + std::log1p(std::exp(-std::fabs(a - b)));
+    }
+
+    static float safe_log(float p) {
+        return p > 0.0f ? std::log(p) : -std::numeric_limits<float>::infinity();
+    }
+
+    std::vector<int> decode(const float* probs, size_t T, size_t step, int C) const {
+        const int blank = C - 1;
+        using Beam = std::map<std::vector<int>, PrefixScore>;
+
+        Beam beams;
+        beams[std::vector<int>()].blank = 0.0f;
+
+        std::vector<std::pair<float, const Beam::value_type*>> ranked;
+        for (size_t t = 0; t < T; t++, probs += step) {
+            Beam next;
+            const float log_blank = safe_log(probs[blank]);
+
+            for (const auto& beam : beams) {
+                const std::vector<int>& prefix = beam.first;
+                const PrefixScore& score = beam.second;
+                const int last = prefix.empty() ? -1 : prefix.back();
+
+                PrefixScore& same = next[prefix];
+                same.blank = log_sum_exp(same.blank, score.total() + log_blank);
+
+                for (int c = 0; c < blank; c++) {
+                    if (probs[c] < prune_threshold_ || probs[c] <= 0.0f)
+                        continue;
+                    const float log_p = std::log(probs[c]);
+
+                    if (c == last && merge_repeated_) {
+                        // Repeated label is collapsed unless separated by blank
+                        PrefixScore& collapsed = next[prefix];
+                        collapsed.label = log_sum_exp(collapsed.label, score.label + log_p);
+
+                        std::vector<int> extended(prefix);
+                        extended.push_back(c);
+                        PrefixScore& ext = next[extended];
+                        ext.label = log_sum_exp(ext.label, score.blank + log_p);
+                    } else {
+                        std::vector<int> extended(prefix);
+                        extended.push_back(c);
+                        PrefixScore& ext = next[extended];
+                        ext.label = log_sum_exp(ext.label, score.total() + log_p);
+                    }
+                }
+            }
+
+            if (static_cast<int>(next.size()) > beam_width_) {
+                ranked.clear();
+                for (const auto& beam : next)
+                    ranked.emplace_back(beam.second.total(), &beam);
+                std::partial_sort(ranked.begin(), ranked.begin() + beam_width_, ranked.end(),
+                                  [](const std::pair<float, const Beam::value_type*>& a,
+                                     const std::pair<float, const Beam::value_type*>& b) {
+                                      return a.first > b.first;
+                                  });
+                beams.clear();
+                for (int i = 0; i < beam_width_; i++)
+                    beams.insert(*ranked[i].second);
+            } else {
+                beams.swap(next);
+            }
+        }
+
+        auto best = beams.begin();
+        for (auto it = beams.begin(); it != beams.end(); it++) {
+            if (it->second.total() > best->second.total())
+                best = it;
+        }
+        return best->first;
+    }
+
+    int beam_width_ = 10;
+    float prune_threshold_ = 0.0f;
+    bool merge_repeated_ = true;
+};
+
+REG_FACTORY_FOR(ImplFactory<CTCBeamSearchDecoderImpl>, CTCBeamSearchDecoder);
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
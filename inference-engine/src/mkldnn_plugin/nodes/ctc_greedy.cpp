@@ -8,11 +8,16 @@
 #include <cmath>
 #include <vector>
 #include <string>
+#include <ie_parallel.hpp>
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+template <mkldnn::impl::cpu::cpu_isa_t T>
 class CTCGreedyDecoderImpl: public ExtLayerBase {
 public:
     explicit CTCGreedyDecoderImpl(const CNNLayer* layer) {
@@ -38,55 +43,119 @@ public:
             return GENERAL_ERROR;
         }
         const float* probabilities = inputs[0]->buffer();
-        const float* sequence_indicators = inputs[1]->buffer();
+        const float* sequence_indicators = inputs.size() > 1 ? inputs[1]->buffer().as<const float*>() : nullptr;
         float* output_sequences = outputs[0]->buffer();
 
         size_t T_ = inputs[0]->getTensorDesc().getDims()[0];
         size_t N_ = inputs[0]->getTensorDesc().getDims()[1];
         size_t C_ = inputs[0]->getTensorDesc().getDims()[2];
 
-        // Fill output_sequences with -1
-        for (size_t ii = 0; ii < T_*N_; ii++) {
-            output_sequences[ii] = -1;
+        // Sequence n ends at the first t > 0 with zero indicator
+        std::vector<size_t> sequence_lengths(N_, T_);
+        if (sequence_indicators != nullptr) {
+            parallel_for(N_, [&](size_t n) {
+                for (size_t t = 1; t < T_; t++) {
+                    if (sequence_indicators[t * N_ + n] == 0) {
+                        sequence_lengths[n] = t;
+                        break;
+                    }
+                }
+            });
         }
 
-        for (size_t n = 0; n < N_; ++n) {
+        // Best classes of all time steps are independent, so they are found in parallel even for a single sequence
+        std::vector<int> max_class_indexes(T_ * N_);
+        parallel_for2d(N_, T_, [&](size_t n, size_t t) {
+            if (t < sequence_lengths[n])
+                max_class_indexes[n * T_ + t] = argmax(probabilities + t * C_ * N_ + n * C_, static_cast<int>(C_));
+        });
+
+        parallel_for(N_, [&](size_t n) {
+            const int* max_classes = &max_class_indexes[n * T_];
+            float* output = output_sequences + n * T_;
+            size_t output_index = 0;
             int prev_class_idx = -1;
-            size_t output_index = n*T_;
-
-            for (int t = 0; /* check at end */; ++t) {
-                // get maximum probability and its index
-                int max_class_idx = 0;
-
-                const float* probs = probabilities + t*C_*N_ + n*C_;
-                float max_prob = probs[0];
-                ++probs;
-
-                for (size_t c = 1; c < C_; ++c, ++probs) {
-                    if (*probs > max_prob) {
-                        max_class_idx = static_cast<int>(c);
-                        max_prob = *probs;
-                    }
-                }
 
+            for (size_t t = 0; t < sequence_lengths[n]; ++t) {
+                const int max_class_idx = max_classes[t];
                 if (max_class_idx < static_cast<int>(C_) - 1 &&
                         max_class_idx != prev_class_idx) {
-                    output_sequences[output_index] = static_cast<float>(max_class_idx);
+                    output[output_index] = static_cast<float>(max_class_idx);
                     output_index++;
                 }
 
                 prev_class_idx = max_class_idx;
+            }
 
-                if (t + 1 == static_cast<int>(T_) || sequence_indicators[(t + 1)*N_ + n] == 0) {
-                    break;
+            for (; output_index < T_; output_index++) {
+                output[output_index] = -1;
+            }
+        });
+        return OK;
+    }
+
+private:
+    // Returns index of the first maximum, the same as a plain scalar scan
+    inline int argmax(const float* probs, int C) {
+        int max_class_idx = 0;
+        float max_prob = probs[0];
+        int c = 1;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#if defined(HAVE_AVX512F)
+        const int block_size = 16;
+#elif defined(HAVE_AVX2)
+        const int block_size = 8;
+#else
+        const int block_size = 4;
+#endif
+        const int blocks = C / block_size;
+        if (blocks > 1) {
+            // Every lane keeps its own maximum and the number of the block where it was met
+            auto vmax_prob = _mm_uni_loadu_ps(probs);
+            auto vmax_block = _mm_uni_setzero_ps();
+            for (int cb = 1; cb < blocks; cb++) {
+                auto vprob = _mm_uni_loadu_ps(probs + cb * block_size);
+                auto vmask = _mm_uni_cmpgt_ps(vprob, vmax_prob);
+                vmax_prob = _mm_uni_blendv_ps(vmax_prob, vprob, vmask);
+                vmax_block = _mm_uni_blendv_ps(vmax_block, _mm_uni_set1_ps(static_cast<float>(cb)), vmask);
+            }
+
+            float lane_max_prob[block_size];
+            float lane_max_block[block_size];
+            _mm_uni_storeu_ps(lane_max_prob, vmax_prob);
+            _mm_uni_storeu_ps(lane_max_block, vmax_block);
+
+            max_prob = lane_max_prob[0];
+            max_class_idx = static_cast<int>(lane_max_block[0]) * block_size;
+            for (int l = 1; l < block_size; l++) {
+                int idx = static_cast<int>(lane_max_block[l]) * block_size + l;
+                if (lane_max_prob[l] > max_prob || (lane_max_prob[l] == max_prob && idx < max_class_idx)) {
+                    max_prob = lane_max_prob[l];
+                    max_class_idx = idx;
                 }
             }
+            c = blocks * block_size;
         }
-        return OK;
+#endif
+        for (; c < C; c++) {
+            if (probs[c] > max_prob) {
+                max_class_idx = c;
+                max_prob = probs[c];
+            }
+        }
+        return max_class_idx;
     }
 };
 
-REG_FACTORY_FOR(ImplFactory<CTCGreedyDecoderImpl>, CTCGreedyDecoder);
+#ifdef HAVE_AVX512F
+REG_FACTORY_FOR_TYPE(avx512_common, ImplFactory<CTCGreedyDecoderImpl<mkldnn::impl::cpu::cpu_isa_t::avx512_common>>, CTCGreedyDecoder);
+#elif defined HAVE_AVX2
+REG_FACTORY_FOR_TYPE(avx2, ImplFactory<CTCGreedyDecoderImpl<mkldnn::impl::cpu::cpu_isa_t::avx2>>, CTCGreedyDecoder);
+#elif defined HAVE_SSE
+REG_FACTORY_FOR_TYPE(sse42, ImplFactory<CTCGreedyDecoderImpl<mkldnn::impl::cpu::cpu_isa_t::sse42>>, CTCGreedyDecoder);
+#else
+REG_FACTORY_FOR_TYPE(isa_any, ImplFactory<CTCGreedyDecoderImpl<mkldnn::impl::cpu::cpu_isa_t::isa_any>>, CTCGreedyDecoder);
+#endif
 
 }  // namespace Cpu
 }  // namespace Extensions
@@ -14,17 +14,20 @@ using namespace InferenceEngine;
 MKLDNNBatchNormalizationNode::MKLDNNBatchNormalizationNode(const InferenceEngine::CNNLayerPtr& layer,
                                                            const mkldnn::engine& eng, int socket)
         : MKLDNNNode(layer, eng, socket) {
-    internalBlobDesc.emplace_back([&](primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
-        return GetVarianceDesc(primitive_desc_it.fetch());
+    internalBlobDesc.emplace_back([](MKLDNNNode &node, primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
+        auto &self = static_cast<MKLDNNBatchNormalizationNode &>(node);
+        return self.GetVarianceDesc(primitive_desc_it.fetch());
     });
-    internalBlobDesc.emplace_back([&](primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
-        return GetMeanDesc(primitive_desc_it.fetch());
+    internalBlobDesc.emplace_back([](MKLDNNNode &node, primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
+        auto &self = static_cast<MKLDNNBatchNormalizationNode &>(node);
+        return self.GetMeanDesc(primitive_desc_it.fetch());
     });
 
-    internalBlobDesc.emplace_back([&](primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
-        if (!fusedWithScale())
+    internalBlobDesc.emplace_back([](MKLDNNNode &node, primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
+        auto &self = static_cast<MKLDNNBatchNormalizationNode &>(node);
+        if (!self.fusedWithScale())
             return MKLDNNMemoryDesc();
-        return GetScaleShiftWeightsDesc(primitive_desc_it.fetch());
+        return self.GetScaleShiftWeightsDesc(primitive_desc_it.fetch());
     });
 }
 
@@ -172,7 +172,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                 SizeVector blkDims = parentEdge->getDims().ToSizeVector();
                 blkDims = { blkDims[0], blkDims[2], blkDims[3], blkDims[1] };
 
-                config.inConfs[i].inPlace = -1;     // Change to 0 here if inplace concat is supported for NHWC in mkldnn
+                config.inConfs[i].inPlace = -1;
 
                 config.inConfs[i].desc = TensorDesc(inputPrecision, parentEdge->getDims().ToSizeVector(),
                                                     {blkDims, order, offset, offsets, strides});
@@ -180,6 +180,12 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
 
             supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, mkldnn::memory::nhwc);
 
+            // Inplace variant: inputs are strided views on their channels of the output
+            for (size_t i = 0; i < getParentEdges().size(); i++) {
+                config.inConfs[i].inPlace = 0;
+            }
+            supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, mkldnn::memory::nhwc);
+
             return;
         } else if (numOfDim == 5) {
             // Here we assume NDHWC layout (channels are the last)
@@ -206,7 +212,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                 SizeVector blkDims = parentEdge->getDims().ToSizeVector();
                 blkDims = { blkDims[0], blkDims[2], blkDims[3], blkDims[4], blkDims[1] };
 
-                config.inConfs[i].inPlace = -1;     // Change to 0 here if inplace concat is supported for NDHWC in mkldnn
+                config.inConfs[i].inPlace = -1;
 
                 config.inConfs[i].desc = TensorDesc(inputPrecision, parentEdge->getDims().ToSizeVector(),
                                                     {blkDims, order, offset, offsets, strides});
@@ -214,6 +220,12 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
 
             supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, mkldnn::memory::ndhwc);
 
+            // Inplace variant: inputs are strided views on their channels of the output
+            for (size_t i = 0; i < getParentEdges().size(); i++) {
+                config.inConfs[i].inPlace = 0;
+            }
+            supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, mkldnn::memory::ndhwc);
+
             return;
         }
     }
@@ -293,6 +305,12 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
 }
 
 void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
+    selectDescriptor();
+    if (isOptimized() && isChannelsLast(getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].desc))
+        fixProducersDescriptors();
+}
+
+void MKLDNNConcatNode::selectDescriptor() {
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision);
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(outputPrecision);
 
@@ -304,6 +322,8 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
         if (primDescInfo.getImplementationType() != impl_desc_type::unknown ||
                 primDescInfo.getConfig().inConfs[0].inPlace < 0)
             continue;
+        if (isChannelsLast(primDescInfo.getConfig().outConfs[0].desc) && !canBeInPlaceChannelsLast())
+            continue;
         hasUnknown = true;
         for (auto iInfo : primDescInfo.getConfig().inConfs) {
             if (iInfo.desc.getLayout() != InferenceEngine::Layout::ANY) {
@@ -445,6 +465,83 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
     selectPrimitiveDescriptorByIndex(0);
 }
 
+bool MKLDNNConcatNode::isChannelsLast(const TensorDesc& desc) {
+    const auto& order = desc.getBlockingDesc().getOrder();
+    return order.size() >= 4 && order.size() == desc.getDims().size() && order.back() == 1;
+}
+
+bool MKLDNNConcatNode::isDenseChannelsLast(const TensorDesc& desc) {
+    if (desc.getLayout() == Layout::ANY || !isChannelsLast(desc))
+        return false;
+    const auto& blk = desc.getBlockingDesc();
+    for (size_t i = 0; i < blk.getOrder().size(); i++) {
+        if (blk.getBlockDims()[i] != desc.getDims()[blk.getOrder()[i]])
+            return false;
+    }
+    return true;
+}
+
+bool MKLDNNConcatNode::canBeInPlaceChannelsLast() const {
+    // Inputs of channels last inplace concat are views with the pixel stride of the output,
+    // so unless there is a single pixel per batch their producers have to write through memory strides.
+    // A producer with a defined output descriptor keeps it, and a reorder created for the actual strided
+    // memory is inserted on the edge. A producer with an undefined one would take the view and write a
+    // dense output into it, so it is accepted only if it selected a dense channels last output, which
+    // is then fixed for it by fixProducersDescriptors().
+    const auto& dstDims = getChildEdgeAt(0)->getDims();
+    size_t spatial = 1;
+    for (int i = 2; i < dstDims.ndims(); i++)
+        spatial *= dstDims[i];
+    if (spatial == 1)
+        return true;
+
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto parentEdge = getParentEdgeAt(i);
+        auto parent = parentEdge->getParent();
+        // Other consumers of the same port would read the view as a dense tensor
+        if (parent->getChildEdgesAtPort(parentEdge->getInputNum()).size() != 1)
+            return false;
+
+        auto parentPD = parent->getSelectedPrimitiveDescriptor();
+        if (parentPD == nullptr)
+            return false;
+        const auto& outConfs = parentPD->getConfig().outConfs;
+        size_t port = static_cast<size_t>(parentEdge->getInputNum()) < outConfs.size() ? parentEdge->getInputNum() : 0;
+        // The output of the producer is a view on its input itself
+        if (outConfs[port].inPlace >= 0)
+            return false;
+        if (isUninitTensorDesc(outConfs[port].desc) && !isDenseChannelsLast(outConfs[port].desc))
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNConcatNode::fixProducersDescriptors() {
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto parentEdge = getParentEdgeAt(i);
+        auto parentPD = parentEdge->getParent()->getSelectedPrimitiveDescriptor();
+        auto& outConfs = parentPD->getConfig().outConfs;
+        size_t port = static_cast<size_t>(parentEdge->getInputNum()) < outConfs.size() ? parentEdge->getInputNum() : 0;
+        auto& desc = outConfs[port].desc;
+        if (isUninitTensorDesc(desc))
+            desc = TensorDesc(desc.getPrecision(), desc.getDims(),
+                              {desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder()});
+    }
+}
+
+size_t MKLDNNConcatNode::getInPlaceSavedBytes() const {
+    if (!isOptimized())
+        return 0;
+    // Inputs copied by reorders inserted on the edges are not saved
+    size_t bytes = 0;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto parentEdge = getParentEdgeAt(i);
+        if (parentEdge->getParent()->getType() != Reorder)
+            bytes += parentEdge->getDesc().getPrecision().size() * static_cast<size_t>(parentEdge->getDims().size());
+    }
+    return bytes;
+}
+
 bool MKLDNNConcatNode::created() const {
     return getType() == Concatenation;
 }
@@ -573,12 +670,12 @@ void MKLDNNConcatNode::initOptimalPrimitiveDescriptor() {
                                                              });
         size_t axisSize = 1;
 
-        if (config.inConfs[0].desc.getLayout() == Layout::NHWC) {
+        if (config.inConfs[0].desc.getLayout() == Layout::NHWC || config.inConfs[0].desc.getLayout() == Layout::NDHWC) {
             // This is more general and works for any "direct" Layout (such as nchw or nhwc), but it doesn't work for nchw8c
+            // Block dims are already stored in the blocked order, so the axis is looked up through the order only once
             size_t realAxis = inverseOrder(config.inConfs[0].desc.getBlockingDesc().getOrder(), axis);
             for (size_t j = realAxis; j < config.inConfs[i].desc.getBlockingDesc().getBlockDims().size(); j++) {
-                size_t jj = config.inConfs[0].desc.getBlockingDesc().getOrder()[j];
-                axisSize *= config.inConfs[i].desc.getBlockingDesc().getBlockDims()[jj];
+                axisSize *= config.inConfs[i].desc.getBlockingDesc().getBlockDims()[j];
             }
         } else {
             // This works for nchw and nchw8c/nchw16c
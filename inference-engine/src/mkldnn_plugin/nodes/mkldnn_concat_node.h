@@ -25,11 +25,19 @@ public:
     void execute(mkldnn::stream strm) override;
 
     bool isOptimized() const;
+    // Size of the inputs which are written into the output by their producers without any copy
+    size_t getInPlaceSavedBytes() const;
 
 private:
     size_t axis = 0;
 
     size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
+    static bool isChannelsLast(const InferenceEngine::TensorDesc& desc);
+    static bool isDenseChannelsLast(const InferenceEngine::TensorDesc& desc);
+    bool canBeInPlaceChannelsLast() const;
+    // Producers with undefined output descriptors write a dense output, so they must not take the strided views
+    void fixProducersDescriptors();
+    void selectDescriptor();
 
     InferenceEngine::Precision inputPrecision = InferenceEngine::Precision::FP32;
     InferenceEngine::Precision outputPrecision = InferenceEngine::Precision::FP32;
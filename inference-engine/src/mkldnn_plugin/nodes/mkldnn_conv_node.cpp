@@ -10,6 +10,7 @@
 #include "mkldnn_eltwise_node.h"
 #include "mkldnn_depthwise_node.h"
 #include "mkldnn_quantize_node.h"
+#include "mkldnn_power_node.h"
 #include "mkldnn_pooling_node.h"
 #include "mkldnn_concat_node.h"
 #include <ie_layers.h>
@@ -28,11 +29,12 @@ MKLDNNConvolutionNode::MKLDNNConvolutionNode(const InferenceEngine::CNNLayerPtr&
         : MKLDNNNode(layer, eng, socket), withBiases(false), withSum(false),  dw_conv_iw(0), dw_conv_ih(0),
         dw_conv_oc(0), dw_conv_in_dt(memory::data_type::data_undef), isDW(false), isMerged(false), withActivation(false),
         isGrouped(false), baseInputsNumber(1), eltwisePrecision(Precision::FP32), withDWConv(false), groupNum(1lu) {
-    internalBlobDesc.emplace_back([&](primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
+    internalBlobDesc.emplace_back([](MKLDNNNode &, primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
         return MKLDNNMemoryDesc(primitive_desc_it.weights_primitive_desc(0).desc());
     });
-    internalBlobDesc.emplace_back([&](primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
-        if (!withBiases)
+    internalBlobDesc.emplace_back([](MKLDNNNode &node, primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
+        auto &self = static_cast<MKLDNNConvolutionNode &>(node);
+        if (!self.withBiases)
             return MKLDNNMemoryDesc();
         return MKLDNNMemoryDesc(primitive_desc_it.weights_primitive_desc(1).desc());
     });
@@ -360,6 +362,16 @@ void MKLDNNConvolutionNode::setPostOps(mkldnn::primitive_attr &attr, bool initWe
         }
 #endif
 
+        auto* powerNode = dynamic_cast<MKLDNNPowerNode *>(node.get());
+        if (powerNode) {
+            mkldnn::algorithm alg;
+            float alpha, beta;
+            if (!powerNode->getEltwiseEquivalent(alg, alpha, beta))
+                THROW_IE_EXCEPTION << "Power layer " << powerNode->getName() << " cannot be fused into convolution " << getName();
+            ops.append_eltwise(1.0, alg, alpha, beta);
+            continue;
+        }
+
 #if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
         auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
         if (depthwiseNode) {
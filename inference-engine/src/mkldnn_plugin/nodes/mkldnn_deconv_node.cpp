@@ -19,7 +19,7 @@ using namespace InferenceEngine;
 
 MKLDNNDeconvolutionNode::MKLDNNDeconvolutionNode(const InferenceEngine::CNNLayerPtr& layer,
                                                  const mkldnn::engine& eng, int socket) : MKLDNNNode(layer, eng, socket) {
-    internalBlobDesc.emplace_back([&](primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
+    internalBlobDesc.emplace_back([](MKLDNNNode &, primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
         return MKLDNNMemoryDesc(primitive_desc_it.weights_primitive_desc(0).desc());
     });
 }
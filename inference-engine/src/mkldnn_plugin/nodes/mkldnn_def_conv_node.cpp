@@ -23,11 +23,12 @@ using namespace InferenceEngine;
 MKLDNNDeformableConvolutionNode::MKLDNNDeformableConvolutionNode(const InferenceEngine::CNNLayerPtr& layer,
                                                                  const mkldnn::engine& eng, int socket)
         : MKLDNNNode(layer, eng, socket) {
-    internalBlobDesc.emplace_back([&](primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
+    internalBlobDesc.emplace_back([](MKLDNNNode &, primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
         return MKLDNNMemoryDesc(primitive_desc_it.weights_primitive_desc(0).desc());
     });
-    internalBlobDesc.emplace_back([&](primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
-        if (!withBiases)
+    internalBlobDesc.emplace_back([](MKLDNNNode &node, primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
+        auto &self = static_cast<MKLDNNDeformableConvolutionNode &>(node);
+        if (!self.withBiases)
             return MKLDNNMemoryDesc();
         return MKLDNNMemoryDesc(primitive_desc_it.weights_primitive_desc(1).desc());
     });
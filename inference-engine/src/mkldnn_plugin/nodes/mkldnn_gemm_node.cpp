@@ -11,6 +11,7 @@
 #include <cmath>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -64,6 +65,10 @@ void MKLDNNGemmNode::getSupportedDescriptors() {
 
     isThreeInputs = getParentEdges().size() == 3;
 
+    auto inPrec0 = getCnnLayer()->insData[0].lock()->getPrecision();
+    auto inPrec1 = getCnnLayer()->insData[1].lock()->getPrecision();
+    isInt8 = inPrec0 == Precision::U8 && inPrec1 == Precision::I8;
+
     if (isThreeInputs) {
         auto inDims2 = getParentEdgeAt(2)->getDims();
 
@@ -121,6 +126,12 @@ void MKLDNNGemmNode::initSupportedPrimitiveDescriptors() {
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
 
+    auto getInputDataType = [&] (size_t i) -> memory::data_type {
+        if (isInt8 && i < 2)
+            return i == 0 ? memory::u8 : memory::s8;
+        return inputDataType;
+    };
+
     auto same = [&] (memory::format fmt) -> PrimitiveDescInfo {
         InferenceEngine::LayerConfig config;
         config.dynBatchSupport = true;
@@ -128,7 +139,7 @@ void MKLDNNGemmNode::initSupportedPrimitiveDescriptors() {
             InferenceEngine::DataConfig dataConfig;
             dataConfig.inPlace = -1;
             dataConfig.constant = false;
-            dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), inputDataType, fmt);
+            dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), getInputDataType(i), fmt);
             config.inConfs.push_back(dataConfig);
         }
 
@@ -158,10 +169,13 @@ void MKLDNNGemmNode::initOptimalPrimitiveDescriptor() {
         return;
     }
 
-    // Only FP32 is supported for now
+    // Only FP32 and U8 x I8 inputs are supported for now, the output is always FP32
     auto& selectedConfig = getSelectedPrimitiveDescriptor()->getConfig();
-    for (auto &inConf : selectedConfig.inConfs) {
-        inConf.desc.setPrecision(Precision::FP32);
+    for (size_t i = 0; i < selectedConfig.inConfs.size(); i++) {
+        Precision prec = Precision::FP32;
+        if (isInt8 && i < 2)
+            prec = i == 0 ? Precision::U8 : Precision::I8;
+        selectedConfig.inConfs[i].desc.setPrecision(prec);
     }
 
     for (auto &outConf : selectedConfig.outConfs) {
@@ -187,72 +201,117 @@ void MKLDNNGemmNode::createPrimitive() {
     }
 }
 
-void MKLDNNGemmNode::execute(mkldnn::stream strm) {
+namespace {
+
+inline void run_gemm(const char transa, const char transb, int M, int N, int K, float alpha, const float *A, int lda,
+                     const float *B, int ldb, float beta, const float *C, float *D, int ldc) {
+    if (C) {
+        memcpy(D, C, M * ldc * sizeof(float));
+    } else {
+        beta = 0.f;
+    }
+
+    // Row-major D = op(A) * op(B) is computed as column-major D^T = op(B)^T * op(A)^T
+    mkldnn_sgemm(&transb, &transa, &N, &M, &K, &alpha, B, &ldb, A, &lda, &beta, D, &ldc);
+}
+
+inline void run_gemm(const char transa, const char transb, int M, int N, int K, float alpha, const uint8_t *A, int lda,
+                     const int8_t *B, int ldb, float beta, const float *C, float *D, int ldc) {
+    const char offsetc = 'F';
+    const float one = 1.f;
+    const float zero = 0.f;
+    const int8_t ao = 0;
+    const int8_t bo = 0;
+    const int32_t co = 0;
+
+    // Int32 accumulators are stored in place of the FP32 output and then scaled
+    auto *acc = reinterpret_cast<int32_t *>(D);
+    mkldnn_gemm_s8u8s32(&transb, &transa, &offsetc, &N, &M, &K, &one, B, &ldb, &ao, A, &lda, &bo,
+                        &zero, acc, &ldc, &co);
+
+    const int size = M * ldc;
+    if (C) {
+        for (int i = 0; i < size; i++)
+            D[i] = alpha * static_cast<float>(acc[i]) + beta * C[i];
+    } else {
+        for (int i = 0; i < size; i++)
+            D[i] = alpha * static_cast<float>(acc[i]);
+    }
+}
+
+}  // namespace
+
+template<typename T0, typename T1>
+void MKLDNNGemmNode::process_data() {
     auto inDims0 = getParentEdgeAt(0)->getDims();
-    auto inDims1 = getParentEdgeAt(1)->getDims();
     auto outDims = getChildEdgeAt(0)->getDims();
 
     auto& srcMemory0 = getParentEdgeAt(0)->getMemory();
     auto& srcMemory1 = getParentEdgeAt(1)->getMemory();
-    const float *src0_ptr = reinterpret_cast<const float*>(srcMemory0.GetData()) +
-                            srcMemory0.GetDescriptor().data.layout_desc.blocking.offset_padding;
-    const float *src1_ptr = reinterpret_cast<const float*>(srcMemory1.GetData()) +
-                            srcMemory1.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const T0 *src0_ptr = reinterpret_cast<const T0*>(srcMemory0.GetData()) +
+                         srcMemory0.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const T1 *src1_ptr = reinterpret_cast<const T1*>(srcMemory1.GetData()) +
+                         srcMemory1.GetDescriptor().data.layout_desc.blocking.offset_padding;
     float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
                      getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-    int MB1 = outDims.ndims() == 4 ? batchToProcess() : 1;
-    int MB2 = outDims.ndims() == 3 ? batchToProcess() : outDims.ndims() > 3 ? outDims[outDims.ndims() - 3] : 1;
-    int M = outDims[yAxis];
-    int N = outDims[xAxis];
-    int K = transposeA ? inDims0[yAxis] : inDims0[xAxis];
-
-    const char transa = transposeA ? 'T' : 'N';
-    const char transb = transposeB ? 'T' : 'N';
-
-    int lda = transposeA ? M : K;
-    int ldb = transposeB ? K : N;
-    int ldc = N;
-
-    const float *src2_ptr;
+    const float *src2_ptr = nullptr;
     if (isThreeInputs) {
         auto& srcMemory2 = getParentEdgeAt(2)->getMemory();
         src2_ptr = reinterpret_cast<const float *>(srcMemory2.GetData()) +
-                                srcMemory2.GetDescriptor().data.layout_desc.blocking.offset_padding;
-    } else {
-        src2_ptr = dst_ptr;
-    }
-
-    if (!isThreeInputs) {
-        beta = 0.f;
+                   srcMemory2.GetDescriptor().data.layout_desc.blocking.offset_padding;
     }
 
-    for (int b1 = 0; b1 < MB1; b1++) {
-        const float *a_ptr = src0_ptr;
-        const float *b_ptr = src1_ptr;
-        const float *c_ptr = src2_ptr;
-        float *d_ptr = dst_ptr;
-
-        for (int b2 = 0; b2 < MB2; b2++) {
-            if (isThreeInputs) {
-                memcpy(d_ptr, c_ptr, M * N * sizeof(float));
-                c_ptr += cOffsets[0];
-            }
+    const int MB1 = outDims.ndims() == 4 ? batchToProcess() : 1;
+    const int MB2 = outDims.ndims() == 3 ? batchToProcess() : outDims.ndims() > 3 ? outDims[outDims.ndims() - 3] : 1;
+    const int M = outDims[yAxis];
+    const int N = outDims[xAxis];
+    const int K = transposeA ? inDims0[yAxis] : inDims0[xAxis];
 
-            mkldnn_sgemm(&transb, &transa, &N, &M, &K, &alpha, b_ptr, &ldb, a_ptr, &lda, &beta, d_ptr, &ldc);
+    const char transa = transposeA ? 'T' : 'N';
+    const char transb = transposeB ? 'T' : 'N';
 
-            a_ptr += aOffsets[0];
-            b_ptr += bOffsets[0];
-            d_ptr += M * N;
-        }
+    const int lda = transposeA ? M : K;
+    const int ldb = transposeB ? K : N;
+    const int ldc = N;
+
+    // When there are fewer matrices than threads, rows of each output matrix are split
+    // between threads too, so a few large GEMMs still occupy the whole machine
+    const int minRowsPerBlock = 16;
+    const int nthr = parallel_get_max_threads();
+    const int MB = MB1 * MB2;
+    int mBlocks = 1;
+    if (MB < nthr)
+        mBlocks = std::max(1, std::min(div_up(nthr, MB), M / minRowsPerBlock));
+    const int mBlockSize = div_up(M, mBlocks);
+    mBlocks = div_up(M, mBlockSize);
+
+    // Broadcasted batch dimensions have zero offsets, so the same matrix is reused without copying
+    auto kernel = [&](int b1, int b2, int mb) {
+        const int m0 = mb * mBlockSize;
+        const int mCur = std::min(mBlockSize, M - m0);
+
+        const T0 *a_ptr = src0_ptr + b1 * aOffsets[1] + b2 * aOffsets[0] + (transposeA ? m0 : m0 * lda);
+        const T1 *b_ptr = src1_ptr + b1 * bOffsets[1] + b2 * bOffsets[0];
+        const float *c_ptr = isThreeInputs ? src2_ptr + b1 * cOffsets[1] + b2 * cOffsets[0] + m0 * ldc : nullptr;
+        float *d_ptr = dst_ptr + (b1 * MB2 + b2) * M * N + m0 * ldc;
+
+        run_gemm(transa, transb, mCur, N, K, alpha, a_ptr, lda, b_ptr, ldb, beta, c_ptr, d_ptr, ldc);
+    };
 
-        src0_ptr += aOffsets[1];
-        src1_ptr += bOffsets[1];
-        dst_ptr += MB2 * M * N;
+    if (MB * mBlocks == 1) {
+        // A single GEMM is threaded by mkldnn itself
+        kernel(0, 0, 0);
+    } else {
+        parallel_for3d(MB1, MB2, mBlocks, kernel);
+    }
+}
 
-        if (isThreeInputs) {
-            src2_ptr += cOffsets[1];
-        }
+void MKLDNNGemmNode::execute(mkldnn::stream strm) {
+    if (isInt8) {
+        process_data<uint8_t, int8_t>();
+    } else {
+        process_data<float, float>();
     }
 }
 
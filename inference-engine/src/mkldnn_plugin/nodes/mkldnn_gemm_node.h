@@ -25,6 +25,8 @@ public:
     int getMaxBatch() override;
 
 private:
+    template<typename T0, typename T1> void process_data();
+
     float alpha = 1.0f;
     float beta = 1.0f;
     bool transposeA = false;
@@ -34,6 +36,8 @@ private:
     int yAxis = 0;
 
     bool isThreeInputs = false;
+    // u8 x s8 inputs are multiplied by the integer GEMM with FP32 output
+    bool isInt8 = false;
 
     std::vector<int> aOffsets;
     std::vector<int> bOffsets;
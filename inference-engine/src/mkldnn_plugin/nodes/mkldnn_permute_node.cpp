@@ -10,6 +10,7 @@
 #include "ie_parallel.hpp"
 #include "jit_generator.hpp"
 #include <algorithm>
+#include <numeric>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -171,6 +172,8 @@ void MKLDNNPermuteNode::initSupportedPrimitiveDescriptors() {
         config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nchw);
         supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, memory::nchw});
 
+        addInPlaceDescriptor(config, inputDataType, outputDataType, memory::nhwc, memory::nchw);
+
         auto srcDims = getParentEdgeAt(0)->getDims();
         if (srcDims[1] % 8 == 0) {
             config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nChw8c);
@@ -192,6 +195,8 @@ void MKLDNNPermuteNode::initSupportedPrimitiveDescriptors() {
         config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::ncdhw);
         supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, memory::ncdhw});
 
+        addInPlaceDescriptor(config, inputDataType, outputDataType, memory::ndhwc, memory::ncdhw);
+
         auto srcDims = getParentEdgeAt(0)->getDims();
         if (srcDims[1] % 8 == 0) {
             config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nCdhw8c);
@@ -216,6 +221,29 @@ void MKLDNNPermuteNode::initSupportedPrimitiveDescriptors() {
     }
 }
 
+void MKLDNNPermuteNode::addInPlaceDescriptor(InferenceEngine::LayerConfig config, memory::data_type inputDataType,
+                                             memory::data_type outputDataType, memory::format channelsLast,
+                                             memory::format plain) {
+    // Moving channels to the end of channels first tensor is a no-op when the producer already keeps the data
+    // in channels last layout, so output shares the input memory and only the dimensions are reinterpreted.
+    // The descriptor is not first in the list, hence it is selected only if the parent layout matches it.
+    SizeVector channelsLastOrder(order.size());
+    std::iota(channelsLastOrder.begin(), channelsLastOrder.end(), 0);
+    channelsLastOrder.erase(channelsLastOrder.begin() + 1);
+    channelsLastOrder.push_back(1);
+    if (order != channelsLastOrder)
+        return;
+
+    auto parentEdge = getParentEdgeAt(0);
+    if (parentEdge->getParent()->getChildEdges().size() != 1 || parentEdge->getParent()->isConstant())
+        return;
+
+    config.inConfs[0].desc = MKLDNNMemoryDesc(parentEdge->getDims(), inputDataType, channelsLast);
+    config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, plain);
+    config.outConfs[0].inPlace = 0;
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, plain});
+}
+
 void MKLDNNPermuteNode::createPrimitive() {
     auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
@@ -225,6 +253,8 @@ void MKLDNNPermuteNode::createPrimitive() {
         THROW_IE_EXCEPTION << "Input memory didn't allocate.";
     if (getSelectedPrimitiveDescriptor() == nullptr)
         THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set.";
+    if (isInplace())
+        return;
 
     Precision precision = getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getPrecision();
     auto data_type = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
@@ -867,6 +897,9 @@ std::multimap<InferenceEngine::SizeVector, MKLDNNPermuteNode::PermuteImpl> MKLDN
 };
 
 void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
+    if (isInplace())
+        return;
+
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
 
@@ -56,6 +56,10 @@ public:
     }
 
 private:
+    void addInPlaceDescriptor(InferenceEngine::LayerConfig config, mkldnn::memory::data_type inputDataType,
+                              mkldnn::memory::data_type outputDataType, mkldnn::memory::format channelsLast,
+                              mkldnn::memory::format plain);
+
     InferenceEngine::SizeVector order;
     InferenceEngine::Precision prec;
 
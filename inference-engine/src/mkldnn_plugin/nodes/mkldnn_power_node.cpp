@@ -117,6 +117,28 @@ void MKLDNNPowerNode::execute(mkldnn::stream strm) {
     }
 }
 
+bool MKLDNNPowerNode::getEltwiseEquivalent(mkldnn::algorithm &alg, float &alpha, float &beta) const {
+    auto * powerLayer = dynamic_cast<PowerLayer*>(getCnnLayer().get());
+    if (powerLayer == nullptr)
+        return false;
+
+    if (powerLayer->power == 1.0f) {
+        alg = eltwise_linear;
+        alpha = powerLayer->scale;
+        beta = powerLayer->offset;
+        return true;
+    }
+
+    if (powerLayer->power == 2.0f && powerLayer->scale == 1.0f && powerLayer->offset == 0.0f) {
+        alg = eltwise_square;
+        alpha = 0.0f;
+        beta = 0.0f;
+        return true;
+    }
+
+    return false;
+}
+
 bool MKLDNNPowerNode::created() const {
     return getType() == Power;
 }
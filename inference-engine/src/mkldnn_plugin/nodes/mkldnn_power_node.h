@@ -21,6 +21,10 @@ public:
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
+    // Linear power layers and squares of the input are the eltwise functions,
+    // so they can be applied as post operation of the producer primitive
+    bool getEltwiseEquivalent(mkldnn::algorithm &alg, float &alpha, float &beta) const;
+
 private:
     float scale;
     float shift;
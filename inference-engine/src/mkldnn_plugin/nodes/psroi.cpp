@@ -5,6 +5,7 @@
 #include "list.hpp"
 #include "base.hpp"
 #include <cmath>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <algorithm>
@@ -85,7 +86,12 @@ public:
 
         size_t num_bins = spatial_bins_x_*spatial_bins_y_;
 
-        parallel_for(real_rois, [&](int n) {
+        const bool mode_average = mode_ == "average";
+        const bool mode_bilinear = mode_ == "bilinear";
+        const bool mode_bilinear_deformable = mode_ == "bilinear_deformable";
+
+        // Work is split over ROIs and output channels, so a few ROIs still load all threads
+        parallel_for2d(real_rois, nc, [&](int n, int c) {
             const float* bottom_rois = bottom_rois_beginning + n * 5;
             int roi_batch_ind = static_cast<int>(bottom_rois[0]);
             float roi_start_w = 0.0f;
@@ -95,14 +101,14 @@ public:
             float roi_width   = 0.0f;
             float roi_height  = 0.0f;
 
-            if (mode_ == "bilinear") {
+            if (mode_bilinear) {
                 roi_start_w = bottom_rois[1] * spatial_scale_;
                 roi_start_h = bottom_rois[2] * spatial_scale_;
                 roi_end_w = bottom_rois[3] * spatial_scale_;
                 roi_end_h = bottom_rois[4] * spatial_scale_;
                 roi_width  = roi_end_w - roi_start_w;
                 roi_height = roi_end_h - roi_start_h;
-            } else if (mode_ == "average") {
+            } else if (mode_average) {
                 roi_start_w = static_cast<float>(round(bottom_rois[1])) * spatial_scale_;
                 roi_start_h = static_cast<float>(round(bottom_rois[2])) * spatial_scale_;
                 roi_end_w   = static_cast<float>(round(bottom_rois[3]) + 1.0f) * spatial_scale_;
@@ -110,7 +116,7 @@ public:
                 // Force too small ROIs to be 1x1
                 roi_width  = std::max<float>(roi_end_w - roi_start_w, 0.1f);  // avoid 0
                 roi_height = std::max<float>(roi_end_h - roi_start_h, 0.1f);
-            } else if (mode_ == "bilinear_deformable") {
+            } else if (mode_bilinear_deformable) {
                 roi_start_w = static_cast<float>(round(bottom_rois[1])) * spatial_scale_ - 0.5f;
                 roi_start_h = static_cast<float>(round(bottom_rois[2])) * spatial_scale_ - 0.5f;
                 roi_end_w   = static_cast<float>(round(bottom_rois[3]) + 1.0f) * spatial_scale_ - 0.5f;
@@ -120,143 +126,140 @@ public:
                 roi_height = std::max<float>(roi_end_h - roi_start_h, 0.1f);
             }
 
-            for (int c = 0; c < nc; c++) {
-                for (int h = 0; h < nh; h++) {
-                    for (int w = 0; w < nw; w++) {
-                        size_t index = n*nc*nh*nw + c*nh*nw + h*nw + w;
-                        dst_data[index] = 0.0f;
+            for (int h = 0; h < nh; h++) {
+                for (int w = 0; w < nw; w++) {
+                    size_t index = n*nc*nh*nw + c*nh*nw + h*nw + w;
+                    dst_data[index] = 0.0f;
 
-                        if (mode_ == "average") {
-                            float bin_size_h = roi_height / static_cast<float>(pooled_height_);
-                            float bin_size_w = roi_width  / static_cast<float>(pooled_width_);
+                    if (mode_average) {
+                        float bin_size_h = roi_height / static_cast<float>(pooled_height_);
+                        float bin_size_w = roi_width  / static_cast<float>(pooled_width_);
 
-                            int hstart = static_cast<int>(floor(static_cast<float>(h + 0) * bin_size_h + roi_start_h));
-                            int hend = static_cast<int>(ceil(static_cast<float>(h + 1) * bin_size_h + roi_start_h));
+                        int hstart = static_cast<int>(floor(static_cast<float>(h + 0) * bin_size_h + roi_start_h));
+                        int hend = static_cast<int>(ceil(static_cast<float>(h + 1) * bin_size_h + roi_start_h));
 
-                            hstart = std::min<int>(std::max<int>(hstart, 0), height);
-                            hend = std::min<int>(std::max<int>(hend, 0), height);
-                            int wstart = static_cast<int>(floor(static_cast<float>(w + 0) * bin_size_w + roi_start_w));
-                            int wend = static_cast<int>(ceil(static_cast<float>(w + 1) * bin_size_w + roi_start_w));
+                        hstart = std::min<int>(std::max<int>(hstart, 0), height);
+                        hend = std::min<int>(std::max<int>(hend, 0), height);
+                        int wstart = static_cast<int>(floor(static_cast<float>(w + 0) * bin_size_w + roi_start_w));
+                        int wend = static_cast<int>(ceil(static_cast<float>(w + 1) * bin_size_w + roi_start_w));
 
-                            wstart = std::min<int>(std::max<int>(wstart, 0), width);
-                            wend = std::min<int>(std::max<int>(wend, 0), width);
+                        wstart = std::min<int>(std::max<int>(wstart, 0), width);
+                        wend = std::min<int>(std::max<int>(wend, 0), width);
 
-                            float bin_area = static_cast<float>((hend - hstart) * (wend - wstart));
-                            if (bin_area) {
-                                int gc = (c * group_size_ + h) * group_size_ + w;
-                                const float *bottom_data =
-                                        bottom_data_beginning + ((roi_batch_ind * channels + gc) * height * width);
+                        float bin_area = static_cast<float>((hend - hstart) * (wend - wstart));
+                        if (bin_area) {
+                            int gc = (c * group_size_ + h) * group_size_ + w;
+                            const float *bottom_data =
+                                    bottom_data_beginning + ((roi_batch_ind * channels + gc) * height * width);
 
-                                float out_sum = 0.0f;
-                                for (int hh = hstart; hh < hend; ++hh)
-                                    for (int ww = wstart; ww < wend; ++ww)
-                                        out_sum += bottom_data[hh * width + ww];
+                            float out_sum = 0.0f;
+                            for (int hh = hstart; hh < hend; ++hh)
+                                for (int ww = wstart; ww < wend; ++ww)
+                                    out_sum += bottom_data[hh * width + ww];
 
-                                dst_data[index] = out_sum / bin_area;
-                            }
-                        } else if (mode_ == "bilinear") {
-                            for (size_t bin_y = 0; bin_y < spatial_bins_y_; bin_y++) {
-                                for (size_t bin_x = 0; bin_x < spatial_bins_x_; bin_x++) {
-                                    float box_xmin = roi_start_w + (bin_x + 0) * (roi_width / spatial_bins_x_);
-                                    float box_xmax = roi_start_w + (bin_x + 1) * (roi_width / spatial_bins_x_);
-                                    float box_ymin = roi_start_h + (bin_y + 0) * (roi_height / spatial_bins_y_);
-                                    float box_ymax = roi_start_h + (bin_y + 1) * (roi_height / spatial_bins_y_);
-
-                                    size_t gc = c + (bin_y*spatial_bins_x_ + bin_x)*nc;
-                                    size_t src_idx = (roi_batch_ind * channels + gc) * height * width;
-                                    const float *bottom_data = bottom_data_beginning + src_idx;
-
-                                    float height_scale = nh > 1 ? (box_ymax - box_ymin) * (height - 1) / (pooled_height_ - 1)
-                                                                : 0.0f;
-                                    float width_scale = nw > 1 ? (box_xmax - box_xmin) * (width - 1) / (pooled_width_ - 1)
-                                                               : 0.0f;
-
-                                    float in_y = nh > 1 ? (h * height_scale + box_ymin * (height - 1))
-                                                        : 0.5f * (box_ymin + box_ymax) * (height - 1);
-                                    float in_x = nw > 1 ? (w * width_scale + box_xmin * (width - 1))
-                                                        : 0.5f * (box_xmin + box_xmax) * (width - 1);
-
-                                    if (!(in_y < 0 || in_y > height - 1 || in_x < 0 || in_x > width - 1)) {
-                                        int top_y_index = static_cast<int>(floorf(in_y));
-                                        int bottom_y_index = static_cast<int>(ceilf(in_y));
-                                        int left_x_index = static_cast<int>(floorf(in_x));
-                                        int right_x_index = static_cast<int>(ceilf(in_x));
-
-                                        if (right_x_index > width - 1)
-                                            right_x_index = width - 1;
-
-                                        if (bottom_y_index > height - 1)
-                                            bottom_y_index = height - 1;
-
-                                        const float top_left = bottom_data[top_y_index * width + left_x_index];
-                                        const float top_right = bottom_data[top_y_index * width + right_x_index];
-                                        const float bottom_left = bottom_data[bottom_y_index * width + left_x_index];
-                                        const float bottom_right = bottom_data[bottom_y_index * width + right_x_index];
-
-                                        const float top = top_left + (top_right - top_left) * (in_x - left_x_index);
-                                        const float bottom = bottom_left + (bottom_right - bottom_left) * (in_x - left_x_index);
-
-                                        dst_data[index] += top + (bottom - top) * (in_y - top_y_index);
-                                    }
+                            dst_data[index] = out_sum / bin_area;
+                        }
+                    } else if (mode_bilinear) {
+                        for (size_t bin_y = 0; bin_y < spatial_bins_y_; bin_y++) {
+                            for (size_t bin_x = 0; bin_x < spatial_bins_x_; bin_x++) {
+                                float box_xmin = roi_start_w + (bin_x + 0) * (roi_width / spatial_bins_x_);
+                                float box_xmax = roi_start_w + (bin_x + 1) * (roi_width / spatial_bins_x_);
+                                float box_ymin = roi_start_h + (bin_y + 0) * (roi_height / spatial_bins_y_);
+                                float box_ymax = roi_start_h + (bin_y + 1) * (roi_height / spatial_bins_y_);
+
+                                size_t gc = c + (bin_y*spatial_bins_x_ + bin_x)*nc;
+                                size_t src_idx = (roi_batch_ind * channels + gc) * height * width;
+                                const float *bottom_data = bottom_data_beginning + src_idx;
+
+                                float height_scale = nh > 1 ? (box_ymax - box_ymin) * (height - 1) / (pooled_height_ - 1)
+                                                            : 0.0f;
+                                float width_scale = nw > 1 ? (box_xmax - box_xmin) * (width - 1) / (pooled_width_ - 1)
+                                                           : 0.0f;
+
+                                float in_y = nh > 1 ? (h * height_scale + box_ymin * (height - 1))
+                                                    : 0.5f * (box_ymin + box_ymax) * (height - 1);
+                                float in_x = nw > 1 ? (w * width_scale + box_xmin * (width - 1))
+                                                    : 0.5f * (box_xmin + box_xmax) * (width - 1);
+
+                                if (!(in_y < 0 || in_y > height - 1 || in_x < 0 || in_x > width - 1)) {
+                                    int top_y_index = static_cast<int>(floorf(in_y));
+                                    int bottom_y_index = static_cast<int>(ceilf(in_y));
+                                    int left_x_index = static_cast<int>(floorf(in_x));
+                                    int right_x_index = static_cast<int>(ceilf(in_x));
+
+                                    if (right_x_index > width - 1)
+                                        right_x_index = width - 1;
+
+                                    if (bottom_y_index > height - 1)
+                                        bottom_y_index = height - 1;
+
+                                    const float top_left = bottom_data[top_y_index * width + left_x_index];
+                                    const float top_right = bottom_data[top_y_index * width + right_x_index];
+                                    const float bottom_left = bottom_data[bottom_y_index * width + left_x_index];
+                                    const float bottom_right = bottom_data[bottom_y_index * width + right_x_index];
+
+                                    const float top = top_left + (top_right - top_left) * (in_x - left_x_index);
+                                    const float bottom = bottom_left + (bottom_right - bottom_left) * (in_x - left_x_index);
+
+                                    dst_data[index] += top + (bottom - top) * (in_y - top_y_index);
                                 }
                             }
-                            dst_data[index] /= num_bins;
-                        } else if (mode_ == "bilinear_deformable") {
-                            // Compute w and h at bottom
-                            float bin_size_h = roi_height / static_cast<float>(pooled_height_);
-                            float bin_size_w = roi_width  / static_cast<float>(pooled_width_);
-
-                            float sub_bin_size_h = bin_size_h / static_cast<float>(spatial_bins_x_);
-                            float sub_bin_size_w = bin_size_w / static_cast<float>(spatial_bins_y_);
-
-                            int part_h = h * part_size_ / pooled_height_;
-                            int part_w = w * part_size_ / pooled_width_;
-                            int class_id = c / channels_each_class;
-                            float trans_x = no_trans_ ? 0 :
-                                    bottom_trans[(((n * num_classes + class_id) * 2) * part_size_ + part_h)
-                                                                                      * part_size_ + part_w] * trans_std_;
-                            float trans_y = no_trans_ ? 0 :
-                                            bottom_trans[(((n * num_classes + class_id) * 2 + 1) * part_size_ + part_h)
-                                                         * part_size_ + part_w] * trans_std_;
-
-                            float wstart = w * bin_size_w + roi_start_w + trans_x * roi_width;
-                            float hstart = h * bin_size_h + roi_start_h + trans_y * roi_height;
-
-                            float sum = 0;
-                            int count = 0;
-                            int gw = w * group_size_ / pooled_width_;
-                            int gh = h * group_size_ / pooled_height_;
-                            gw = (std::min)((std::max)(gw, 0), static_cast<int>(group_size_ - 1));
-                            gh = (std::min)((std::max)(gh, 0), static_cast<int>(group_size_ - 1));
-
-                            const float* offset_bottom_data = bottom_data_beginning + (roi_batch_ind * channels) * height * width;
-                            for (size_t ih = 0; ih < spatial_bins_y_; ih++) {
-                                for (size_t iw = 0; iw < spatial_bins_x_; iw++) {
-                                    float w1 = wstart + iw * sub_bin_size_w;
-                                    float h1 = hstart + ih * sub_bin_size_h;
-                                    // bilinear interpolation
-                                    if (w1 < -0.5 || w1 > width - 0.5 || h1 < -0.5 || h1 > height - 0.5)
-                                        continue;
-                                    w1 = static_cast<float>((std::min)((std::max)(static_cast<double>(w1), 0.0), width - 1.0));
-                                    h1 = static_cast<float>((std::min)((std::max)(static_cast<double>(h1), 0.0), height - 1.0));
-                                    int c1 = static_cast<int>((c * group_size_ + gh) * group_size_ + gw);
-                                    float val = bilinear_interp(offset_bottom_data + c1 * height * width, w1, h1, width);
-                                    sum += val;
-                                    count++;
-                                }
+                        }
+                        dst_data[index] /= num_bins;
+                    } else if (mode_bilinear_deformable) {
+                        // Compute w and h at bottom
+                        float bin_size_h = roi_height / static_cast<float>(pooled_height_);
+                        float bin_size_w = roi_width  / static_cast<float>(pooled_width_);
+
+                        float sub_bin_size_h = bin_size_h / static_cast<float>(spatial_bins_x_);
+                        float sub_bin_size_w = bin_size_w / static_cast<float>(spatial_bins_y_);
+
+                        int part_h = h * part_size_ / pooled_height_;
+                        int part_w = w * part_size_ / pooled_width_;
+                        int class_id = c / channels_each_class;
+                        float trans_x = no_trans_ ? 0 :
+                                bottom_trans[(((n * num_classes + class_id) * 2) * part_size_ + part_h)
+                                                                                  * part_size_ + part_w] * trans_std_;
+                        float trans_y = no_trans_ ? 0 :
+                                        bottom_trans[(((n * num_classes + class_id) * 2 + 1) * part_size_ + part_h)
+                                                     * part_size_ + part_w] * trans_std_;
+
+                        float wstart = w * bin_size_w + roi_start_w + trans_x * roi_width;
+                        float hstart = h * bin_size_h + roi_start_h + trans_y * roi_height;
+
+                        float sum = 0;
+                        int count = 0;
+                        int gw = w * group_size_ / pooled_width_;
+                        int gh = h * group_size_ / pooled_height_;
+                        gw = (std::min)((std::max)(gw, 0), static_cast<int>(group_size_ - 1));
+                        gh = (std::min)((std::max)(gh, 0), static_cast<int>(group_size_ - 1));
+
+                        const float* offset_bottom_data = bottom_data_beginning + (roi_batch_ind * channels) * height * width;
+                        for (size_t ih = 0; ih < spatial_bins_y_; ih++) {
+                            for (size_t iw = 0; iw < spatial_bins_x_; iw++) {
+                                float w1 = wstart + iw * sub_bin_size_w;
+                                float h1 = hstart + ih * sub_bin_size_h;
+                                // bilinear interpolation
+                                if (w1 < -0.5 || w1 > width - 0.5 || h1 < -0.5 || h1 > height - 0.5)
+                                    continue;
+                                w1 = static_cast<float>((std::min)((std::max)(static_cast<double>(w1), 0.0), width - 1.0));
+                                h1 = static_cast<float>((std::min)((std::max)(static_cast<double>(h1), 0.0), height - 1.0));
+                                int c1 = static_cast<int>((c * group_size_ + gh) * group_size_ + gw);
+                                float val = bilinear_interp(offset_bottom_data + c1 * height * width, w1, h1, width);
+                                sum += val;
+                                count++;
                             }
-                            dst_data[index] = count == 0 ? 0 : sum / count;
                         }
+                        dst_data[index] = count == 0 ? 0 : sum / count;
                     }
                 }
             }
         });
 
-        for (int n = real_rois; n < nn; n++) {
-            parallel_for3d(nc, nh, nw, [&](int c, int h, int w) {
-                int index = n * nc * nh * nw + c * nh * nw + h * nw + w;
-                dst_data[index] = 0.0f;
-            });
+        if (real_rois < nn) {
+            size_t tail_offset = static_cast<size_t>(real_rois) * nc * nh * nw;
+            size_t tail_size = static_cast<size_t>(nn - real_rois) * nc * nh * nw;
+            memset(dst_data + tail_offset, 0, tail_size * sizeof(float));
         }
 
         return OK;
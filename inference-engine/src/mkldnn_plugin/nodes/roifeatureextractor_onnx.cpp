@@ -14,12 +14,128 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <memory>
 #include "ie_parallel.hpp"
+#include "jit_generator.hpp"
+
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+#define GET_OFF(field) offsetof(jit_args_roi_align, field)
+
+struct jit_args_roi_align {
+    const float *src;
+    const int *offsets;
+    const float *weights;
+    float *dst;
+    size_t bins;
+    size_t samples;
+    float scale;
+};
+
+struct jit_uni_roi_align_kernel {
+    void (*ker_)(const jit_args_roi_align *);
+
+    void operator()(const jit_args_roi_align *args) { assert(ker_); ker_(args); }
+
+    jit_uni_roi_align_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_roi_align_kernel() {}
+};
+
+// Averages bilinear samples for all bins of one ROI and one channel block of nChw8c/nChw16c feature map.
+// Each sampling point has four byte offsets to the neighbouring pixels and four weights shared by all channels.
+template <cpu_isa_t isa>
+struct jit_uni_roi_align_kernel_f32 : public jit_uni_roi_align_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_roi_align_kernel_f32)
+
+    explicit jit_uni_roi_align_kernel_f32(int block_size) : jit_uni_roi_align_kernel(), jit_generator() {
+        const int repeats = block_size * sizeof(float) / vlen;
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_offsets, ptr[reg_params + GET_OFF(offsets)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_bins, ptr[reg_params + GET_OFF(bins)]);
+        mov(reg_samples, ptr[reg_params + GET_OFF(samples)]);
+        uni_vbroadcastss(vmm_scale, ptr[reg_params + GET_OFF(scale)]);
+
+        Xbyak::Label bins_loop_label;
+        Xbyak::Label bins_end_label;
+        Xbyak::Label samples_loop_label;
+        Xbyak::Label samples_end_label;
+
+        L(bins_loop_label);
+        {
+            cmp(reg_bins, 0);
+            je(bins_end_label, T_NEAR);
+
+            for (int r = 0; r < repeats; r++)
+                uni_vpxor(get_acc(r), get_acc(r), get_acc(r));
+
+            mov(reg_work, reg_samples);
+            L(samples_loop_label);
+            {
+                cmp(reg_work, 0);
+                je(samples_end_label, T_NEAR);
+
+                for (int k = 0; k < 4; k++) {
+                    movsxd(reg_off, dword[reg_offsets + k * sizeof(int)]);
+                    uni_vbroadcastss(vmm_weight, ptr[reg_weights + k * sizeof(float)]);
+                    for (int r = 0; r < repeats; r++) {
+                        uni_vmovups(vmm_src, ptr[reg_src + reg_off + r * vlen]);
+                        uni_vfmadd231ps(get_acc(r), vmm_src, vmm_weight);
+                    }
+                }
+
+                add(reg_offsets, 4 * sizeof(int));
+                add(reg_weights, 4 * sizeof(float));
+                sub(reg_work, 1);
+                jmp(samples_loop_label, T_NEAR);
+            }
+            L(samples_end_label);
+
+            for (int r = 0; r < repeats; r++) {
+                uni_vmulps(get_acc(r), get_acc(r), vmm_scale);
+                uni_vmovups(ptr[reg_dst + r * vlen], get_acc(r));
+            }
+
+            add(reg_dst, block_size * sizeof(float));
+            sub(reg_bins, 1);
+            jmp(bins_loop_label, T_NEAR);
+        }
+        L(bins_end_label);
+
+        this->postamble();
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == sse42, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Vmm get_acc(int idx) { return Vmm(3 + idx); }
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_offsets = r9;
+    Xbyak::Reg64 reg_weights = r10;
+    Xbyak::Reg64 reg_dst = r11;
+    Xbyak::Reg64 reg_bins = r12;
+    Xbyak::Reg64 reg_samples = r13;
+    Xbyak::Reg64 reg_work = r14;
+    Xbyak::Reg64 reg_off = r15;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_scale = Vmm(0);
+    Vmm vmm_weight = Vmm(1);
+    Vmm vmm_src = Vmm(2);
+};
+
 // implementation taken from Caffe2
 template <typename T>
 struct PreCalc {
@@ -129,9 +245,64 @@ void pre_calc_for_bilinear_interpolate(
   }
 }
 
+template <typename T>
+struct ROISampling {
+  int roi_bin_grid_h;
+  int roi_bin_grid_w;
+  std::vector<PreCalc<T>> pre_calc;
+};
+
+// Sampling points and bilinear weights depend only on ROI, so they are shared by all channels
+template <typename T>
+void ROIAlignPrepareSampling(
+    const T& spatial_scale,
+    const int height,
+    const int width,
+    const int pooled_height,
+    const int pooled_width,
+    const int sampling_ratio,
+    const T* bottom_rois,
+    ROISampling<T>& sampling) {
+  // Do not using rounding; this implementation detail is critical
+  T roi_start_w = bottom_rois[0] * spatial_scale;
+  T roi_start_h = bottom_rois[1] * spatial_scale;
+  T roi_end_w = bottom_rois[2] * spatial_scale;
+  T roi_end_h = bottom_rois[3] * spatial_scale;
+
+  // Force malformed ROIs to be 1x1
+  T roi_width = (std::max)(roi_end_w - roi_start_w, (T)1.);
+  T roi_height = (std::max)(roi_end_h - roi_start_h, (T)1.);
+  T bin_size_h = static_cast<T>(roi_height) / static_cast<T>(pooled_height);
+  T bin_size_w = static_cast<T>(roi_width) / static_cast<T>(pooled_width);
+
+  // We use roi_bin_grid to sample the grid and mimic integral
+  sampling.roi_bin_grid_h = (sampling_ratio > 0)
+      ? sampling_ratio
+      : static_cast<int>(ceil(roi_height / pooled_height));  // e.g., = 2
+  sampling.roi_bin_grid_w =
+      (sampling_ratio > 0) ? sampling_ratio : static_cast<int>(ceil(roi_width / pooled_width));
+
+  sampling.pre_calc.resize(
+      sampling.roi_bin_grid_h * sampling.roi_bin_grid_w * pooled_width * pooled_height);
+  pre_calc_for_bilinear_interpolate(
+      height,
+      width,
+      pooled_height,
+      pooled_width,
+      sampling.roi_bin_grid_h,
+      sampling.roi_bin_grid_w,
+      roi_start_h,
+      roi_start_w,
+      bin_size_h,
+      bin_size_w,
+      sampling.roi_bin_grid_h,
+      sampling.roi_bin_grid_w,
+      sampling.pre_calc);
+}
+
 template <typename T>
 void ROIAlignForward_cpu_kernel(
-    const int nthreads,
+    const int n_rois,
     const T* bottom_data,
     const T& spatial_scale,
     const int channels,
@@ -141,91 +312,147 @@ void ROIAlignForward_cpu_kernel(
     const int pooled_width,
     const int sampling_ratio,
     const T* bottom_rois,
+    const int* rois_mapping,
     T* top_data) {
   int roi_cols = 4;
+  const int feaxels_per_roi = channels * pooled_width * pooled_height;
 
-  int n_rois = nthreads / channels / pooled_width / pooled_height;
-  // (n, c, ph, pw) is an element in the pooled output
+  std::vector<ROISampling<T>> samplings(n_rois);
   parallel_for(n_rois, [&](size_t n) {
-    int index_n = n * channels * pooled_width * pooled_height;
-
-    // roi could have 4 or 5 columns
-    const T* offset_bottom_rois = bottom_rois + n * roi_cols;
-    int roi_batch_ind = 0;
-    if (roi_cols == 5) {
-      roi_batch_ind = static_cast<int>(offset_bottom_rois[0]);
-      offset_bottom_rois++;
-    }
+    ROIAlignPrepareSampling(spatial_scale, height, width, pooled_height, pooled_width, sampling_ratio,
+                            bottom_rois + n * roi_cols, samplings[n]);
+  });
 
-    // Do not using rounding; this implementation detail is critical
-    T roi_start_w = offset_bottom_rois[0] * spatial_scale;
-    T roi_start_h = offset_bottom_rois[1] * spatial_scale;
-    T roi_end_w = offset_bottom_rois[2] * spatial_scale;
-    T roi_end_h = offset_bottom_rois[3] * spatial_scale;
-
-    // Force malformed ROIs to be 1x1
-    T roi_width = (std::max)(roi_end_w - roi_start_w, (T)1.);
-    T roi_height = (std::max)(roi_end_h - roi_start_h, (T)1.);
-    T bin_size_h = static_cast<T>(roi_height) / static_cast<T>(pooled_height);
-    T bin_size_w = static_cast<T>(roi_width) / static_cast<T>(pooled_width);
-
-    // We use roi_bin_grid to sample the grid and mimic integral
-    int roi_bin_grid_h = (sampling_ratio > 0)
-        ? sampling_ratio
-        : static_cast<int>(ceil(roi_height / pooled_height));  // e.g., = 2
-    int roi_bin_grid_w =
-        (sampling_ratio > 0) ? sampling_ratio : static_cast<int>(ceil(roi_width / pooled_width));
+  // (n, c, ph, pw) is an element in the pooled output
+  parallel_for2d(n_rois, channels, [&](int n, int c) {
+    const ROISampling<T>& sampling = samplings[n];
+    const int roi_bin_grid_h = sampling.roi_bin_grid_h;
+    const int roi_bin_grid_w = sampling.roi_bin_grid_w;
 
     // We do average (integral) pooling inside a bin
     const T count = static_cast<T>(roi_bin_grid_h * roi_bin_grid_w);  // e.g. = 4
 
-    // we want to precalculate indeces and weights shared by all chanels,
-    // this is the key point of optimiation
-    std::vector<PreCalc<T>> pre_calc(
-        roi_bin_grid_h * roi_bin_grid_w * pooled_width * pooled_height);
-    pre_calc_for_bilinear_interpolate(
-        height,
-        width,
-        pooled_height,
-        pooled_width,
-        roi_bin_grid_h,
-        roi_bin_grid_w,
-        roi_start_h,
-        roi_start_w,
-        bin_size_h,
-        bin_size_w,
-        roi_bin_grid_h,
-        roi_bin_grid_w,
-        pre_calc);
-
-    for (int c = 0; c < channels; c++) {
-      int index_n_c = index_n + c * pooled_width * pooled_height;
-      const T* offset_bottom_data =
-          bottom_data + (roi_batch_ind * channels + c) * height * width;
-      int pre_calc_index = 0;
-
-      for (int ph = 0; ph < pooled_height; ph++) {
-        for (int pw = 0; pw < pooled_width; pw++) {
-          int index = index_n_c + ph * pooled_width + pw;
-
-          T output_val = 0.;
-          for (int iy = 0; iy < roi_bin_grid_h; iy++) {
-            for (int ix = 0; ix < roi_bin_grid_w; ix++) {
-              PreCalc<T> pc = pre_calc[pre_calc_index];
-              output_val += pc.w1 * offset_bottom_data[pc.pos1] +
-                  pc.w2 * offset_bottom_data[pc.pos2] +
-                  pc.w3 * offset_bottom_data[pc.pos3] +
-                  pc.w4 * offset_bottom_data[pc.pos4];
-
-              pre_calc_index += 1;
-            }
+    // Output is written directly to the position of the ROI in the original order
+    int index_n_c = rois_mapping[n] * feaxels_per_roi + c * pooled_width * pooled_height;
+    const T* offset_bottom_data = bottom_data + c * height * width;
+    int pre_calc_index = 0;
+
+    for (int ph = 0; ph < pooled_height; ph++) {
+      for (int pw = 0; pw < pooled_width; pw++) {
+        int index = index_n_c + ph * pooled_width + pw;
+
+        T output_val = 0.;
+        for (int iy = 0; iy < roi_bin_grid_h; iy++) {
+          for (int ix = 0; ix < roi_bin_grid_w; ix++) {
+            const PreCalc<T>& pc = sampling.pre_calc[pre_calc_index];
+            output_val += pc.w1 * offset_bottom_data[pc.pos1] +
+                pc.w2 * offset_bottom_data[pc.pos2] +
+                pc.w3 * offset_bottom_data[pc.pos3] +
+                pc.w4 * offset_bottom_data[pc.pos4];
+
+            pre_calc_index += 1;
           }
-          output_val /= count;
+        }
+        output_val /= count;
 
-          top_data[index] = output_val;
-        }  // for pw
-      }  // for ph
-    }  // for c
+        top_data[index] = output_val;
+      }  // for pw
+    }  // for ph
+  });
+}
+
+// The same as ROIAlignForward_cpu_kernel, but feature map and output are in nChw8c/nChw16c layouts,
+// so every sampling point is applied to a whole block of channels at once
+void ROIAlignForward_blocked_kernel(
+    jit_uni_roi_align_kernel* kernel,
+    const int block_size,
+    const int n_rois,
+    const float* bottom_data,
+    const float spatial_scale,
+    const int channel_blocks,
+    const int height,
+    const int width,
+    const int pooled_height,
+    const int pooled_width,
+    const int sampling_ratio,
+    const float* bottom_rois,
+    const int* rois_mapping,
+    float* top_data) {
+  const int roi_cols = 4;
+  const int bins = pooled_height * pooled_width;
+  const size_t feaxels_per_roi = static_cast<size_t>(channel_blocks) * bins * block_size;
+
+  struct BlockedSampling {
+    size_t samples;
+    float scale;
+    std::vector<int> offsets;
+    std::vector<float> weights;
+  };
+
+  std::vector<BlockedSampling> samplings(n_rois);
+  parallel_for(n_rois, [&](size_t n) {
+    ROISampling<float> sampling;
+    ROIAlignPrepareSampling(spatial_scale, height, width, pooled_height, pooled_width, sampling_ratio,
+                            bottom_rois + n * roi_cols, sampling);
+
+    auto& blocked = samplings[n];
+    blocked.samples = static_cast<size_t>(sampling.roi_bin_grid_h) * sampling.roi_bin_grid_w;
+    blocked.scale = 1.f / static_cast<float>(blocked.samples);
+    blocked.offsets.resize(4 * sampling.pre_calc.size());
+    blocked.weights.resize(4 * sampling.pre_calc.size());
+
+    const int pixel_size = block_size * sizeof(float);
+    for (size_t i = 0; i < sampling.pre_calc.size(); i++) {
+      const PreCalc<float>& pc = sampling.pre_calc[i];
+      blocked.offsets[4 * i + 0] = pc.pos1 * pixel_size;
+      blocked.offsets[4 * i + 1] = pc.pos2 * pixel_size;
+      blocked.offsets[4 * i + 2] = pc.pos3 * pixel_size;
+      blocked.offsets[4 * i + 3] = pc.pos4 * pixel_size;
+      blocked.weights[4 * i + 0] = pc.w1;
+      blocked.weights[4 * i + 1] = pc.w2;
+      blocked.weights[4 * i + 2] = pc.w3;
+      blocked.weights[4 * i + 3] = pc.w4;
+    }
+  });
+
+  parallel_for2d(n_rois, channel_blocks, [&](int n, int cb) {
+    const auto& blocked = samplings[n];
+    const float* src = bottom_data + static_cast<size_t>(cb) * height * width * block_size;
+    float* dst = top_data + rois_mapping[n] * feaxels_per_roi + static_cast<size_t>(cb) * bins * block_size;
+
+    if (kernel) {
+      auto arg = jit_args_roi_align();
+      arg.src = src;
+      arg.offsets = blocked.offsets.data();
+      arg.weights = blocked.weights.data();
+      arg.dst = dst;
+      arg.bins = static_cast<size_t>(bins);
+      arg.samples = blocked.samples;
+      arg.scale = blocked.scale;
+      (*kernel)(&arg);
+      return;
+    }
+
+    const int* offsets = blocked.offsets.data();
+    const float* weights = blocked.weights.data();
+    for (int bin = 0; bin < bins; bin++) {
+      float* bin_dst = dst + bin * block_size;
+      for (int ci = 0; ci < block_size; ci++)
+        bin_dst[ci] = 0.f;
+
+      for (size_t s = 0; s < blocked.samples; s++) {
+        for (int k = 0; k < 4; k++) {
+          const float* pixel = src + offsets[k] / sizeof(float);
+          for (int ci = 0; ci < block_size; ci++)
+            bin_dst[ci] += weights[k] * pixel[ci];
+        }
+        offsets += 4;
+        weights += 4;
+      }
+
+      for (int ci = 0; ci < block_size; ci++)
+        bin_dst[ci] *= blocked.scale;
+    }
   });
 }
 
@@ -325,9 +552,27 @@ public:
             pooled_height_ = output_dim_;
             pooled_width_ = output_dim_;
 
-            std::vector<DataConfigurator> inputs_layouts(layer->insData.size(), DataConfigurator(ConfLayout::PLN));
+            // Blocked layouts let the kernel process a whole channel block per sampling point
+            ConfLayout blk_layout = ConfLayout::BLK8;
+            if (mayiuse(avx512_common)) {
+                blk_layout = ConfLayout::BLK16;
+                block_size_ = 16;
+                roi_align_kernel_.reset(new jit_uni_roi_align_kernel_f32<avx512_common>(block_size_));
+            } else if (mayiuse(avx2)) {
+                roi_align_kernel_.reset(new jit_uni_roi_align_kernel_f32<avx2>(block_size_));
+            } else if (mayiuse(sse42)) {
+                roi_align_kernel_.reset(new jit_uni_roi_align_kernel_f32<sse42>(block_size_));
+            }
+
+            std::vector<DataConfigurator> inputs_layouts(layer->insData.size(), DataConfigurator(blk_layout));
+            inputs_layouts[INPUT_ROIS] = DataConfigurator(ConfLayout::PLN);
             std::vector<DataConfigurator> outputs_layouts(layer->outData.size(), DataConfigurator(ConfLayout::PLN));
+            outputs_layouts[OUTPUT_ROI_FEATURES] = DataConfigurator(blk_layout);
             addConfig(layer, inputs_layouts, outputs_layouts);
+
+            std::vector<DataConfigurator> inputs_plain_layouts(layer->insData.size(), DataConfigurator(ConfLayout::PLN));
+            std::vector<DataConfigurator> outputs_plain_layouts(layer->outData.size(), DataConfigurator(ConfLayout::PLN));
+            addConfig(layer, inputs_plain_layouts, outputs_plain_layouts);
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -338,7 +583,8 @@ public:
         const int levels_num = inputs.size() - INPUT_FEATURES_START;
         const int num_rois = inputs[INPUT_ROIS]->getTensorDesc().getDims()[0];
         const int channels_num = inputs[INPUT_FEATURES_START]->getTensorDesc().getDims()[1];
-        const int feaxels_per_roi = pooled_height_ * pooled_width_ * channels_num;
+        const bool is_blocked = outputs[OUTPUT_ROI_FEATURES]->getTensorDesc().getLayout() == Layout::BLOCKED;
+        const int channel_blocks = (channels_num + block_size_ - 1) / block_size_;
 
         auto *input_rois = inputs[INPUT_ROIS]->buffer().as<const float *>();
         auto *output_rois_features = outputs[OUTPUT_ROI_FEATURES]->buffer().as<float *>();
@@ -357,7 +603,14 @@ public:
         std::vector<int> rois_per_level;
         split_points(level_ids, rois_per_level, levels_num + 1);
 
-        std::vector<float> output_rois_features_temp(feaxels_per_roi * num_rois, 0);
+        // ROIs with no area are assigned to no level, so their features are zeros
+        const int feaxels_per_roi = (is_blocked ? channel_blocks * block_size_ : channels_num) * pooled_height_ * pooled_width_;
+        for (int i = rois_per_level[levels_num]; i < num_rois; ++i) {
+            std::fill_n(output_rois_features + static_cast<size_t>(original_rois_mapping[i]) * feaxels_per_roi,
+                        feaxels_per_roi, 0.f);
+        }
+
+        // Features of every ROI are written to its original position, so no reordering of the output is needed
         for (int i = 0; i < levels_num; ++i) {
             const int level_rois_offset = rois_per_level[i];
             const int level_rois_num = rois_per_level[i + 1] - level_rois_offset;
@@ -365,23 +618,38 @@ public:
                 auto *featuremap = inputs[INPUT_FEATURES_START + i]->buffer().as<const float *>();
                 const int featuremap_height = inputs[INPUT_FEATURES_START + i]->getTensorDesc().getDims()[2];
                 const int featuremap_width = inputs[INPUT_FEATURES_START + i]->getTensorDesc().getDims()[3];
-                ROIAlignForward_cpu_kernel<float>(feaxels_per_roi * level_rois_num,
-                    featuremap,
-                    1.0f / pyramid_scales_[i],
-                    channels_num,
-                    featuremap_height,
-                    featuremap_width,
-                    pooled_height_,
-                    pooled_width_,
-                    sampling_ratio_,
-                    &reordered_rois[4 * level_rois_offset],
-                    &output_rois_features_temp[feaxels_per_roi * level_rois_offset]);
+                if (is_blocked) {
+                    ROIAlignForward_blocked_kernel(roi_align_kernel_.get(),
+                        block_size_,
+                        level_rois_num,
+                        featuremap,
+                        1.0f / pyramid_scales_[i],
+                        channel_blocks,
+                        featuremap_height,
+                        featuremap_width,
+                        pooled_height_,
+                        pooled_width_,
+                        sampling_ratio_,
+                        &reordered_rois[4 * level_rois_offset],
+                        &original_rois_mapping[level_rois_offset],
+                        output_rois_features);
+                } else {
+                    ROIAlignForward_cpu_kernel<float>(level_rois_num,
+                        featuremap,
+                        1.0f / pyramid_scales_[i],
+                        channels_num,
+                        featuremap_height,
+                        featuremap_width,
+                        pooled_height_,
+                        pooled_width_,
+                        sampling_ratio_,
+                        &reordered_rois[4 * level_rois_offset],
+                        &original_rois_mapping[level_rois_offset],
+                        output_rois_features);
+                }
             }
         }
 
-        std::vector<int> dummy_mapping(num_rois, 0);
-        reorder(&output_rois_features_temp[0], &original_rois_mapping[0], num_rois, feaxels_per_roi,
-                output_rois_features, &dummy_mapping[0]);
         if (output_rois != nullptr) {
             std::memcpy(output_rois, input_rois, 4 * num_rois * sizeof(float));
         }
@@ -396,6 +664,9 @@ private:
     std::vector<int> pyramid_scales_;
     int sampling_ratio_ = 0;
 
+    int block_size_ = 8;
+    std::shared_ptr<jit_uni_roi_align_kernel> roi_align_kernel_;
+
     int channels = 0;
     int height = 0;
     int width = 0;
@@ -6,6 +6,8 @@
 
 #include <chrono>
 
+#include "mkldnn_latency_histogram.h"
+
 namespace MKLDNNPlugin {
 
 class PerfCount {
@@ -32,16 +34,28 @@ private:
         num++;
     }
 
+    uint64_t last_itr_ns() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count();
+    }
+
     friend class PerfHelper;
 };
 
 class PerfHelper {
     PerfCount &counter;
+    MKLDNNLatencyHistogram *histogram;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    // The duration is also recorded into the histogram if it is set
+    explicit PerfHelper(PerfCount &count, MKLDNNLatencyHistogram *hist = nullptr): counter(count), histogram(hist) {
+        counter.start_itr();
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() {
+        counter.finish_itr();
+        if (histogram)
+            histogram->record(counter.last_itr_ns());
+    }
 };
 
 }  // namespace MKLDNNPlugin
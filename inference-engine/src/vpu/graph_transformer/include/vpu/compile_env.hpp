@@ -4,6 +4,11 @@
 
 #pragma once
 
+#include <exception>
+#include <mutex>
+
+#include <ie_parallel.hpp>
+
 #include <vpu/graph_transformer.hpp>
 #include <vpu/model/model.hpp>
 #include <vpu/utils/logger.hpp>
@@ -43,8 +48,46 @@ public:
     static void updateConfig(const CompilationConfig& config);
     static void free();
 
+    //
+    // Runs func(i) for each i in [0, count) in parallel.
+    // Worker threads see the same CompileEnv as the calling thread,
+    // func must not modify the Model.
+    //
+    template <typename Func>
+    static void parallelFor(int count, const Func& func);
+
 private:
     inline CompileEnv() = default;
+
+    // Sets the environment for the current thread, returns the previous one
+    static const CompileEnv* setForCurrentThread(const CompileEnv* env);
 };
 
+template <typename Func>
+void CompileEnv::parallelFor(int count, const Func& func) {
+    const auto& env = get();
+
+    std::mutex exceptionMutex;
+    std::exception_ptr exception = nullptr;
+
+    InferenceEngine::parallel_for(count, [&](int i) {
+        const auto prevEnv = setForCurrentThread(&env);
+
+        try {
+            func(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (exception == nullptr) {
+                exception = std::current_exception();
+            }
+        }
+
+        setForCurrentThread(prevEnv);
+    });
+
+    if (exception != nullptr) {
+        std::rethrow_exception(exception);
+    }
+}
+
 }  // namespace vpu
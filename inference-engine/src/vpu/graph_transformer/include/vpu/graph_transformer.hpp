@@ -36,6 +36,11 @@ VPU_DECLARE_ENUM(Platform,
     MYRIAD_X = 2480
 )
 
+VPU_DECLARE_ENUM(CmxAllocationStrategy,
+    Greedy,
+    Lifetime
+)
+
 struct CompilationConfig final {
     //
     // Compilation options
@@ -57,8 +62,10 @@ struct CompilationConfig final {
     Optional<bool> copyOptimization;
     Optional<bool> injectSwOps;
     Optional<bool> packDataInCmx;
+    CmxAllocationStrategy cmxAllocationStrategy = CmxAllocationStrategy::Greedy;
     bool mergeHwPoolToConv = true;
     bool hwDilation = false;
+    bool hwGlobalTiling = false;
     bool forceDeprecatedCnnConversion = false;
 
     std::map<std::string, std::vector<int>> ioStrides;
@@ -124,6 +131,20 @@ struct DataInfo final {
     int totalSize = 0;
 };
 
+//
+// PassesTimings
+//
+
+// Pairs of pass name and its duration in milliseconds, in execution order
+using PassesTimings = std::vector<std::pair<std::string, double>>;
+
+//
+// CompileStatistics
+//
+
+// Named estimates collected by the passes, e.g. "hwTilingPlan.plannedCost"
+using CompileStatistics = std::map<std::string, double>;
+
 //
 // CompiledGraph
 //
@@ -149,6 +170,9 @@ struct CompiledGraph final {
 
     std::uint32_t numShaves = 0;
     std::uint32_t numSlices = 0;
+
+    PassesTimings passesTimings;
+    CompileStatistics statistics;
 };
 
 //
@@ -93,8 +93,17 @@ public:
     DataSet& getCandidatesForCMX() { return _candidatesForCMX; }
     bool removeCMXCandidates(const Data& data);
 
+    /**
+     * Selects the candidates which fit into CMX together with the data already required to be there,
+     * taking into account the lifetimes of the data in the stages order (see allocator::packLifetimeBuffers).
+     * Candidates are prioritized by their access count multiplied by size.
+     */
+    DataVector packCMXCandidates(const Model& model, const DataVector& candidates) const;
+
     AllocatorForShaves& getAllocatorOfShaves() { return _allocatorOfShaves; }
 
+    int maxCmxSize() const { return _maxCmxSize; }
+
 private:
     allocator::MemChunk* allocateMem(MemoryType memType, int size, int inUse);
     void freeMem(allocator::MemChunk* chunk);
@@ -57,6 +57,24 @@ struct MemoryPool final {
     }
 };
 
+// Buffer alive from the stage #start till the stage #end inclusively
+struct LifetimeBuffer final {
+    int start = 0;
+    int end = 0;
+    int size = 0;
+    double priority = 0.0;
+
+    // Assigned offset or -1 if the buffer doesn't fit
+    int offset = -1;
+};
+
+/**
+ * Offline packing of the buffers with known lifetimes into the memory of memorySize bytes.
+ * Buffers are placed in the order of decreasing priority to the lowest offset,
+ * where they don't overlap with already placed buffers alive at the same time.
+ */
+void packLifetimeBuffers(std::vector<LifetimeBuffer>& buffers, int memorySize);
+
 }  // namespace allocator
 
 
@@ -188,11 +188,17 @@ public:
         return _hwTilings;
     }
 
+    // tiling options the hw tilings were built from (in the same order)
+    const std::vector<TilingOption>& getTilingOptions() const {
+        return _tilingOptions;
+    }
+
 private:
     bool tileForHW();
 
     const ConvolutionOptions _convolutionOptions;
     std::vector<HwConvTilingPtr> _hwTilings;
+    std::vector<TilingOption> _tilingOptions;
     bool _tilingPossible;
     const HWConvolutionTilingSearcher _searcher;
 };
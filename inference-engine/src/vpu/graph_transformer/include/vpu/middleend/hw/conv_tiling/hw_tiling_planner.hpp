@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+
+namespace vpu {
+
+namespace HWTilingNS {
+
+// One HW convolution of a chain, where each stage consumes the output of the previous one
+struct TilingPlanStage final {
+    // candidate tilings ordered by the local cost, the first one is the locally best
+    std::vector<TilingOption> options;
+    // number of elements in the stage output (the input of the next stage in the chain)
+    int outputElements = 0;
+};
+
+struct TilingPlan final {
+    // selected option index for every stage of the chain
+    std::vector<std::size_t> choices;
+    // sum of the local costs and the costs of the DDR round trips between the stages
+    double cost = 0.0;
+    int numDdrTransfers = 0;
+};
+
+// The data between two adjacent stages can stay in CMX only if none of them splits it into tiles
+// and it fits into the CMX budget, otherwise it is written to DDR and read back by the consumer.
+bool needDdrTransfer(const TilingOption& producer, const TilingOption& consumer, int dataElements, int cmxBudget);
+
+TilingPlan evaluateTilingPlan(const std::vector<TilingPlanStage>& chain,
+                              const std::vector<std::size_t>& choices,
+                              int cmxBudget);
+
+// Takes the locally best tiling for every stage
+TilingPlan planTilingLocally(const std::vector<TilingPlanStage>& chain, int cmxBudget);
+
+// Selects tilings for the whole chain at once minimizing the total cost
+TilingPlan planTilingJointly(const std::vector<TilingPlanStage>& chain, int cmxBudget);
+
+}  // namespace HWTilingNS
+
+}  // namespace vpu
@@ -54,6 +54,11 @@ class PassSet final {
 public:
     using Ptr = std::shared_ptr<PassSet>;
 
+    //
+    // Stores the durations (in milliseconds) of all executed passes
+    // to the "passesTimings" Model attribute.
+    //
+
     void run(const Model& model) const;
 
     inline void addPass(
@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <vpu/vpu_plugin_config.hpp>
 
@@ -26,7 +29,18 @@ DECLARE_VPU_CONFIG_KEY(COPY_OPTIMIZATION);
 DECLARE_VPU_CONFIG_KEY(HW_INJECT_STAGES);
 DECLARE_VPU_CONFIG_KEY(HW_POOL_CONV_MERGE);
 DECLARE_VPU_CONFIG_KEY(PACK_DATA_IN_CMX);
+
+/**
+ * @brief The key to choose how HW inputs are selected to be placed in CMX:
+ * GREEDY tries candidates one by one in the stages order,
+ * LIFETIME packs candidates offline by their lifetimes, prioritizing them by access count x size.
+ */
+DECLARE_VPU_CONFIG_KEY(CMX_ALLOCATION_STRATEGY);
+DECLARE_VPU_CONFIG_VALUE(GREEDY);
+DECLARE_VPU_CONFIG_VALUE(LIFETIME);
+
 DECLARE_VPU_CONFIG_KEY(HW_DILATION);
+DECLARE_VPU_CONFIG_KEY(HW_GLOBAL_TILING);
 DECLARE_VPU_CONFIG_KEY(FORCE_DEPRECATED_CNN_CONVERSION);
 
 DECLARE_VPU_CONFIG_KEY(PERF_REPORT_MODE);
@@ -84,4 +98,20 @@ DECLARE_VPU_MYRIAD_CONFIG_KEY(PLUGIN_LOG_FILE_PATH);
 DECLARE_VPU_MYRIAD_CONFIG_KEY(DEVICE_CONNECT_TIMEOUT);
 
 }  // namespace VPUConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get durations (in milliseconds) of graph compiler passes in execution order.
+ * Available for networks compiled by LoadNetwork, empty for imported ones.
+ */
+DECLARE_VPU_METRIC(COMPILE_PASSES_TIMINGS, std::vector<std::pair<std::string, double>>);
+
+/**
+ * @brief Metric to get graph compiler estimates (HW tiling plan costs, memory usage) by their names.
+ * Available for networks compiled by LoadNetwork, empty for imported ones.
+ */
+DECLARE_VPU_METRIC(COMPILE_STATISTICS, std::map<std::string, double>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
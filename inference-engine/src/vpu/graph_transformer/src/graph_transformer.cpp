@@ -150,6 +150,12 @@ void CompileEnv::free() {
     g_compileEnv = nullptr;
 }
 
+const CompileEnv* CompileEnv::setForCurrentThread(const CompileEnv* env) {
+    const auto prevEnv = g_compileEnv;
+    g_compileEnv = const_cast<CompileEnv*>(env);
+    return prevEnv;
+}
+
 //
 // compileNetwork
 //
@@ -183,7 +189,11 @@ CompiledGraph::Ptr compileImpl(ie::ICNNNetwork& network) {
                           nullptr);
     }
 
-    return backEnd->build(model, frontEnd->origLayers());
+    auto compiledGraph = backEnd->build(model, frontEnd->origLayers());
+    compiledGraph->passesTimings = model->attrs().getOrDefault<PassesTimings>("passesTimings");
+    compiledGraph->statistics = model->attrs().getOrDefault<CompileStatistics>("compileStatistics");
+
+    return compiledGraph;
 }
 
 CompiledGraph::Ptr compileImpl(const Model& model) {
@@ -199,7 +209,11 @@ CompiledGraph::Ptr compileImpl(const Model& model) {
 
     middleEnd->run(model);
 
-    return backEnd->build(model, {});
+    auto compiledGraph = backEnd->build(model, {});
+    compiledGraph->passesTimings = model->attrs().getOrDefault<PassesTimings>("passesTimings");
+    compiledGraph->statistics = model->attrs().getOrDefault<CompileStatistics>("compileStatistics");
+
+    return compiledGraph;
 }
 
 }  // namespace
@@ -41,6 +41,57 @@ void printTo(DotLabel& lbl, const UsedMemory& usedMemory) {
     subLbl.appendPair("output", usedMemory.output);
 }
 
+//
+// Allocator Structs
+//
+
+namespace allocator {
+
+void packLifetimeBuffers(std::vector<LifetimeBuffer>& buffers, int memorySize) {
+    std::vector<LifetimeBuffer*> order;
+    order.reserve(buffers.size());
+    for (auto& buffer : buffers) {
+        buffer.offset = -1;
+        order.push_back(&buffer);
+    }
+
+    std::stable_sort(order.begin(), order.end(), [](const LifetimeBuffer* lhs, const LifetimeBuffer* rhs) {
+        return lhs->priority > rhs->priority;
+    });
+
+    std::vector<const LifetimeBuffer*> placed;
+    std::vector<const LifetimeBuffer*> overlapped;
+
+    for (auto buffer : order) {
+        overlapped.clear();
+        for (auto other : placed) {
+            if (other->start <= buffer->end && buffer->start <= other->end) {
+                overlapped.push_back(other);
+            }
+        }
+
+        std::sort(overlapped.begin(), overlapped.end(), [](const LifetimeBuffer* lhs, const LifetimeBuffer* rhs) {
+            return lhs->offset < rhs->offset;
+        });
+
+        int offset = 0;
+        for (auto other : overlapped) {
+            if (offset + buffer->size <= other->offset) {
+                break;
+            }
+
+            offset = std::max(offset, other->offset + other->size);
+        }
+
+        if (offset + buffer->size <= memorySize) {
+            buffer->offset = offset;
+            placed.push_back(buffer);
+        }
+    }
+}
+
+}  // namespace allocator
+
 //
 // Allocator
 //
@@ -594,6 +645,76 @@ AllocationResult Allocator::preprocess(const Model& model) {
     return AllocationResult();
 }
 
+namespace {
+
+allocator::LifetimeBuffer makeLifetimeBuffer(const Data& data) {
+    IE_ASSERT(data->producer() != nullptr);
+
+    allocator::LifetimeBuffer buffer;
+    buffer.size = calcAllocationSize(data);
+    buffer.start = data->producer()->index();
+    buffer.end = buffer.start;
+
+    // Producer writes the data once, each consumer reads it
+    int numAccesses = 1;
+    loopOverData(data, [&buffer, &numAccesses](const Data& subData) {
+        for (const auto& consumer : subData->consumers()) {
+            buffer.end = std::max(buffer.end, consumer->index());
+            ++numAccesses;
+        }
+        return DataLoopStatus::NextChild;
+    });
+
+    buffer.priority = static_cast<double>(numAccesses) * buffer.size;
+
+    return buffer;
+}
+
+}  // namespace
+
+DataVector Allocator::packCMXCandidates(const Model& model, const DataVector& candidates) const {
+    DataVector datas;
+    std::vector<allocator::LifetimeBuffer> buffers;
+
+    //
+    // Data already required to be in CMX is placed first
+    //
+
+    for (const auto& data : model->datas()) {
+        if (data->usage() != DataUsage::Intermediate ||
+            data->parentDataEdge() != nullptr ||
+            data->memReqs() != MemoryType::CMX) {
+            continue;
+        }
+
+        auto buffer = makeLifetimeBuffer(data);
+        buffer.priority = std::numeric_limits<double>::max();
+
+        datas.push_back(data);
+        buffers.push_back(buffer);
+    }
+
+    const auto numRequired = datas.size();
+
+    for (const auto& data : candidates) {
+        IE_ASSERT(data->parentDataEdge() == nullptr);
+
+        datas.push_back(data);
+        buffers.push_back(makeLifetimeBuffer(data));
+    }
+
+    allocator::packLifetimeBuffers(buffers, _maxCmxSize);
+
+    DataVector packed;
+    for (auto ind = numRequired; ind < buffers.size(); ++ind) {
+        if (buffers[ind].offset >= 0) {
+            packed.push_back(datas[ind]);
+        }
+    }
+
+    return packed;
+}
+
 bool Allocator::removeCMXCandidates(const vpu::Data& data) {
     auto it = _candidatesForCMX.find(data);
 
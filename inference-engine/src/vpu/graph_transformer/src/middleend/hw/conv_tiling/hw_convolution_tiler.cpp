@@ -236,6 +236,7 @@ bool HWConvolutionTiler::tileForHW() {
         const auto& tileLayoutCut = _searcher.tileLayoutCut(tilingOption);
         if (tileLayoutCut.tileCutPossible()) {
             _hwTilings.push_back(tileLayoutCut.hwTiling());
+            _tilingOptions.push_back(tilingOption);
         }
     }
 
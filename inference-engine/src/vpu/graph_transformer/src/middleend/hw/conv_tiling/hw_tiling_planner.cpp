@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/middleend/hw/conv_tiling/hw_tiling_planner.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace vpu {
+
+namespace HWTilingNS {
+
+namespace {
+
+// DDR round trip: the producer writes the data and the consumer reads it back
+double ddrTransferCost(int dataElements) {
+    return 2.0 * dataElements;
+}
+
+}  // namespace
+
+bool needDdrTransfer(const TilingOption& producer, const TilingOption& consumer, int dataElements, int cmxBudget) {
+    return producer.totalNumTiles > 1 || consumer.totalNumTiles > 1 || dataElements > cmxBudget;
+}
+
+TilingPlan evaluateTilingPlan(const std::vector<TilingPlanStage>& chain,
+                              const std::vector<std::size_t>& choices,
+                              int cmxBudget) {
+    IE_ASSERT(chain.size() == choices.size());
+
+    TilingPlan plan;
+    plan.choices = choices;
+
+    for (std::size_t ind = 0; ind < chain.size(); ++ind) {
+        const auto& option = chain[ind].options.at(choices[ind]);
+        plan.cost += option.cost;
+
+        if (ind == 0) {
+            continue;
+        }
+
+        const auto& prevStage = chain[ind - 1];
+        if (needDdrTransfer(prevStage.options.at(choices[ind - 1]), option, prevStage.outputElements, cmxBudget)) {
+            plan.cost += ddrTransferCost(prevStage.outputElements);
+            ++plan.numDdrTransfers;
+        }
+    }
+
+    return plan;
+}
+
+TilingPlan planTilingLocally(const std::vector<TilingPlanStage>& chain, int cmxBudget) {
+    return evaluateTilingPlan(chain, std::vector<std::size_t>(chain.size(), 0), cmxBudget);
+}
+
+TilingPlan planTilingJointly(const std::vector<TilingPlanStage>& chain, int cmxBudget) {
+    if (chain.empty()) {
+        return {};
+    }
+
+    //
+    // Viterbi-like search over the chain: bestCost[i][k] is the minimal cost of stages [0, i]
+    // with option k selected for the stage i, bestPrev[i][k] is the option of the stage i - 1 it was reached from.
+    //
+
+    std::vector<std::vector<double>> bestCost(chain.size());
+    std::vector<std::vector<std::size_t>> bestPrev(chain.size());
+
+    for (std::size_t ind = 0; ind < chain.size(); ++ind) {
+        const auto& options = chain[ind].options;
+        IE_ASSERT(!options.empty());
+
+        bestCost[ind].assign(options.size(), std::numeric_limits<double>::max());
+        bestPrev[ind].assign(options.size(), 0);
+
+        for (std::size_t cur = 0; cur < options.size(); ++cur) {
+            if (ind == 0) {
+                bestCost[ind][cur] = options[cur].cost;
+                continue;
+            }
+
+            const auto& prevStage = chain[ind - 1];
+            for (std::size_t prev = 0; prev < prevStage.options.size(); ++prev) {
+                auto cost = bestCost[ind - 1][prev] + options[cur].cost;
+                if (needDdrTransfer(prevStage.options[prev], options[cur], prevStage.outputElements, cmxBudget)) {
+                    cost += ddrTransferCost(prevStage.outputElements);
+                }
+
+                if (cost < bestCost[ind][cur]) {
+                    bestCost[ind][cur] = cost;
+                    bestPrev[ind][cur] = prev;
+                }
+            }
+        }
+    }
+
+    std::vector<std::size_t> choices(chain.size(), 0);
+
+    const auto& lastCost = bestCost.back();
+    for (std::size_t cur = 1; cur < lastCost.size(); ++cur) {
+        if (lastCost[cur] < lastCost[choices.back()]) {
+            choices.back() = cur;
+        }
+    }
+
+    for (auto ind = chain.size() - 1; ind > 0; --ind) {
+        choices[ind - 1] = bestPrev[ind][choices[ind]];
+    }
+
+    return evaluateTilingPlan(chain, choices, cmxBudget);
+}
+
+}  // namespace HWTilingNS
+
+}  // namespace vpu
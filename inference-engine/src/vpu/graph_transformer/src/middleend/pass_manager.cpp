@@ -39,6 +39,9 @@ void PassSet::run(const Model& model) const {
     env.log->debug("MiddleEnd : Run passes");
     VPU_LOGGER_SECTION(env.log);
 
+    PassesTimings timings;
+    timings.reserve(_passes.size());
+
     int passInd = 0;
     for (const auto& p : _passes) {
         env.log->debug("Start pass %m%d / %d [%s]", std::setw(2), passInd + 1, _passes.size(), p.second);
@@ -52,15 +55,20 @@ void PassSet::run(const Model& model) const {
 
         auto endTime = std::chrono::high_resolution_clock::now();
 
+        const auto duration = std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count();
+
         env.log->debug(
             "Pass %m%d / %d [%s] duration : %f ms",
-            std::setw(2), passInd + 1, _passes.size(), p.second,
-            std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count());
+            std::setw(2), passInd + 1, _passes.size(), p.second, duration);
+
+        timings.emplace_back(p.second, duration);
 
         ++passInd;
     }
 
     model->cleanUp();
+
+    model->attrs().set<PassesTimings>("passesTimings", std::move(timings));
 }
 
 //
@@ -5,7 +5,7 @@
 #include <vpu/middleend/pass_manager.hpp>
 
 #include <algorithm>
-#include <queue>
+#include <vector>
 #include <set>
 #include <memory>
 #include <string>
@@ -390,7 +390,7 @@ void PassImpl::packDataInCmx(const Model& model) {
     // Collect candidates
     //
 
-    std::queue<Data> candidatesForCMX;
+    DataVector candidatesForCMX;
 
     auto& visitedDatas = allocator.getCandidatesForCMX();
     visitedDatas.clear();
@@ -419,21 +419,69 @@ void PassImpl::packDataInCmx(const Model& model) {
 
             if (producer->getSHAVEsRequirements() != StageSHAVEsRequirements::NeedMax) {
                 if (visitedDatas.count(topParent) == 0) {
-                    candidatesForCMX.push(topParent);
+                    candidatesForCMX.push_back(topParent);
                     visitedDatas.insert(topParent);
                 }
             }
         }
     }
 
+    const auto setMemReqs = [](const Data& data, MemoryType memType) {
+        loopOverData(data, [memType](const Data& subData) {
+            subData->setMemReqs(memType);
+            return DataLoopStatus::NextChild;
+        });
+    };
+
+    const auto reportStatistics = [&model, &candidatesForCMX]() {
+        int numInCmx = 0;
+        int spilledBytes = 0;
+        for (const auto& candidate : candidatesForCMX) {
+            if (candidate->memReqs() == MemoryType::CMX) {
+                ++numInCmx;
+            } else {
+                spilledBytes += calcAllocationSize(candidate);
+            }
+        }
+
+        auto& statistics = model->attrs().getOrSet<CompileStatistics>("compileStatistics");
+        statistics["cmxPacking.candidates"] = candidatesForCMX.size();
+        statistics["cmxPacking.placedInCmx"] = numInCmx;
+        statistics["cmxPacking.spilledToDdrBytes"] = spilledBytes;
+    };
+
     //
-    // Try candidates one by one -> if allocation cycle is successfull, leave the data in CMX
+    // Pack candidates offline and check the result with single allocation cycle,
+    // fall back to the greedy search if it fails
     //
 
-    while (!candidatesForCMX.empty()) {
-        auto curCandidate = candidatesForCMX.front();
-        candidatesForCMX.pop();
+    if (env.config.cmxAllocationStrategy == CmxAllocationStrategy::Lifetime) {
+        const auto packed = allocator.packCMXCandidates(model, candidatesForCMX);
+
+        env.log->trace("Offline packing selected %d of %d candidates", packed.size(), candidatesForCMX.size());
+
+        for (const auto& data : packed) {
+            setMemReqs(data, MemoryType::CMX);
+        }
+
+        auto allocRes = runAllocator(model, true);
+        env.log->trace("Allocation result : %v", allocRes.status);
+
+        if (allocRes.status == AllocationStatus::OK) {
+            reportStatistics();
+            return;
+        }
 
+        for (const auto& data : packed) {
+            setMemReqs(data, MemoryType::DDR);
+        }
+    }
+
+    //
+    // Try candidates one by one -> if allocation cycle is successfull, leave the data in CMX
+    //
+
+    for (const auto& curCandidate : candidatesForCMX) {
         env.log->trace("Try use CMX for Data [%s]", curCandidate->name());
         VPU_LOGGER_SECTION(env.log);
 
@@ -443,10 +491,7 @@ void PassImpl::packDataInCmx(const Model& model) {
         auto curMemoryType = curCandidate->memReqs();
         IE_ASSERT(curMemoryType == MemoryType::DDR);
 
-        loopOverData(curCandidate, [](const Data& subData) {
-            subData->setMemReqs(MemoryType::CMX);
-            return DataLoopStatus::NextChild;
-        });
+        setMemReqs(curCandidate, MemoryType::CMX);
 
         auto allocRes = runAllocator(model, true);
         env.log->trace("Allocation result : %v", allocRes.status);
@@ -454,12 +499,11 @@ void PassImpl::packDataInCmx(const Model& model) {
         if (allocRes.status != AllocationStatus::OK) {
             env.log->trace("Revert CMX usage for Data [%s]", curCandidate->name());
 
-            loopOverData(curCandidate, [](const Data& subData) {
-                subData->setMemReqs(MemoryType::DDR);
-                return DataLoopStatus::NextChild;
-            });
+            setMemReqs(curCandidate, MemoryType::DDR);
         }
     }
+
+    reportStatistics();
 }
 
 }  // namespace
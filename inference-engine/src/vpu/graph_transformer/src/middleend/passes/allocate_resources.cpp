@@ -218,7 +218,37 @@ void PassImpl::run(const Model& model) {
     // Allocation statistics
     //
 
-    model->attrs().set<UsedMemory>("usedMemory", allocator.usedMemory());
+    const auto usedMemory = allocator.usedMemory();
+    model->attrs().set<UsedMemory>("usedMemory", usedMemory);
+
+    //
+    // HW inputs, which were left in DDR
+    //
+
+    DataSet hwInputsInDdr;
+    for (const auto& stage : model->getStages()) {
+        if (stage->category() != StageCategory::HW) {
+            continue;
+        }
+
+        for (const auto& input : stage->inputs()) {
+            const auto topParent = input->getTopParentData();
+            if (topParent->usage() == DataUsage::Intermediate && topParent->location() == DataLocation::BSS) {
+                hwInputsInDdr.insert(topParent);
+            }
+        }
+    }
+
+    int hwInputsInDdrBytes = 0;
+    for (const auto& data : hwInputsInDdr) {
+        hwInputsInDdrBytes += calcAllocationSize(data);
+    }
+
+    auto& statistics = model->attrs().getOrSet<CompileStatistics>("compileStatistics");
+    statistics["allocator.cmxUsedBytes"] = usedMemory.CMX;
+    statistics["allocator.cmxUtilization"] = 100.0 * usedMemory.CMX / allocator.maxCmxSize();
+    statistics["allocator.ddrUsedBytes"] = usedMemory.BSS;
+    statistics["allocator.hwInputsInDdrBytes"] = hwInputsInDdrBytes;
 }
 
 }  // namespace
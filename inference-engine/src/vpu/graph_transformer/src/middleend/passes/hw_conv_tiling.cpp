@@ -8,6 +8,7 @@
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -16,6 +17,7 @@
 #include <vpu/middleend/hw/utility.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_stage_tiler.hpp>
+#include <vpu/middleend/hw/conv_tiling/hw_tiling_planner.hpp>
 
 namespace vpu {
 
@@ -31,9 +33,167 @@ private:
     StageBuilder::Ptr _stageBuilder;
 };
 
+HWTilingNS::HWConvolutionTiler findTiling(
+        const Stage& origStage,
+        const HWConvStageOptions& stageOptions,
+        const HWConvStageIO& stageIO,
+        size_t tilingsCount) {
+    //
+    // Unsupported paddings
+    //
+
+    //
+    // Try to find "best" tiling
+    //
+
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
+        origStage->name(),
+        stageIO.origInput->desc().dims(),
+        stageIO.origOutput->desc().dims(),
+        stageIO.origOutputDesc.dims(),
+        stageOptions.kernelSizeX,
+        stageOptions.kernelSizeY,
+        stageOptions.kernelStride,
+        stageOptions.padLeft,
+        stageOptions.padRight,
+        stageOptions.padTop,
+        stageOptions.padBottom,
+        stageOptions.withPool
+    };
+
+    const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
+
+    if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
+        const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
+            origStage->name(),
+            stageIO.origInput->desc().dims(),
+            stageIO.origOutputDesc.dims(),
+            stageIO.origOutputDesc.dims(),
+            stageOptions.kernelSizeX,
+            stageOptions.kernelSizeY,
+            stageOptions.kernelStride,
+            stageOptions.padLeft,
+            stageOptions.padRight,
+            stageOptions.padTop,
+            stageOptions.padBottom,
+            false
+        };
+
+        return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
+    }
+
+    return tiler1stAttempt;
+}
+
+//
+// Selects tilings for the chains of adjacent HW convolutions jointly,
+// returns the index of the selected hw tiling for every tiler.
+//
+
+std::vector<size_t> planTilings(
+        const Model& model,
+        const std::vector<Stage>& hwStages,
+        const std::vector<std::unique_ptr<HWTilingNS::HWConvolutionTiler>>& tilers) {
+    const auto& env = CompileEnv::get();
+
+    std::vector<size_t> selected(hwStages.size(), 0);
+
+    // The rest of CMX is used by the HW stages themselves
+    const auto cmxBudget = (model->getAllocator().maxCmxSize() - env.resources.cmxLimit) / static_cast<int>(sizeof(fp16_t));
+
+    HandleMap<StageNode, size_t> stageInds;
+    for (size_t ind = 0; ind < hwStages.size(); ++ind) {
+        if (tilers[ind]->isTilingPossible()) {
+            stageInds[hwStages[ind]] = ind;
+        }
+    }
+
+    const auto noStage = hwStages.size();
+    std::vector<size_t> nextInds(hwStages.size(), noStage);
+    std::vector<bool> hasPrev(hwStages.size(), false);
+
+    for (const auto& p : stageInds) {
+        const auto output = p.first->output(0);
+        if (output->usage() != DataUsage::Intermediate || output->numConsumers() != 1) {
+            continue;
+        }
+
+        const auto next = stageInds.find(output->singleConsumer());
+        if (next != stageInds.end()) {
+            nextInds[p.second] = next->second;
+            hasPrev[next->second] = true;
+        }
+    }
+
+    int numChains = 0;
+    HWTilingNS::TilingPlan totalLocalPlan;
+    HWTilingNS::TilingPlan totalJointPlan;
+
+    for (size_t first = 0; first < hwStages.size(); ++first) {
+        if (hasPrev[first] || nextInds[first] == noStage || !stageInds.count(hwStages[first])) {
+            continue;
+        }
+
+        std::vector<size_t> chainInds;
+        std::vector<HWTilingNS::TilingPlanStage> chain;
+        for (auto ind = first; ind != noStage; ind = nextInds[ind]) {
+            HWTilingNS::TilingPlanStage planStage;
+            planStage.options = tilers[ind]->getTilingOptions();
+            planStage.outputElements = hwStages[ind]->output(0)->desc().totalDimSize();
+
+            chainInds.push_back(ind);
+            chain.push_back(std::move(planStage));
+        }
+
+        const auto localPlan = HWTilingNS::planTilingLocally(chain, cmxBudget);
+        const auto jointPlan = HWTilingNS::planTilingJointly(chain, cmxBudget);
+
+        env.log->trace("HW tiling plan for chain of %d stages starting at [%s] : cost %f -> %f, DDR transfers %d -> %d",
+                       chain.size(), hwStages[first]->name(),
+                       localPlan.cost, jointPlan.cost, localPlan.numDdrTransfers, jointPlan.numDdrTransfers);
+
+        for (size_t ind = 0; ind < chainInds.size(); ++ind) {
+            selected[chainInds[ind]] = jointPlan.choices[ind];
+        }
+
+        ++numChains;
+        totalLocalPlan.cost += localPlan.cost;
+        totalLocalPlan.numDdrTransfers += localPlan.numDdrTransfers;
+        totalJointPlan.cost += jointPlan.cost;
+        totalJointPlan.numDdrTransfers += jointPlan.numDdrTransfers;
+    }
+
+    env.log->info("HW tiling plan for %d chains : cost %f -> %f, DDR transfers %d -> %d",
+                  numChains, totalLocalPlan.cost, totalJointPlan.cost,
+                  totalLocalPlan.numDdrTransfers, totalJointPlan.numDdrTransfers);
+
+    auto& statistics = model->attrs().getOrSet<CompileStatistics>("compileStatistics");
+    statistics["hwTilingPlan.chains"] = numChains;
+    statistics["hwTilingPlan.localCost"] = totalLocalPlan.cost;
+    statistics["hwTilingPlan.plannedCost"] = totalJointPlan.cost;
+    statistics["hwTilingPlan.localDdrTransfers"] = totalLocalPlan.numDdrTransfers;
+    statistics["hwTilingPlan.plannedDdrTransfers"] = totalJointPlan.numDdrTransfers;
+
+    return selected;
+}
+
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    const auto& env = CompileEnv::get();
+
+    // Global planning needs few candidates per stage, otherwise only the best one is kept
+    const size_t tilingsCount = env.config.hwGlobalTiling ? 4 : 1;
+
+    //
+    // Tiling search depends only on the stage parameters,
+    // so it is done for all stages in parallel before the Model modification
+    //
+
+    std::vector<Stage> hwStages;
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -44,61 +204,30 @@ void PassImpl::run(const Model& model) {
             continue;
         }
 
+        hwStages.push_back(origStage);
+    }
+
+    std::vector<std::unique_ptr<HWTilingNS::HWConvolutionTiler>> tilers(hwStages.size());
+    CompileEnv::parallelFor(static_cast<int>(hwStages.size()), [&](int ind) {
+        const auto& origStage = hwStages[ind];
+
         const HWConvStageOptions stageOptions(origStage);
         const HWConvStageIO stageIO(origStage, origStage->output(0));
 
-        //
-        // Unsupported paddings
-        //
-
-        //
-        // Try to find "best" tiling
-        //
+        tilers[ind].reset(new HWTilingNS::HWConvolutionTiler(findTiling(origStage, stageOptions, stageIO, tilingsCount)));
+    });
 
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+    std::vector<size_t> selected(hwStages.size(), 0);
+    if (env.config.hwGlobalTiling) {
+        selected = planTilings(model, hwStages, tilers);
+    }
 
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
-            origStage->name(),
-            stageIO.origInput->desc().dims(),
-            stageIO.origOutput->desc().dims(),
-            stageIO.origOutputDesc.dims(),
-            stageOptions.kernelSizeX,
-            stageOptions.kernelSizeY,
-            stageOptions.kernelStride,
-            stageOptions.padLeft,
-            stageOptions.padRight,
-            stageOptions.padTop,
-            stageOptions.padBottom,
-            stageOptions.withPool
-        };
+    for (size_t ind = 0; ind < hwStages.size(); ++ind) {
+        const auto& origStage = hwStages[ind];
+        const auto& tiler = *tilers[ind];
 
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
-
-
-        const HWTilingNS::HWConvolutionTiler& tiler = [&] {
-            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
-
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
-            } else {
-                return tiler1stAttempt;
-            }
-        }();
+        const HWConvStageOptions stageOptions(origStage);
+        const HWConvStageIO stageIO(origStage, origStage->output(0));
 
         //
         // Use SW stage if tiling optimization failed
@@ -182,39 +311,37 @@ void PassImpl::run(const Model& model) {
 
         model->disconnectStage(origStage);
 
-        for (const auto &tiling : tiler.getHwTilings()) {
-            HWConvStageTiler hwStageTiler(
-                stageOptions,
-                stageIO,
-                model,
-                origStage,
-                _stageBuilder,
-                tiling,
-                stageOptions.withPool && !tiler.withPool());
+        HWConvStageTiler hwStageTiler(
+            stageOptions,
+            stageIO,
+            model,
+            origStage,
+            _stageBuilder,
+            tiler.getHwTilings().at(selected[ind]),
+            stageOptions.withPool && !tiler.withPool());
 
-            //
-            // Split/concat input/output tiles
-            //
+        //
+        // Split/concat input/output tiles
+        //
 
-            if (!hwStageTiler.hwInputTiles.empty()) {
-                _stageBuilder->addSplitStage(
-                    model,
-                    origStage->name() + "@split-input",
-                    origStage->origLayer(),
-                    std::move(hwStageTiler.hwInputTilesOffsets),
-                    hwStageTiler.hwInput,
-                    hwStageTiler.hwInputTiles);
-            }
+        if (!hwStageTiler.hwInputTiles.empty()) {
+            _stageBuilder->addSplitStage(
+                model,
+                origStage->name() + "@split-input",
+                origStage->origLayer(),
+                std::move(hwStageTiler.hwInputTilesOffsets),
+                hwStageTiler.hwInput,
+                hwStageTiler.hwInputTiles);
+        }
 
-            if (!hwStageTiler.hwOutputTiles.empty()) {
-                _stageBuilder->addConcatStage(
-                    model,
-                    origStage->name() + "@concat-output",
-                    origStage->origLayer(),
-                    std::move(hwStageTiler.hwOutputTilesOffsets),
-                    hwStageTiler.hwOutputTiles,
-                    hwStageTiler.hwOutput);
-            }
+        if (!hwStageTiler.hwOutputTiles.empty()) {
+            _stageBuilder->addConcatStage(
+                model,
+                origStage->name() + "@concat-output",
+                origStage->origLayer(),
+                std::move(hwStageTiler.hwOutputTilesOffsets),
+                hwStageTiler.hwOutputTiles,
+                hwStageTiler.hwOutput);
         }
 
         //
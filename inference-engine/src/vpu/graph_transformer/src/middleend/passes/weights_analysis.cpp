@@ -17,6 +17,7 @@
 #include <memory>
 #include <list>
 #include <set>
+#include <utility>
 
 #include <precision_utils.h>
 
@@ -239,29 +240,59 @@ void PassImpl::run(const Model& model) {
     int  normalVal  = 0;
     const auto& env = CompileEnv::get();
 
+    std::vector<Stage> scalableStages;
     for (const auto& stage : model->getStages()) {
         if (!isScalable(stage)) {
             continue;
         }
         IE_ASSERT(stage->origLayer() != nullptr);
 
+        scalableStages.push_back(stage);
+    }
+
+    //
+    // Weights contents are calculated lazily and may share internal buffers,
+    // so they are requested sequentially and only the exponents analysis is done in parallel
+    //
+
+    std::vector<const fp16_t*> weightsPtrs(scalableStages.size(), nullptr);
+    for (size_t ind = 0; ind < scalableStages.size(); ++ind) {
+        const auto& stage = scalableStages[ind];
+        if (stage->origLayer()->GetParamAsFloat("vpu_scale", 0)) {
+            continue;
+        }
+
+        auto content = stage->input(1)->content();
+        IE_ASSERT(content != nullptr);
+
+        weightsPtrs[ind] = content->get<fp16_t>();
+        IE_ASSERT(weightsPtrs[ind] != nullptr);
+    }
+
+    std::vector<std::pair<int, int>> maxAndMeanExps(scalableStages.size());
+    CompileEnv::parallelFor(static_cast<int>(scalableStages.size()), [&](int ind) {
+        if (weightsPtrs[ind] == nullptr) {
+            return;
+        }
+
+        auto exponents = calculateExponents(weightsPtrs[ind], scalableStages[ind]->input(1)->desc().totalDimSize());
+
+        maxAndMeanExps[ind].first = *std::max_element(exponents.begin(), exponents.end());
+        maxAndMeanExps[ind].second = getMeanValue(exponents);
+    });
+
+    for (size_t ind = 0; ind < scalableStages.size(); ++ind) {
+        const auto& stage = scalableStages[ind];
+
         // Get scale from IR, compute if it was absent
         auto scale = stage->origLayer()->GetParamAsFloat("vpu_scale", 0);
         if (!scale) {
             auto weights = stage->input(1);
 
-            auto content = weights->content();
-            IE_ASSERT(content != nullptr);
-
-            auto weightsVals = content->get<fp16_t>();
-            IE_ASSERT(weightsVals != nullptr);
-
-            auto exponents = calculateExponents(weightsVals, weights->desc().totalDimSize());
-
-            int maxExp = *std::max_element(exponents.begin(), exponents.end());
+            int maxExp = maxAndMeanExps[ind].first;
             int shift = largestExp - maxExp;
 
-            auto meanExp = getMeanValue(exponents);
+            auto meanExp = maxAndMeanExps[ind].second;
             shift = std::min(-meanExp, shift);
 
             if (stats.empty()) {
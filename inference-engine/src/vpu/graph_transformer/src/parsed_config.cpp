@@ -53,7 +53,9 @@ IE_SUPPRESS_DEPRECATED_START
         VPU_CONFIG_KEY(HW_INJECT_STAGES),
         VPU_CONFIG_KEY(HW_POOL_CONV_MERGE),
         VPU_CONFIG_KEY(PACK_DATA_IN_CMX),
+        VPU_CONFIG_KEY(CMX_ALLOCATION_STRATEGY),
         VPU_CONFIG_KEY(HW_DILATION),
+        VPU_CONFIG_KEY(HW_GLOBAL_TILING),
         VPU_CONFIG_KEY(FORCE_DEPRECATED_CNN_CONVERSION),
         VPU_CONFIG_KEY(DISABLE_REORDER),
         VPU_CONFIG_KEY(ENABLE_PERMUTE_MERGING),
@@ -109,6 +111,11 @@ void ParsedConfig::parse(const std::map<std::string, std::string>& config) {
         { VPU_CONFIG_VALUE(PER_STAGE), PerfReport::PerStage },
     };
 
+    static const std::unordered_map<std::string, CmxAllocationStrategy> cmxAllocationStrategies {
+        { VPU_CONFIG_VALUE(GREEDY),   CmxAllocationStrategy::Greedy },
+        { VPU_CONFIG_VALUE(LIFETIME), CmxAllocationStrategy::Lifetime },
+    };
+
     static const auto parseStrides = [](const std::string& src) {
         auto configStrides = src;
         configStrides.pop_back();
@@ -151,12 +158,14 @@ void ParsedConfig::parse(const std::map<std::string, std::string>& config) {
     setOption(_compileConfig.detectBatch,                    switches, config, VPU_CONFIG_KEY(DETECT_NETWORK_BATCH));
     setOption(_compileConfig.copyOptimization,               switches, config, VPU_CONFIG_KEY(COPY_OPTIMIZATION));
     setOption(_compileConfig.packDataInCmx,                  switches, config, VPU_CONFIG_KEY(PACK_DATA_IN_CMX));
+    setOption(_compileConfig.cmxAllocationStrategy, cmxAllocationStrategies, config, VPU_CONFIG_KEY(CMX_ALLOCATION_STRATEGY));
     setOption(_compileConfig.ignoreUnknownLayers,            switches, config, VPU_CONFIG_KEY(IGNORE_UNKNOWN_LAYERS));
     setOption(_compileConfig.hwOptimization,                 switches, config, VPU_CONFIG_KEY(HW_STAGES_OPTIMIZATION));
     setOption(_compileConfig.injectSwOps,                    switches, config, VPU_CONFIG_KEY(HW_INJECT_STAGES));
     setOption(_compileConfig.mergeHwPoolToConv,              switches, config, VPU_CONFIG_KEY(HW_POOL_CONV_MERGE));
     setOption(_compileConfig.ignoreIRStatistic,              switches, config, VPU_CONFIG_KEY(IGNORE_IR_STATISTIC));
     setOption(_compileConfig.hwDilation,                     switches, config, VPU_CONFIG_KEY(HW_DILATION));
+    setOption(_compileConfig.hwGlobalTiling,                 switches, config, VPU_CONFIG_KEY(HW_GLOBAL_TILING));
     setOption(_compileConfig.forceDeprecatedCnnConversion,   switches, config, VPU_CONFIG_KEY(FORCE_DEPRECATED_CNN_CONVERSION));
     setOption(_compileConfig.disableReorder,                 switches, config, VPU_CONFIG_KEY(DISABLE_REORDER));
     setOption(_compileConfig.enablePermuteMerging,           switches, config, VPU_CONFIG_KEY(ENABLE_PERMUTE_MERGING));
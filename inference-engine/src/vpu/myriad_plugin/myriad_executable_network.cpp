@@ -10,6 +10,7 @@
 #include "exec_graph_info.hpp"
 #include <myriad_executable_network.h>
 #include <vpu/blob_reader.hpp>
+#include <vpu/private_plugin_config.hpp>
 #include <vpu/utils/profiling.hpp>
 #include <details/ie_cnn_network_tools.h>
 #include <net_pass.h>
@@ -64,7 +65,9 @@ ExecutableNetwork::ExecutableNetwork(
         METRIC_KEY(SUPPORTED_METRICS),
         METRIC_KEY(SUPPORTED_CONFIG_KEYS),
         METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
-        METRIC_KEY(DEVICE_THERMAL)
+        METRIC_KEY(DEVICE_THERMAL),
+        VPU_METRIC(COMPILE_PASSES_TIMINGS),
+        VPU_METRIC(COMPILE_STATISTICS)
     };
 }
 
@@ -92,6 +95,8 @@ ExecutableNetwork::ExecutableNetwork(
 
     _graphBlob = std::move(compiledGraph->blob);
     _graphMetaData = std::move(compiledGraph->graphMeta);
+    _passesTimings = std::move(compiledGraph->passesTimings);
+    _compileStatistics = std::move(compiledGraph->statistics);
 
     _inputInfo  = std::move(compiledGraph->inputInfo);
     _outputInfo = std::move(compiledGraph->outputInfo);
@@ -193,6 +198,10 @@ void ExecutableNetwork::GetMetric(const std::string &name, Parameter &result, Re
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(2u * _actualNumExecutors));
     } else if (name == METRIC_KEY(DEVICE_THERMAL)) {
         result = IE_SET_METRIC(DEVICE_THERMAL, _executor->GetThermal(_device));
+    } else if (name == VPU_METRIC(COMPILE_PASSES_TIMINGS)) {
+        result = IE_SET_METRIC(VPU_COMPILE_PASSES_TIMINGS, _passesTimings);
+    } else if (name == VPU_METRIC(COMPILE_STATISTICS)) {
+        result = IE_SET_METRIC(VPU_COMPILE_STATISTICS, _compileStatistics);
     } else {
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
     }
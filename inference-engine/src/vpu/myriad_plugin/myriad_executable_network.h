@@ -121,6 +121,8 @@ private:
     GraphDesc _graphDesc;
     DevicePtr _device;
     GraphMetaInfo _graphMetaData;
+    PassesTimings _passesTimings;
+    CompileStatistics _compileStatistics;
     MyriadConfig _config;
     int _actualNumExecutors = 0;
     std::vector<std::string> _supportedMetrics;
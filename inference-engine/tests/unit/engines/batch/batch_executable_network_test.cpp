@@ -0,0 +1,269 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
+
+#include "batch_executable_network.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace BatchPlugin;
+
+namespace {
+
+InputsDataMap makeInputs(size_t batch) {
+    auto input = std::make_shared<InputInfo>();
+    input->setInputData(std::make_shared<Data>("data", TensorDesc(Precision::FP32, {batch, 4}, Layout::NC)));
+    return {{"data", input}};
+}
+
+OutputsDataMap makeOutputs(size_t batch) {
+    return {{"out", std::make_shared<Data>("out", TensorDesc(Precision::FP32, {batch, 4}, Layout::NC))}};
+}
+
+/**
+ * @brief Network which doubles its input and records the batches of its inferences
+ */
+class FakeExecutableNetwork : public ExecutableNetworkThreadSafeDefault {
+public:
+    FakeExecutableNetwork(const std::string& name, size_t batch) : _name(name) {
+        _networkInputs = makeInputs(batch);
+        _networkOutputs = makeOutputs(batch);
+    }
+
+    InferRequestInternal::Ptr CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                     OutputsDataMap networkOutputs) override;
+
+    std::vector<int> getBatches() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _batches;
+    }
+
+    void addBatch(int batch) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _batches.push_back(batch);
+    }
+
+    std::string _name;
+    bool _fail = false;
+
+private:
+    std::mutex _mutex;
+    std::vector<int> _batches;
+};
+
+class FakeInferRequest : public InferRequestInternal {
+public:
+    FakeInferRequest(InputsDataMap networkInputs, OutputsDataMap networkOutputs, FakeExecutableNetwork& network) :
+        InferRequestInternal(networkInputs, networkOutputs), _network(network) {
+        for (auto&& input : _networkInputs) {
+            _inputs[input.first] = make_shared_blob<float>(input.second->getTensorDesc());
+            _inputs[input.first]->allocate();
+        }
+        for (auto&& output : _networkOutputs) {
+            _outputs[output.first] = make_shared_blob<float>(output.second->getTensorDesc());
+            _outputs[output.first]->allocate();
+        }
+    }
+
+    void InferImpl() override {
+        auto input = _inputs["data"];
+        int batch = _batch > 0 ? _batch : static_cast<int>(input->getTensorDesc().getDims()[0]);
+        _network.addBatch(batch);
+        if (_network._fail) {
+            THROW_IE_EXCEPTION << "Inference of " << _network._name << " failed";
+        }
+        auto src = input->buffer().as<const float*>();
+        auto dst = _outputs["out"]->buffer().as<float*>();
+        for (int i = 0; i < batch * 4; i++) {
+            dst[i] = 2.f * src[i];
+        }
+    }
+
+    void GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo>& perfMap) const override {
+        InferenceEngineProfileInfo info = {};
+        info.status = InferenceEngineProfileInfo::EXECUTED;
+        perfMap = {{_network._name, info}};
+    }
+
+    void SetBatch(int batch) override {
+        _batch = batch;
+    }
+
+private:
+    FakeExecutableNetwork& _network;
+    int _batch = 0;
+};
+
+InferRequestInternal::Ptr FakeExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                                        OutputsDataMap networkOutputs) {
+    return std::make_shared<FakeInferRequest>(networkInputs, networkOutputs, *this);
+}
+
+}  // namespace
+
+class BatchExecutableNetworkTests : public ::testing::Test {
+protected:
+    std::shared_ptr<FakeExecutableNetwork> batched;
+    std::shared_ptr<FakeExecutableNetwork> single;
+    BatchExecutableNetwork::Ptr network;
+    ResponseDesc resp;
+
+    void load(size_t batchSize, std::chrono::microseconds timeout, bool dynamicBatch) {
+        batched = std::make_shared<FakeExecutableNetwork>("batched", batchSize);
+        single = std::make_shared<FakeExecutableNetwork>("single", 1);
+        network = std::make_shared<BatchExecutableNetwork>(ExecutableNetwork(make_executable_network(batched)),
+                                                           ExecutableNetwork(make_executable_network(single)),
+                                                           std::map<std::string, std::string>{},
+                                                           batchSize, timeout, dynamicBatch);
+        network->setNetworkInputs(makeInputs(1));
+        network->setNetworkOutputs(makeOutputs(1));
+    }
+
+    IInferRequest::Ptr createRequest(float value) {
+        IInferRequest::Ptr request;
+        network->CreateInferRequest(request);
+        Blob::Ptr input;
+        EXPECT_EQ(StatusCode::OK, request->GetBlob("data", input, &resp)) << resp.msg;
+        auto data = input->buffer().as<float*>();
+        for (size_t i = 0; i < input->size(); i++) {
+            data[i] = value;
+        }
+        return request;
+    }
+
+    Blob::Ptr getOutput(const IInferRequest::Ptr& request) {
+        Blob::Ptr output;
+        EXPECT_EQ(StatusCode::OK, request->GetBlob("out", output, &resp)) << resp.msg;
+        return output;
+    }
+
+    std::string getProfiledNetwork(const IInferRequest::Ptr& request) {
+        std::map<std::string, InferenceEngineProfileInfo> perfMap;
+        EXPECT_EQ(StatusCode::OK, request->GetPerformanceCounts(perfMap, &resp)) << resp.msg;
+        return perfMap.size() == 1 ? perfMap.begin()->first : std::string{};
+    }
+
+    static void expectFilled(const Blob::Ptr& blob, float value) {
+        auto data = blob->buffer().as<const float*>();
+        for (size_t i = 0; i < blob->size(); i++) {
+            ASSERT_EQ(value, data[i]) << "at " << i;
+        }
+    }
+};
+
+TEST_F(BatchExecutableNetworkTests, requestsAreCoalescedIntoOneBatchedInference) {
+    load(2, std::chrono::seconds(10), false);
+    auto first = createRequest(1.f);
+    auto second = createRequest(2.f);
+    // The output set by the user is filled by a copy from the slot of the batch
+    auto userOutput = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 4}, Layout::NC));
+    userOutput->allocate();
+    ASSERT_EQ(StatusCode::OK, second->SetBlob("out", userOutput, &resp)) << resp.msg;
+
+    ASSERT_EQ(StatusCode::OK, first->StartAsync(&resp)) << resp.msg;
+    ASSERT_EQ(StatusCode::OK, second->StartAsync(&resp)) << resp.msg;
+    ASSERT_EQ(StatusCode::OK, first->Wait(IInferRequest::WaitMode::RESULT_READY, &resp)) << resp.msg;
+    ASSERT_EQ(StatusCode::OK, second->Wait(IInferRequest::WaitMode::RESULT_READY, &resp)) << resp.msg;
+
+    ASSERT_EQ(std::vector<int>{2}, batched->getBatches());
+    ASSERT_TRUE(single->getBatches().empty());
+    ASSERT_NO_FATAL_FAILURE(expectFilled(getOutput(first), 2.f));
+    ASSERT_NO_FATAL_FAILURE(expectFilled(userOutput, 4.f));
+    ASSERT_EQ("batched", getProfiledNetwork(first));
+    ASSERT_EQ("batched", getProfiledNetwork(second));
+}
+
+TEST_F(BatchExecutableNetworkTests, partialBatchIsInferredByNotBatchedNetworkAfterTimeout) {
+    load(2, std::chrono::milliseconds(1), false);
+    auto first = createRequest(3.f);
+    auto second = createRequest(5.f);
+
+    ASSERT_EQ(StatusCode::OK, first->StartAsync(&resp)) << resp.msg;
+    ASSERT_EQ(StatusCode::OK, first->Wait(IInferRequest::WaitMode::RESULT_READY, &resp)) << resp.msg;
+
+    ASSERT_TRUE(batched->getBatches().empty());
+    ASSERT_EQ(std::vector<int>{1}, single->getBatches());
+    ASSERT_NO_FATAL_FAILURE(expectFilled(getOutput(first), 6.f));
+    ASSERT_EQ("single", getProfiledNetwork(first));
+}
+
+TEST_F(BatchExecutableNetworkTests, firstSlotsAreInferredWithDynamicBatchAfterTimeout) {
+    load(4, std::chrono::milliseconds(1), true);
+    auto first = createRequest(1.f);
+    auto second = createRequest(2.f);
+
+    ASSERT_EQ(StatusCode::OK, first->StartAsync(&resp)) << resp.msg;
+    ASSERT_EQ(StatusCode::OK, first->Wait(IInferRequest::WaitMode::RESULT_READY, &resp)) << resp.msg;
+
+    ASSERT_EQ(std::vector<int>{1}, batched->getBatches());
+    ASSERT_TRUE(single->getBatches().empty());
+    ASSERT_NO_FATAL_FAILURE(expectFilled(getOutput(first), 2.f));
+    ASSERT_EQ("batched", getProfiledNetwork(first));
+}
+
+TEST_F(BatchExecutableNetworkTests, notFirstSlotIsInferredByNotBatchedNetworkWithDynamicBatch) {
+    load(4, std::chrono::milliseconds(1), true);
+    auto first = createRequest(1.f);
+    auto second = createRequest(2.f);
+
+    ASSERT_EQ(StatusCode::OK, second->StartAsync(&resp)) << resp.msg;
+    ASSERT_EQ(StatusCode::OK, second->Wait(IInferRequest::WaitMode::RESULT_READY, &resp)) << resp.msg;
+
+    ASSERT_TRUE(batched->getBatches().empty());
+    ASSERT_EQ(std::vector<int>{1}, single->getBatches());
+    ASSERT_NO_FATAL_FAILURE(expectFilled(getOutput(second), 4.f));
+    ASSERT_EQ("single", getProfiledNetwork(second));
+}
+
+TEST_F(BatchExecutableNetworkTests, syncInferIsNotBatched) {
+    load(2, std::chrono::seconds(10), false);
+    auto first = createRequest(1.f);
+
+    ASSERT_EQ(StatusCode::OK, first->Infer(&resp)) << resp.msg;
+
+    ASSERT_TRUE(batched->getBatches().empty());
+    ASSERT_EQ(std::vector<int>{1}, single->getBatches());
+    ASSERT_NO_FATAL_FAILURE(expectFilled(getOutput(first), 2.f));
+    ASSERT_EQ("single", getProfiledNetwork(first));
+}
+
+TEST_F(BatchExecutableNetworkTests, failureOfBatchedInferenceIsReportedToAllRequests) {
+    load(2, std::chrono::seconds(10), false);
+    batched->_fail = true;
+    auto first = createRequest(1.f);
+    auto second = createRequest(2.f);
+
+    ASSERT_EQ(StatusCode::OK, first->StartAsync(&resp)) << resp.msg;
+    ASSERT_EQ(StatusCode::OK, second->StartAsync(&resp)) << resp.msg;
+    ASSERT_EQ(StatusCode::GENERAL_ERROR, first->Wait(IInferRequest::WaitMode::RESULT_READY, &resp));
+    ASSERT_EQ(StatusCode::GENERAL_ERROR, second->Wait(IInferRequest::WaitMode::RESULT_READY, &resp));
+}
+
+TEST_F(BatchExecutableNetworkTests, slotOfDestroyedRequestIsReused) {
+    load(2, std::chrono::seconds(10), false);
+    auto first = createRequest(1.f);
+    {
+        auto second = createRequest(2.f);
+    }
+    auto third = createRequest(3.f);
+
+    ASSERT_EQ(StatusCode::OK, first->StartAsync(&resp)) << resp.msg;
+    ASSERT_EQ(StatusCode::OK, third->StartAsync(&resp)) << resp.msg;
+    ASSERT_EQ(StatusCode::OK, first->Wait(IInferRequest::WaitMode::RESULT_READY, &resp)) << resp.msg;
+    ASSERT_EQ(StatusCode::OK, third->Wait(IInferRequest::WaitMode::RESULT_READY, &resp)) << resp.msg;
+
+    ASSERT_EQ(std::vector<int>{2}, batched->getBatches());
+    ASSERT_NO_FATAL_FAILURE(expectFilled(getOutput(third), 6.f));
+}
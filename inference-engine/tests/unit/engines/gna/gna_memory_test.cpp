@@ -437,4 +437,86 @@ TEST_F(GNAMemoryTest, canUpdateSizeOfPushRequestWithBindRequestWhenAlloc) {
     ASSERT_FLOAT_EQ(pFutureInput[0], 1);
     ASSERT_FLOAT_EQ(pFutureInput[1], 2);
     ASSERT_FLOAT_EQ(pFutureInput[2], 3);
-}
\ No newline at end of file
+}
+
+TEST_F(GNAMemoryTest, canShareMemoryBetweenNonOverlappingScratchBuffers) {
+    float *pFuture1 = nullptr;
+    float *pFuture2 = nullptr;
+    float *pFuture3 = nullptr;
+    float *pInput2 = nullptr;
+    float *pInput3 = nullptr;
+
+    // layer 0 produces pFuture1, layer 1 reads it and produces pFuture2, layer 2 reads pFuture2 and produces pFuture3
+    mem.set_layer_index(0);
+    mem.reserve_scratch_ptr(&pFuture1, 64, 64);
+    mem.set_layer_index(1);
+    mem.bind_ptr(&pInput2, &pFuture1);
+    mem.reserve_scratch_ptr(&pFuture2, 64, 64);
+    mem.set_layer_index(2);
+    mem.bind_ptr(&pInput3, &pFuture2);
+    mem.reserve_scratch_ptr(&pFuture3, 64, 64);
+    mem.set_layer_index(-1);
+
+    mem.commit();
+
+    ASSERT_EQ(mem.getTotalBytes(), 128);
+    ASSERT_EQ(mem.getScratchSavedBytes(), 64);
+
+    ASSERT_EQ(pInput2, pFuture1);
+    ASSERT_EQ(pInput3, pFuture2);
+    ASSERT_NE(pFuture1, pFuture2);
+    ASSERT_NE(pFuture2, pFuture3);
+    ASSERT_EQ(pFuture1, pFuture3);
+}
+
+TEST_F(GNAMemoryTest, canNotShareScratchBufferUsedOutsideOfLayers) {
+    float *pFuture1 = nullptr;
+    float *pFuture2 = nullptr;
+    float *pOutput = nullptr;
+
+    mem.set_layer_index(0);
+    mem.reserve_scratch_ptr(&pFuture1, 64, 64);
+    mem.set_layer_index(1);
+    mem.reserve_scratch_ptr(&pFuture2, 64, 64);
+    mem.set_layer_index(-1);
+    // network output is read after all layers
+    mem.bind_ptr(&pOutput, &pFuture1);
+
+    mem.commit();
+
+    ASSERT_EQ(mem.getTotalBytes(), 128);
+    ASSERT_EQ(mem.getScratchSavedBytes(), 0);
+    ASSERT_EQ(pOutput, pFuture1);
+    ASSERT_NE(pFuture1, pFuture2);
+}
+
+TEST_F(GNAMemoryTest, readWriteSectionSizeAfterCommitMatchesCommittedLayout) {
+    float *pScratch1 = nullptr;
+    float *pScratch2 = nullptr;
+    float *pInput2 = nullptr;
+    float *pState = nullptr;
+    float *pConst = nullptr;
+
+    mem.set_layer_index(0);
+    mem.reserve_scratch_ptr(&pScratch1, 64, 64);
+    mem.set_layer_index(1);
+    mem.bind_ptr(&pInput2, &pScratch1);
+    mem.reserve_scratch_ptr(&pScratch2, 64, 64);
+    mem.set_layer_index(-1);
+    mem.reserve_ptr(&pState, 64, 64);
+    mem.readonly().push_value(&pConst, 1.f, 16, 64);
+
+    auto rwBytesBeforeCommit = mem.calculateRWBytes();
+    mem.commit();
+
+    // read only section is placed right after the read/write one
+    auto base = reinterpret_cast<uint8_t*>(mem.getBasePtr());
+    ASSERT_EQ(mem.getRWBytes(), reinterpret_cast<uint8_t*>(pConst) - base);
+    ASSERT_EQ(mem.getRWBytes(), rwBytesBeforeCommit);
+    ASSERT_EQ(mem.getRWBytes(), 192);
+    ASSERT_EQ(mem.getTotalBytes(), 256);
+
+    // getters do not lay memory out again
+    ASSERT_EQ(mem.getRWBytes(), 192);
+    ASSERT_EQ(mem.getScratchSavedBytes(), 0);
+}
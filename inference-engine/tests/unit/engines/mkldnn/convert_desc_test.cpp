@@ -131,3 +131,21 @@ INSTANTIATE_TEST_CASE_P(
 //                TD2mkldnn_test_params{{1, 16, 8, 8}, mkldnn::memory::format::oIhw8i},
 //                TD2mkldnn_test_params{{1, 3, 8, 8}, mkldnn::memory::format::OhIw16o4i}
         ));
+
+TEST(TensorDesc2MKLDNNConvertTests, TestsConvertationOfStridedChannelsLastView) {
+    // View on channels [2, 5) of 1x8x4x4 nhwc tensor as it is used by inplace concat
+    InferenceEngine::SizeVector dims = {1, 3, 4, 4};
+    InferenceEngine::SizeVector blkDims = {1, 4, 4, 3};
+    InferenceEngine::SizeVector order = {0, 2, 3, 1};
+    InferenceEngine::SizeVector strides = {128, 32, 8, 1};
+    InferenceEngine::TensorDesc tDesc(InferenceEngine::Precision::FP32, dims, {blkDims, order, 2, {0, 0, 0, 0}, strides});
+    MKLDNNPlugin::MKLDNNMemoryDesc desc(tDesc);
+
+    mkldnn::impl::memory_desc_wrapper dst_d(((mkldnn::memory::desc&)desc).data);
+
+    size_t total_size = std::accumulate(std::begin(dims), std::end(dims), (size_t) 1, std::multiplies<size_t>());
+
+    for (size_t i = 0; i < total_size; i++) {
+        ASSERT_EQ(tDesc.offset(i), dst_d.off_l(i));
+    }
+}
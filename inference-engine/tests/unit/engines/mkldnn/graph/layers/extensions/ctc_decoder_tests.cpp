@@ -0,0 +1,210 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_extension_utils.h>
+#include "tests_common.hpp"
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct ctc_decoder_test_params {
+    std::string type;
+    size_t T;
+    size_t N;
+    size_t C;
+    std::string params;
+
+    // Probabilities in [T, N, C] layout, random ones are generated if empty
+    std::vector<float> probabilities;
+    // Sequence lengths, one per batch
+    std::vector<size_t> lengths;
+    // Expected decoded sequences, reference greedy decoding is used if empty
+    std::vector<std::vector<float>> reference;
+};
+
+static void ref_ctc_greedy(const float *probs, const std::vector<size_t> &lengths, float *dst, size_t T, size_t N, size_t C) {
+    for (size_t n = 0; n < N; n++) {
+        size_t out = 0;
+        int prev = -1;
+        for (size_t t = 0; t < lengths[n]; t++) {
+            const float *p = probs + (t * N + n) * C;
+            int max_idx = 0;
+            for (size_t c = 1; c < C; c++) {
+                if (p[c] > p[max_idx])
+                    max_idx = static_cast<int>(c);
+            }
+            if (max_idx < static_cast<int>(C) - 1 && max_idx != prev)
+                dst[n * T + out++] = static_cast<float>(max_idx);
+            prev = max_idx;
+        }
+        for (; out < T; out++)
+            dst[n * T + out] = -1.0f;
+    }
+}
+
+class MKLDNNCPUExtCTCDecoderTests: public TestsCommon, public WithParamInterface<ctc_decoder_test_params> {
+    std::string model_t = R"V0G0N(
+<net Name="CTCDecoder_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="probabilities" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    <dim>_T_</dim>
+                    <dim>_N_</dim>
+                    <dim>_C_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sequence_indicators" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="2">
+                    <dim>_T_</dim>
+                    <dim>_N_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="decoder" id="3" type="_TYPE_" precision="FP32">
+            <data _PARAMS_/>
+            <input>
+                <port id="1">
+                    <dim>_T_</dim>
+                    <dim>_N_</dim>
+                    <dim>_C_</dim>
+                </port>
+                <port id="2">
+                    <dim>_T_</dim>
+                    <dim>_N_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_N_</dim>
+                    <dim>_T_</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string getModel(ctc_decoder_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_STR(model, "_TYPE_", p.type);
+        REPLACE_WITH_STR(model, "_PARAMS_", p.params);
+        REPLACE_WITH_NUM(model, "_T_", p.T);
+        REPLACE_WITH_NUM(model, "_N_", p.N);
+        REPLACE_WITH_NUM(model, "_C_", p.C);
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            ctc_decoder_test_params p = ::testing::WithParamInterface<ctc_decoder_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            InferenceEngine::Blob::Ptr probabilities = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                                                                                                 {p.T, p.N, p.C}, InferenceEngine::CHW});
+            probabilities->allocate();
+            if (p.probabilities.empty()) {
+                fill_data(probabilities->buffer(), probabilities->size());
+            } else {
+                ASSERT_EQ(p.probabilities.size(), probabilities->size());
+                std::copy(p.probabilities.begin(), p.probabilities.end(), probabilities->buffer().as<float *>());
+            }
+
+            InferenceEngine::Blob::Ptr indicators = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                                                                                              {p.T, p.N}, InferenceEngine::HW});
+            indicators->allocate();
+            float *indicators_data = indicators->buffer().as<float *>();
+            for (size_t t = 0; t < p.T; t++) {
+                for (size_t n = 0; n < p.N; n++) {
+                    indicators_data[t * p.N + n] = (t == 0 || t < p.lengths[n]) ? 1.0f : 0.0f;
+                }
+            }
+
+            InferenceEngine::BlobMap srcs;
+            srcs["probabilities"] = probabilities;
+            srcs["sequence_indicators"] = indicators;
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            if (p.reference.empty()) {
+                ref_ctc_greedy(probabilities->buffer().as<const float *>(), p.lengths, dst_ref.data(), p.T, p.N, p.C);
+            } else {
+                ASSERT_EQ(p.reference.size(), p.N);
+                for (size_t n = 0; n < p.N; n++) {
+                    for (size_t t = 0; t < p.T; t++)
+                        dst_ref.data()[n * p.T + t] = t < p.reference[n].size() ? p.reference[n][t] : -1.0f;
+                }
+            }
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtCTCDecoderTests, TestsCTCDecoder) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsCTCGreedyDecoder, MKLDNNCPUExtCTCDecoderTests,
+        ::testing::Values(
+                ctc_decoder_test_params{ "CTCGreedyDecoder", 20, 1, 3, "ctc_merge_repeated=\"1\"", {}, {20}, {} },
+                ctc_decoder_test_params{ "CTCGreedyDecoder", 20, 4, 37, "ctc_merge_repeated=\"1\"", {}, {20, 7, 1, 15}, {} },
+                ctc_decoder_test_params{ "CTCGreedyDecoder", 88, 64, 71, "ctc_merge_repeated=\"1\"", {}, std::vector<size_t>(64, 50), {} },
+                ctc_decoder_test_params{ "CTCGreedyDecoder", 8, 3, 16, "ctc_merge_repeated=\"1\"", {}, {8, 5, 3}, {} }));
+
+// Best path "blank, blank" has probability 0.36 while all paths decoded to "0" sum up to 0.64
+INSTANTIATE_TEST_CASE_P(
+        TestsCTCBeamSearchDecoder, MKLDNNCPUExtCTCDecoderTests,
+        ::testing::Values(
+                ctc_decoder_test_params{ "CTCBeamSearchDecoder", 2, 1, 2, "beam_width=\"4\"",
+                                         {0.4f, 0.6f, 0.4f, 0.6f}, {2}, {{0.0f}} },
+                ctc_decoder_test_params{ "CTCBeamSearchDecoder", 5, 2, 3, "beam_width=\"8\" prune_threshold=\"0.01\"",
+                                         {0.9f, 0.05f, 0.05f,  0.05f, 0.9f, 0.05f,
+                                          0.9f, 0.05f, 0.05f,  0.05f, 0.9f, 0.05f,
+                                          0.05f, 0.05f, 0.9f,  0.05f, 0.05f, 0.9f,
+                                          0.9f, 0.05f, 0.05f,  0.9f, 0.05f, 0.05f,
+                                          0.05f, 0.9f, 0.05f,  0.05f, 0.9f, 0.05f},
+                                         {5, 4}, {{0.0f, 0.0f, 1.0f}, {1.0f, 0.0f}} }));
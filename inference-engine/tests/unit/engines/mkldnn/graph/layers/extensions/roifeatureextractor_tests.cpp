@@ -0,0 +1,284 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_extension_utils.h>
+#include "tests_common.hpp"
+
+#include <chrono>
+#include <cmath>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct roifeatureextractor_test_params {
+    size_t num_rois;
+    size_t channels;
+    // Spatial sizes of feature maps, one per pyramid level
+    std::vector<std::pair<size_t, size_t>> levels;
+    std::vector<int> pyramid_scales;
+
+    int output_size;
+    int sampling_ratio;
+
+    // Every third ROI has zero or negative area, its features are expected to be zeros
+    bool degenerate_rois;
+
+    // Number of inferences to measure, no check against reference is done if it is not zero
+    size_t benchmark_iterations;
+};
+
+static float ref_bilinear(const float *data, int height, int width, float y, float x) {
+    if (y < -1.0f || y > height || x < -1.0f || x > width)
+        return 0.0f;
+
+    y = (std::max)(y, 0.0f);
+    x = (std::max)(x, 0.0f);
+
+    int y_low = static_cast<int>(y);
+    int x_low = static_cast<int>(x);
+    int y_high = y_low + 1;
+    int x_high = x_low + 1;
+    if (y_low >= height - 1) {
+        y_high = y_low = height - 1;
+        y = static_cast<float>(y_low);
+    }
+    if (x_low >= width - 1) {
+        x_high = x_low = width - 1;
+        x = static_cast<float>(x_low);
+    }
+
+    float ly = y - y_low;
+    float lx = x - x_low;
+    float hy = 1.0f - ly;
+    float hx = 1.0f - lx;
+    return hy * hx * data[y_low * width + x_low] + hy * lx * data[y_low * width + x_high] +
+           ly * hx * data[y_high * width + x_low] + ly * lx * data[y_high * width + x_high];
+}
+
+static void ref_roifeatureextractor(const float *rois, const std::vector<const float *> &featuremaps,
+                                    float *dst, const roifeatureextractor_test_params &p) {
+    const int levels_num = static_cast<int>(p.levels.size());
+    const int C = static_cast<int>(p.channels);
+    const int P = p.output_size;
+
+    for (size_t r = 0; r < p.num_rois; r++) {
+        const float *roi = rois + 4 * r;
+
+        int level = levels_num;
+        float area = (roi[2] - roi[0]) * (roi[3] - roi[1]);
+        if (area > 0) {
+            area = std::log2(std::sqrt(area) / 224.0f + 1e-6f);
+            level = static_cast<int>(std::floor(area + 2));
+            level = (std::max)(0, (std::min)(levels_num - 1, level));
+        }
+        if (level >= levels_num) {
+            std::fill_n(dst + r * C * P * P, C * P * P, 0.0f);
+            continue;
+        }
+
+        const int H = static_cast<int>(p.levels[level].first);
+        const int W = static_cast<int>(p.levels[level].second);
+        const float scale = 1.0f / p.pyramid_scales[level];
+
+        float start_w = roi[0] * scale;
+        float start_h = roi[1] * scale;
+        float roi_w = (std::max)(roi[2] * scale - start_w, 1.0f);
+        float roi_h = (std::max)(roi[3] * scale - start_h, 1.0f);
+        float bin_h = roi_h / P;
+        float bin_w = roi_w / P;
+        int grid_h = p.sampling_ratio > 0 ? p.sampling_ratio : static_cast<int>(std::ceil(roi_h / P));
+        int grid_w = p.sampling_ratio > 0 ? p.sampling_ratio : static_cast<int>(std::ceil(roi_w / P));
+
+        for (int c = 0; c < C; c++) {
+            const float *data = featuremaps[level] + c * H * W;
+            for (int ph = 0; ph < P; ph++) {
+                for (int pw = 0; pw < P; pw++) {
+                    float sum = 0.0f;
+                    for (int iy = 0; iy < grid_h; iy++) {
+                        float y = start_h + ph * bin_h + (iy + .5f) * bin_h / grid_h;
+                        for (int ix = 0; ix < grid_w; ix++) {
+                            float x = start_w + pw * bin_w + (ix + .5f) * bin_w / grid_w;
+                            sum += ref_bilinear(data, H, W, y, x);
+                        }
+                    }
+                    dst[((r * C + c) * P + ph) * P + pw] = sum / (grid_h * grid_w);
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtROIFeatureExtractorTests: public TestsCommon, public WithParamInterface<roifeatureextractor_test_params> {
+    std::string getModel(roifeatureextractor_test_params p) {
+        std::string scales;
+        for (size_t i = 0; i < p.pyramid_scales.size(); i++)
+            scales += (i ? "," : "") + std::to_string(p.pyramid_scales[i]);
+
+        std::string layers = R"V0G0N(
+        <layer name="rois" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>)V0G0N" + std::to_string(p.num_rois) + R"V0G0N(</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+        std::string inputs = R"V0G0N(
+                <port id="0">
+                    <dim>)V0G0N" + std::to_string(p.num_rois) + R"V0G0N(</dim>
+                    <dim>4</dim>
+                </port>)V0G0N";
+        std::string edges = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="100" to-port="0"/>)V0G0N";
+
+        for (size_t i = 0; i < p.levels.size(); i++) {
+            std::string id = std::to_string(i + 1);
+            std::string port = "<port id=\"" + (i ? id : std::string("0")) + "\">";
+            std::string dims = "<dim>1</dim><dim>" + std::to_string(p.channels) + "</dim><dim>" +
+                               std::to_string(p.levels[i].first) + "</dim><dim>" + std::to_string(p.levels[i].second) + "</dim>";
+            layers += "\n        <layer name=\"level" + id + "\" type=\"Input\" precision=\"FP32\" id=\"" + id + "\">"
+                      "<output><port id=\"0\">" + dims + "</port></output></layer>";
+            inputs += "\n                <port id=\"" + id + "\">" + dims + "</port>";
+            edges += "\n        <edge from-layer=\"" + id + "\" from-port=\"0\" to-layer=\"100\" to-port=\"" + id + "\"/>";
+        }
+
+        return R"V0G0N(
+<net name="ROIFeatureExtractor_Only" version="2" precision="FP32" batch="1">
+    <layers>)V0G0N" + layers + R"V0G0N(
+        <layer name="roifeatureextractor" id="100" type="ExperimentalDetectronROIFeatureExtractor" precision="FP32">
+            <data output_size=")V0G0N" + std::to_string(p.output_size) + R"V0G0N(" pyramid_scales=")V0G0N" + scales +
+               R"V0G0N(" sampling_ratio=")V0G0N" + std::to_string(p.sampling_ratio) + R"V0G0N("/>
+            <input>)V0G0N" + inputs + R"V0G0N(
+            </input>
+            <output>
+                <port id="200">
+                    <dim>)V0G0N" + std::to_string(p.num_rois) + R"V0G0N(</dim>
+                    <dim>)V0G0N" + std::to_string(p.channels) + R"V0G0N(</dim>
+                    <dim>)V0G0N" + std::to_string(p.output_size) + R"V0G0N(</dim>
+                    <dim>)V0G0N" + std::to_string(p.output_size) + R"V0G0N(</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>)V0G0N" + edges + R"V0G0N(
+    </edges>
+</net>
+)V0G0N";
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            roifeatureextractor_test_params p = ::testing::WithParamInterface<roifeatureextractor_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            // ROIs are spread over the image, so all pyramid levels get some of them
+            const float image_h = static_cast<float>(p.levels[0].first * p.pyramid_scales[0]);
+            const float image_w = static_cast<float>(p.levels[0].second * p.pyramid_scales[0]);
+            InferenceEngine::Blob::Ptr rois = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                                                                                        {p.num_rois, 4}, InferenceEngine::NC});
+            rois->allocate();
+            float *rois_data = rois->buffer().as<float *>();
+            for (size_t r = 0; r < p.num_rois; r++) {
+                float size = 16.0f + (r * 37 % 97) / 97.0f * (std::min)(image_h, image_w) * 0.8f;
+                float x0 = (r * 53 % 89) / 89.0f * (image_w - size);
+                float y0 = (r * 71 % 83) / 83.0f * (image_h - size);
+                rois_data[4 * r + 0] = x0;
+                rois_data[4 * r + 1] = y0;
+                rois_data[4 * r + 2] = x0 + size;
+                rois_data[4 * r + 3] = y0 + size;
+                if (p.degenerate_rois && r % 3 == 1) {
+                    // zero width for odd ROIs, inverted corners for even ones
+                    if (r % 2)
+                        rois_data[4 * r + 2] = x0;
+                    else
+                        std::swap(rois_data[4 * r + 1], rois_data[4 * r + 3]);
+                }
+            }
+
+            InferenceEngine::BlobMap srcs;
+            srcs["rois"] = rois;
+            std::vector<const float *> featuremaps;
+            for (size_t i = 0; i < p.levels.size(); i++) {
+                InferenceEngine::SizeVector dims = {1, p.channels, p.levels[i].first, p.levels[i].second};
+                InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                                                                                           dims, InferenceEngine::NCHW});
+                src->allocate();
+                fill_data(src->buffer(), src->size());
+                featuremaps.push_back(src->buffer().as<const float *>());
+                srcs["level" + std::to_string(i + 1)] = src;
+            }
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            // Rows the layer does not write keep garbage
+            std::fill_n(output->buffer().as<float *>(), output->size(), 42.0f);
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            if (p.benchmark_iterations) {
+                auto start = std::chrono::high_resolution_clock::now();
+                for (size_t i = 0; i < p.benchmark_iterations; i++)
+                    graph.Infer(srcs, outputBlobs);
+                auto end = std::chrono::high_resolution_clock::now();
+                double us = std::chrono::duration<double, std::micro>(end - start).count() / p.benchmark_iterations;
+                RecordProperty("us_per_inference", static_cast<int>(us));
+                return;
+            }
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_roifeatureextractor(rois_data, featuremaps, dst_ref.data(), p);
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtROIFeatureExtractorTests, TestsROIFeatureExtractor) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsROIFeatureExtractor, MKLDNNCPUExtROIFeatureExtractorTests,
+        ::testing::Values(
+                roifeatureextractor_test_params{ 20, 16, {{40, 48}, {20, 24}, {10, 12}, {5, 6}}, {4, 8, 16, 32}, 7, 2, false, 0 },
+                roifeatureextractor_test_params{ 13, 24, {{32, 32}, {16, 16}}, {4, 8}, 5, 0, false, 0 },
+                roifeatureextractor_test_params{ 7, 3, {{25, 30}, {13, 15}, {7, 8}}, {4, 8, 16}, 4, 2, false, 0 },
+                roifeatureextractor_test_params{ 20, 16, {{40, 48}, {20, 24}, {10, 12}, {5, 6}}, {4, 8, 16, 32}, 7, 2, true, 0 },
+                roifeatureextractor_test_params{ 13, 3, {{25, 30}, {13, 15}}, {4, 8}, 4, 0, true, 0 }));
+
+// Mask R-CNN FPN configuration: 1000 proposals from 800x1344 image pooled from 256-channel feature maps
+INSTANTIATE_TEST_CASE_P(
+        DISABLED_BenchmarkROIFeatureExtractor, MKLDNNCPUExtROIFeatureExtractorTests,
+        ::testing::Values(
+                roifeatureextractor_test_params{ 1000, 256, {{200, 336}, {100, 168}, {50, 84}, {25, 42}}, {4, 8, 16, 32}, 7, 2, false, 20 },
+                roifeatureextractor_test_params{ 1000, 256, {{200, 336}, {100, 168}, {50, 84}, {25, 42}}, {4, 8, 16, 32}, 14, 2, false, 20 }));
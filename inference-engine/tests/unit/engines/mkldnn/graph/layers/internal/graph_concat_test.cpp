@@ -13,6 +13,10 @@
 #include <unordered_set>
 #include <cnn_network_impl.hpp>
 #include "tests_common.hpp"
+#include "mkldnn_exec_network.h"
+#include <details/ie_cnn_network_tools.h>
+#include <xml_net_builder.hpp>
+#include <numeric>
 
 using namespace ::testing;
 using namespace std;
@@ -1024,6 +1028,351 @@ protected:
 
 TEST_F(MKLDNNGraphTwoInputInConcatTests, TestSecondInputToConcat) {}
 
+struct channels_last_concat_test_params {
+    // Formats: NCHW
+    vector<size_t> in1;
+    vector<size_t> in2;
+
+    // Inputs of the concatenation are produced by reference eltwise nodes instead of network inputs
+    bool eltwiseProducers;
+
+    bool inPlace;
+};
+
+class MKLDNNGraphChannelsLastConcatTests: public TestsCommon,
+                                          public WithParamInterface<channels_last_concat_test_params> {
+    std::string model_t = R"V0G0N(
+<net name="ConcatOnly" version="3" precision="I8" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="I8" id="1">
+            <output>
+                <port id="1">__SRC_DIMS_1__
+                </port>
+            </output>
+        </layer>
+        <layer name="in2" type="Input" precision="I8" id="2">
+            <output>
+                <port id="2">__SRC_DIMS_2__
+                </port>
+            </output>
+        </layer>
+        <layer name="con" id="3" type="Concat" precision="I8">
+            <concat_data axis="1"/>
+            <input>
+                <port id="1">__SRC_DIMS_1__
+                </port>
+                <port id="2">__SRC_DIMS_2__
+                </port>
+            </input>
+            <output>
+                <port id="3">__DST_DIMS__
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string model_eltwise_t = R"V0G0N(
+<net name="EltwiseConcat" version="3" precision="I8" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="I8" id="1">
+            <output>
+                <port id="1">__SRC_DIMS_1__
+                </port>
+            </output>
+        </layer>
+        <layer name="in2" type="Input" precision="I8" id="2">
+            <output>
+                <port id="2">__SRC_DIMS_2__
+                </port>
+            </output>
+        </layer>
+        <layer name="in3" type="Input" precision="I8" id="3">
+            <output>
+                <port id="3">__SRC_DIMS_1__
+                </port>
+            </output>
+        </layer>
+        <layer name="in4" type="Input" precision="I8" id="4">
+            <output>
+                <port id="4">__SRC_DIMS_2__
+                </port>
+            </output>
+        </layer>
+        <layer name="sum1" id="5" type="Eltwise" precision="I8">
+            <data operation="sum"/>
+            <input>
+                <port id="1">__SRC_DIMS_1__
+                </port>
+                <port id="2">__SRC_DIMS_1__
+                </port>
+            </input>
+            <output>
+                <port id="3">__SRC_DIMS_1__
+                </port>
+            </output>
+        </layer>
+        <layer name="sum2" id="6" type="Eltwise" precision="I8">
+            <data operation="sum"/>
+            <input>
+                <port id="1">__SRC_DIMS_2__
+                </port>
+                <port id="2">__SRC_DIMS_2__
+                </port>
+            </input>
+            <output>
+                <port id="3">__SRC_DIMS_2__
+                </port>
+            </output>
+        </layer>
+        <layer name="con" id="7" type="Concat" precision="I8">
+            <concat_data axis="1"/>
+            <input>
+                <port id="1">__SRC_DIMS_1__
+                </port>
+                <port id="2">__SRC_DIMS_2__
+                </port>
+            </input>
+            <output>
+                <port id="3">__DST_DIMS__
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="5" to-port="1"/>
+        <edge from-layer="3" from-port="3" to-layer="5" to-port="2"/>
+        <edge from-layer="2" from-port="2" to-layer="6" to-port="1"/>
+        <edge from-layer="4" from-port="4" to-layer="6" to-port="2"/>
+        <edge from-layer="5" from-port="3" to-layer="7" to-port="1"/>
+        <edge from-layer="6" from-port="3" to-layer="7" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string getModel(channels_last_concat_test_params p) {
+        std::string model = p.eltwiseProducers ? model_eltwise_t : model_t;
+        std::string s_dims;
+        for (auto& dim : p.in1) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        REPLACE_WITH_STR(model, "__SRC_DIMS_1__", s_dims);
+
+        s_dims = "";
+        for (auto& dim : p.in2) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        REPLACE_WITH_STR(model, "__SRC_DIMS_2__", s_dims);
+
+        s_dims = "";
+        for (size_t i = 0; i < p.in1.size(); i++) {
+            size_t dim = i == 1 ? p.in1[i] + p.in2[i] : p.in1[i];
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        REPLACE_WITH_STR(model, "__DST_DIMS__", s_dims);
+        return model;
+    }
+
+    InferenceEngine::TBlob<int8_t>::Ptr makeInput(const vector<size_t>& dims, int seed) {
+        InferenceEngine::TBlob<int8_t>::Ptr blob = InferenceEngine::make_shared_blob<int8_t>({InferenceEngine::Precision::I8, dims, InferenceEngine::NCHW});
+        blob->allocate();
+        for (size_t i = 0; i < blob->size(); i++)
+            blob->data()[i] = static_cast<int8_t>(static_cast<int>((i * 7 + seed) % 41) - 20);
+        return blob;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            channels_last_concat_test_params p = ::testing::WithParamInterface<channels_last_concat_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            bool found = false;
+            for (auto& node : graph.getNodes()) {
+                if (node->getType() == MKLDNNPlugin::Concatenation) {
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(p.inPlace, node->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].inPlace >= 0);
+                    found = true;
+                }
+            }
+            ASSERT_TRUE(found);
+
+            std::vector<InferenceEngine::TBlob<int8_t>::Ptr> srcs = {makeInput(p.in1, 0), makeInput(p.in2, 3)};
+            InferenceEngine::BlobMap inputs;
+            inputs["in1"] = srcs[0];
+            inputs["in2"] = srcs[1];
+            if (p.eltwiseProducers) {
+                srcs.push_back(makeInput(p.in1, 5));
+                srcs.push_back(makeInput(p.in2, 11));
+                inputs["in3"] = srcs[2];
+                inputs["in4"] = srcs[3];
+            }
+
+            InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<int8_t>::Ptr output = InferenceEngine::make_shared_blob<int8_t>(item.second->getTensorDesc());
+            output->allocate();
+            InferenceEngine::BlobMap outputBlobs;
+            outputBlobs[item.first] = output;
+
+            graph.Infer(inputs, outputBlobs);
+
+            // The copying concatenation of the same inputs is the reference
+            size_t N = p.in1[0], C1 = p.in1[1], C2 = p.in2[1], HW = p.in1[2] * p.in1[3];
+            const int8_t *dst = output->readOnly();
+            for (size_t n = 0; n < N; n++) {
+                for (size_t c = 0; c < C1 + C2; c++) {
+                    for (size_t hw = 0; hw < HW; hw++) {
+                        int ref = c < C1 ? srcs[0]->readOnly()[(n * C1 + c) * HW + hw]
+                                         : srcs[1]->readOnly()[(n * C2 + c - C1) * HW + hw];
+                        if (p.eltwiseProducers) {
+                            ref += c < C1 ? srcs[2]->readOnly()[(n * C1 + c) * HW + hw]
+                                          : srcs[3]->readOnly()[(n * C2 + c - C1) * HW + hw];
+                        }
+                        size_t idx = (n * (C1 + C2) + c) * HW + hw;
+                        ASSERT_EQ(ref, dst[idx]) << "concat index: " << idx;
+                    }
+                }
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphChannelsLastConcatTests, TestsChannelsLastConcat) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsChannelsLastConcat, MKLDNNGraphChannelsLastConcatTests,
+        ::testing::Values(
+                channels_last_concat_test_params{{1, 3, 4, 5}, {1, 5, 4, 5}, false, true},
+                channels_last_concat_test_params{{2, 16, 3, 3}, {2, 8, 3, 3}, false, true},
+                channels_last_concat_test_params{{1, 3, 1, 1}, {1, 5, 1, 1}, false, true},
+                channels_last_concat_test_params{{1, 3, 4, 5}, {1, 5, 4, 5}, true, true},
+                channels_last_concat_test_params{{2, 16, 3, 3}, {2, 8, 3, 3}, true, true}
+        ));
+
+class MKLDNNGraphConvChannelsLastConcatTests: public TestsCommon {
+protected:
+    const std::vector<size_t> inDims = {1, 8, 6, 6};
+    const conv_common_params conv = { {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1}, "", 1, 16, true, true, "I8" };
+
+    // Input -> two int8 Convolution + ReLU branches, concatenated over channels if withConcat
+    std::string getModel(bool withConcat) {
+        std::vector<size_t> convOutDims(inDims.size());
+        getConvOutShape(inDims, conv, convOutDims);
+        std::vector<size_t> concatOutDims = convOutDims;
+        concatOutDims[1] *= 2;
+
+        Statistic in_stat, conv_stat, concat_stat;
+        fillStatistic(in_stat, inDims[1], -2.f, 2.f);
+        fillStatistic(conv_stat, conv.out_c, 0.f, 2.f);
+        fillStatistic(concat_stat, concatOutDims[1], 0.f, 2.f);
+
+        std::map<std::string, std::string> relu_params = {};
+        std::map<std::string, std::string> concat_params = {{"axis", "1"}};
+        std::vector<std::pair<std::string, std::string>> edges = {
+                {"0,0", "1,1"}, {"0,0", "2,3"}, {"1,2", "3,5"}, {"2,4", "4,7"} };
+        auto builder = testing::DefaultNetBuilder::buildNetworkWithOneInput("ConvConcat", inDims, "FP32", in_stat)
+                .convolutionLayer("FP32", {{inDims}, {convOutDims}}, conv, conv_stat)
+                .convolutionLayer("FP32", {{inDims}, {convOutDims}}, conv, conv_stat)
+                .addLayer("ReLU", "FP32", &relu_params, {{convOutDims}, {convOutDims}}, 0, 0, "data", "", conv_stat)
+                .addLayer("ReLU", "FP32", &relu_params, {{convOutDims}, {convOutDims}}, 0, 0, "data", "", conv_stat);
+        if (withConcat) {
+            builder.addLayer("Concat", "FP32", &concat_params, {{convOutDims, convOutDims}, {concatOutDims}},
+                             0, 0, "data", "", concat_stat);
+            edges.push_back({"3,6", "5,9"});
+            edges.push_back({"4,8", "5,10"});
+        }
+        return builder.finish(&edges);
+    }
+
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr loadNetwork(const std::string& model,
+                                                     const InferenceEngine::TBlob<uint8_t>::Ptr& weights) {
+        InferenceEngine::CNNNetReader net_reader;
+        net_reader.ReadNetwork(model.data(), model.length());
+        net_reader.SetWeights(weights);
+
+        MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), {}, {}));
+        execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+        execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+        return execNetwork;
+    }
+
+    InferenceEngine::BlobMap infer(const MKLDNNPlugin::MKLDNNExecNetwork::Ptr& execNetwork,
+                                   const InferenceEngine::Blob::Ptr& src, const std::vector<std::string>& outputs) {
+        InferenceEngine::IInferRequest::Ptr inferRequest;
+        execNetwork->CreateInferRequest(inferRequest);
+
+        InferenceEngine::ResponseDesc resp;
+        EXPECT_EQ(InferenceEngine::OK, inferRequest->SetBlob("Input0", src, &resp)) << resp.msg;
+        EXPECT_EQ(InferenceEngine::OK, inferRequest->Infer(&resp)) << resp.msg;
+
+        InferenceEngine::BlobMap outputBlobs;
+        for (auto& name : outputs) {
+            EXPECT_EQ(InferenceEngine::OK, inferRequest->GetBlob(name.c_str(), outputBlobs[name], &resp)) << resp.msg;
+        }
+        return outputBlobs;
+    }
+};
+
+TEST_F(MKLDNNGraphConvChannelsLastConcatTests, TestConvProducersAreConcatenatedInPlace) {
+    size_t weightsSize = 2 * (getConvWeightsSize(inDims, conv, "FP32") + getConvBiasesSize(conv, "FP32"));
+    auto weights = getWeightsBlob(weightsSize, "FP32");
+
+    auto concatNetwork = loadNetwork(getModel(true), weights);
+    auto branchesNetwork = loadNetwork(getModel(false), weights);
+
+    // The convolutions write straight into the concatenation output, no input is copied
+    InferenceEngine::ICNNNetwork::Ptr execGraph;
+    concatNetwork->GetExecGraphInfo(execGraph);
+    std::vector<size_t> convOutDims(inDims.size());
+    getConvOutShape(inDims, conv, convOutDims);
+    size_t branchSize = std::accumulate(convOutDims.begin(), convOutDims.end(), 1lu, std::multiplies<size_t>());
+    bool found = false;
+    for (auto& layer : InferenceEngine::details::CNNNetSortTopologically(*execGraph)) {
+        auto savedBytes = layer->params.find("inPlaceSavedBytes");
+        if (savedBytes != layer->params.end()) {
+            ASSERT_EQ(std::to_string(2 * branchSize), savedBytes->second);
+            found = true;
+        }
+    }
+    ASSERT_TRUE(found);
+
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, inDims,
+                                                                               InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    auto concatOut = infer(concatNetwork, src, {"Concat5"});
+    auto branchesOut = infer(branchesNetwork, src, {"ReLU3", "ReLU4"});
+    ASSERT_EQ(2 * branchSize, concatOut["Concat5"]->size());
+
+    // Both branches share the quantization scales, so they differ by a quantization step at most
+    const float *dst = concatOut["Concat5"]->cbuffer().as<const float *>();
+    compare(dst, branchesOut["ReLU3"]->cbuffer().as<const float *>(), branchSize, 0.02f);
+    compare(dst + branchSize, branchesOut["ReLU4"]->cbuffer().as<const float *>(), branchSize, 0.02f);
+}
+
 class MKLDNNGraphIncorrectConcatTests: public TestsCommon,
                               public WithParamInterface<concat_test_params> {
     std::string model_t = R"V0G0N(
@@ -382,7 +382,11 @@ INSTANTIATE_TEST_CASE_P(
                 gemm_test_params{{5, 1, 5, 1, 5, 3, 5, 3}, 7, 4, 3, 2, 3, true, false, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
                 gemm_test_params{{1, 1, 5, 3, 5, 3, 5, 3}, 7, 4, 3, 2, 3, false, false, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
                 gemm_test_params{{1, 1, 1, 1, 5, 3, 5, 3}, 7, 4, 3, 2, 3, true, true, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
-                gemm_test_params{{5, 4, 1, 1, 1, 1, 5, 4}, 7, 4, 3, 2, 3, false, false, 1, MKLDNNPlugin::impl_desc_type::gemm_any}
+                gemm_test_params{{5, 4, 1, 1, 1, 1, 5, 4}, 7, 4, 3, 2, 3, false, false, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
+                // Few large matrices: rows of the output are split between threads
+                gemm_test_params{{1, 1, 1, 1, 1, 1, 1, 1}, 130, 17, 33, 2, 3, false, false, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
+                gemm_test_params{{1, 2, 1, 2, 1, 2, 1, 2}, 101, 9, 12, 2, 3, true, false, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
+                gemm_test_params{{1, 1, 1, 2, 1, 1, 1, 2}, 70, 5, 9, 2, 3, true, true, 1, MKLDNNPlugin::impl_desc_type::gemm_any}
         ));
 
 class MKLDNNGraphDynBatchGemmTests: public MKLDNNGraphGemmTests {
@@ -660,3 +664,207 @@ INSTANTIATE_TEST_CASE_P(
                 gemm_test_params{{1, 3, 1, 3, 1, 1, 1, 3}, 7, 4, 3, 2, 3, true, true, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
                 gemm_test_params{{1, 3, 1, 1, 1, 1, 1, 3}, 7, 4, 3, 2, 3, true, true, 1, MKLDNNPlugin::impl_desc_type::gemm_any}
         ));
+
+void ref_gemm_u8s8(const InferenceEngine::TBlob<uint8_t> &src0, const InferenceEngine::TBlob<int8_t> &src1,
+                   InferenceEngine::TBlob<float> &dst, gemm_test_params prm) {
+    const uint8_t *a_data = src0.readOnly();
+    const int8_t *b_data = src1.readOnly();
+    float *d_data = dst.data();
+
+    size_t MB = prm.batches.MB2_D;
+    size_t M  = prm.M;
+    size_t N  = prm.N;
+    size_t K  = prm.K;
+
+    for (size_t mb = 0; mb < MB; mb++) {
+        for (size_t i = 0; i < M; i++) {
+            for (size_t j = 0; j < N; j++) {
+                int32_t acc = 0;
+                for (size_t k = 0; k < K; k++) {
+                    size_t src0_off = prm.transposeA ? k * M + i : i * K + k;
+                    size_t src1_off = prm.transposeB ? j * K + k : k * N + j;
+                    acc += static_cast<int32_t>(a_data[src0_off]) * static_cast<int32_t>(b_data[src1_off]);
+                }
+                d_data[i * N + j] = prm.alpha * static_cast<float>(acc);
+            }
+        }
+        a_data += prm.batches.MB2_A == MB ? M*K : 0;
+        b_data += prm.batches.MB2_B == MB ? K*N : 0;
+        d_data += M*N;
+    }
+}
+
+class MKLDNNGraphInt8GemmTests: public TestsCommon,
+                                public WithParamInterface<gemm_test_params> {
+    std::string model_t = R"V0G0N(
+<net name="gemmOnly" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="U8" id="1">
+            <output>
+                <port id="1">
+                    <dim>_MB_A_</dim>
+                    <dim>_M_A_</dim>
+                    <dim>_N_A_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in2" type="Input" precision="I8" id="2">
+            <output>
+                <port id="1">
+                    <dim>_MB_B_</dim>
+                    <dim>_M_B_</dim>
+                    <dim>_N_B_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="gemm" id="3" type="GEMM" precision="FP32">
+            <data alpha="_A_" beta="_B_" transpose_a="_TA_" transpose_b="_TB_"/>
+            <input>
+                <port id="1">
+                    <dim>_MB_A_</dim>
+                    <dim>_M_A_</dim>
+                    <dim>_N_A_</dim>
+                </port>
+                <port id="2">
+                    <dim>_MB_B_</dim>
+                    <dim>_M_B_</dim>
+                    <dim>_N_B_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_MB_D_</dim>
+                    <dim>_M_</dim>
+                    <dim>_N_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="1" to-layer="3" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+protected:
+    std::string getModel(gemm_test_params p) {
+        std::string model = model_t;
+
+        REPLACE_WITH_NUM(model, "_MB_A_", p.batches.MB2_A);
+        REPLACE_WITH_NUM(model, "_MB_B_", p.batches.MB2_B);
+        REPLACE_WITH_NUM(model, "_MB_D_", p.batches.MB2_D);
+
+        auto m_A = p.transposeA ? p.K : p.M;
+        auto n_A = p.transposeA ? p.M : p.K;
+        auto m_B = p.transposeB ? p.N : p.K;
+        auto n_B = p.transposeB ? p.K : p.N;
+
+        REPLACE_WITH_NUM(model, "_M_A_", m_A);
+        REPLACE_WITH_NUM(model, "_N_A_", n_A);
+        REPLACE_WITH_NUM(model, "_M_B_", m_B);
+        REPLACE_WITH_NUM(model, "_N_B_", n_B);
+
+        REPLACE_WITH_NUM(model, "_M_", p.M);
+        REPLACE_WITH_NUM(model, "_N_", p.N);
+
+        REPLACE_WITH_NUM(model, "_A_", p.alpha);
+        REPLACE_WITH_NUM(model, "_B_", p.beta);
+        REPLACE_WITH_NUM(model, "_TA_", p.transposeA);
+        REPLACE_WITH_NUM(model, "_TB_", p.transposeB);
+
+        return model;
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            gemm_test_params p = ::testing::WithParamInterface<gemm_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            auto& nodes = graph.getNodes();
+            for (int i = 0; i < nodes.size(); i++) {
+                if (nodes[i]->getType() == MKLDNNPlugin::Gemm) {
+                    ASSERT_EQ(p.num_prim_desc, nodes[i]->getSupportedPrimitiveDescriptors().size());
+                    ASSERT_NE(nullptr, nodes[i]->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(p.selectedType, nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType());
+                    auto& config = nodes[i]->getSelectedPrimitiveDescriptor()->getConfig();
+                    ASSERT_EQ(InferenceEngine::Precision::U8, config.inConfs.at(0).desc.getPrecision());
+                    ASSERT_EQ(InferenceEngine::Precision::I8, config.inConfs.at(1).desc.getPrecision());
+                    ASSERT_EQ(InferenceEngine::Precision::FP32, config.outConfs.at(0).desc.getPrecision());
+                }
+            }
+
+            auto m_A = p.transposeA ? p.K : p.M;
+            auto n_A = p.transposeA ? p.M : p.K;
+            auto m_B = p.transposeB ? p.N : p.K;
+            auto n_B = p.transposeB ? p.K : p.N;
+
+            InferenceEngine::SizeVector dims_src1 = {p.batches.MB2_A, m_A, n_A};
+            InferenceEngine::SizeVector dims_src2 = {p.batches.MB2_B, m_B, n_B};
+
+            // Values are kept small enough not to saturate 16-bit intermediate sums of u8s8 kernels
+            InferenceEngine::TBlob<uint8_t>::Ptr src1 = InferenceEngine::make_shared_blob<uint8_t>({InferenceEngine::Precision::U8, dims_src1, InferenceEngine::CHW});
+            src1->allocate();
+            for (size_t i = 0; i < src1->size(); i++)
+                src1->data()[i] = static_cast<uint8_t>((i * 7) % 100);
+
+            InferenceEngine::TBlob<int8_t>::Ptr src2 = InferenceEngine::make_shared_blob<int8_t>({InferenceEngine::Precision::I8, dims_src2, InferenceEngine::CHW});
+            src2->allocate();
+            for (size_t i = 0; i < src2->size(); i++)
+                src2->data()[i] = static_cast<int8_t>(static_cast<int>((i * 5) % 61) - 30);
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src1));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in2", src2));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+
+            ref_gemm_u8s8(*src1, *src2, dst_ref, p);
+
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphInt8GemmTests, TestsInt8Gemm) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsInt8Gemm, MKLDNNGraphInt8GemmTests,
+        ::testing::Values(
+                gemm_test_params{{1, 1, 1, 1, 1, 1, 1, 1}, 7, 4, 3, 1, 0, false, false, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
+                gemm_test_params{{1, 3, 1, 3, 1, 1, 1, 3}, 7, 4, 3, 2, 0, false, false, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
+                gemm_test_params{{1, 3, 1, 1, 1, 1, 1, 3}, 7, 4, 3, 2, 0, false, false, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
+                gemm_test_params{{1, 3, 1, 3, 1, 1, 1, 3}, 7, 4, 3, 2, 0, true, false, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
+                gemm_test_params{{1, 3, 1, 3, 1, 1, 1, 3}, 7, 4, 3, 2, 0, false, true, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
+                gemm_test_params{{1, 3, 1, 3, 1, 1, 1, 3}, 7, 4, 3, 2, 0, true, true, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
+                gemm_test_params{{1, 2, 1, 2, 1, 1, 1, 2}, 16, 10, 33, 0.5f, 0, false, false, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
+                // Few large matrices: rows of the output are split between threads
+                gemm_test_params{{1, 1, 1, 1, 1, 1, 1, 1}, 130, 17, 33, 1, 0, false, false, 1, MKLDNNPlugin::impl_desc_type::gemm_any},
+                gemm_test_params{{1, 1, 1, 1, 1, 1, 1, 1}, 101, 9, 12, 1, 0, true, false, 1, MKLDNNPlugin::impl_desc_type::gemm_any}
+        ));
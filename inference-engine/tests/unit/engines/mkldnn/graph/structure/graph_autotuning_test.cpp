@@ -0,0 +1,167 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "mkldnn_graph.h"
+#include "mkldnn_autotuner.h"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_extension_mngr.h>
+#include "tests_common.hpp"
+#include "../test_graph.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+class MKLDNNGraphAutoTuningTests: public TestsCommon {
+protected:
+    std::string model = R"V0G0N(
+<net name="AutoTuning" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>7</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="16" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>7</dim>
+                    <dim>7</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>7</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+            <weights offset="0" size="1024"/>
+            <biases offset="1024" size="64"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string cacheFile = "mkldnn_autotuning_test_cache.txt";
+
+    void TearDown() override {
+        std::remove(cacheFile.c_str());
+    }
+
+    void readNetwork(InferenceEngine::CNNNetReader &net_reader) {
+        ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+        InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {1088}, InferenceEngine::C });
+        weights->allocate();
+        fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+        net_reader.SetWeights(InferenceEngine::TBlob<uint8_t>::Ptr(weights));
+    }
+};
+
+TEST_F(MKLDNNGraphAutoTuningTests, TestTunedChoicesAreCachedAndApplied) {
+    InferenceEngine::CNNNetReader net_reader;
+    readNetwork(net_reader);
+    auto extensionManager = std::make_shared<MKLDNNPlugin::MKLDNNExtensionManager>();
+
+    MKLDNNPlugin::Config config;
+    config.autoTuning = true;
+    config.tuningCacheFile = cacheFile;
+
+    std::map<std::string, MKLDNNPlugin::MKLDNNTunedChoice> tuned;
+    ASSERT_NO_THROW(tuned = MKLDNNPlugin::MKLDNNAutoTuner(config, extensionManager).Tune(net_reader.getNetwork()));
+    ASSERT_NE(tuned.end(), tuned.find("conv1"));
+
+    std::ifstream file(cacheFile);
+    ASSERT_TRUE(file.is_open());
+    std::stringstream content;
+    content << file.rdbuf();
+    ASSERT_NE(std::string::npos, content.str().find("AutoTuning/conv1:FP32_1x16x7x7\t"));
+
+    // Cached choice is reused without benchmarking
+    config.autoTuning = false;
+    std::map<std::string, MKLDNNPlugin::MKLDNNTunedChoice> cached;
+    ASSERT_NO_THROW(cached = MKLDNNPlugin::MKLDNNAutoTuner(config, extensionManager).Tune(net_reader.getNetwork()));
+    ASSERT_NE(cached.end(), cached.find("conv1"));
+    ASSERT_EQ(tuned["conv1"].index, cached["conv1"].index);
+    ASSERT_EQ(tuned["conv1"].tunedImpl, cached["conv1"].tunedImpl);
+
+    MKLDNNGraphTestClass graph;
+    graph.setTunedChoices(cached);
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    bool found = false;
+    for (auto &node : graph.getNodes()) {
+        if (node->getName() != "conv1")
+            continue;
+        found = true;
+        auto &supportedPrimitiveDescriptors = node->getSupportedPrimitiveDescriptors();
+        ASSERT_EQ(&supportedPrimitiveDescriptors[cached["conv1"].index], node->getSelectedPrimitiveDescriptor());
+    }
+    ASSERT_TRUE(found);
+}
+
+TEST_F(MKLDNNGraphAutoTuningTests, TestNoChoicesWithoutCache) {
+    InferenceEngine::CNNNetReader net_reader;
+    readNetwork(net_reader);
+
+    MKLDNNPlugin::Config config;
+    config.tuningCacheFile = cacheFile;
+
+    std::map<std::string, MKLDNNPlugin::MKLDNNTunedChoice> cached;
+    ASSERT_NO_THROW(cached = MKLDNNPlugin::MKLDNNAutoTuner(config, std::make_shared<MKLDNNPlugin::MKLDNNExtensionManager>())
+            .Tune(net_reader.getNetwork()));
+    ASSERT_TRUE(cached.empty());
+}
+
+TEST_F(MKLDNNGraphAutoTuningTests, TestUnparsableCacheIsIgnored) {
+    InferenceEngine::CNNNetReader net_reader;
+    readNetwork(net_reader);
+
+    {
+        std::ofstream file(cacheFile);
+        file << "AutoTuning/conv1:FP32_1x16x7x7\t0\t1\tjit\tjit\t1.0\t1.0\n";
+        file << "AutoTuning/data\tnot_an_index\n";
+    }
+
+    MKLDNNPlugin::Config config;
+    config.tuningCacheFile = cacheFile;
+
+    std::map<std::string, MKLDNNPlugin::MKLDNNTunedChoice> cached;
+    ASSERT_NO_THROW(cached = MKLDNNPlugin::MKLDNNAutoTuner(config, std::make_shared<MKLDNNPlugin::MKLDNNExtensionManager>())
+            .Tune(net_reader.getNetwork()));
+    ASSERT_TRUE(cached.empty());
+
+    // The broken file is replaced once the network is tuned
+    config.autoTuning = true;
+    std::map<std::string, MKLDNNPlugin::MKLDNNTunedChoice> tuned;
+    ASSERT_NO_THROW(tuned = MKLDNNPlugin::MKLDNNAutoTuner(config, std::make_shared<MKLDNNPlugin::MKLDNNExtensionManager>())
+            .Tune(net_reader.getNetwork()));
+    ASSERT_NE(tuned.end(), tuned.find("conv1"));
+
+    std::ifstream file(cacheFile);
+    ASSERT_TRUE(file.is_open());
+    std::stringstream content;
+    content << file.rdbuf();
+    ASSERT_EQ(std::string::npos, content.str().find("not_an_index"));
+}
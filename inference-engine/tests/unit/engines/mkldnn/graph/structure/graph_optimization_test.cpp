@@ -11,6 +11,7 @@
 #include <mkldnn_extension_mngr.h>
 #include "tests_common.hpp"
 #include "../test_graph.hpp"
+#include <nodes/mkldnn_reorder_node.h>
 
 
 using namespace ::testing;
@@ -438,3 +439,598 @@ TEST_F(MKLDNNGraphOptimizationTests, TestNoFuseCustomActivation) {
     }
     ASSERT_FALSE(fused);
 }
+
+TEST_F(MKLDNNGraphOptimizationTests, TestFusePostOpsChainIntoConvolution) {
+    std::string model = R"V0G0N(
+<net name="PostOpsChain" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="3" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+            <weights offset="0" size="36"/>
+            <biases offset="36" size="12"/>
+        </layer>
+        <layer name="scaleshift1" type="ScaleShift" precision="FP32" id="2">
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+            <weights offset="48" size="12"/>
+            <biases offset="60" size="12"/>
+        </layer>
+        <layer name="clamp1" type="Clamp" precision="FP32" id="3">
+            <data max="6" min="0"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power1" type="Power" precision="FP32" id="4">
+            <power_data power="1" scale="0.5" shift="1"/>
+            <input>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="8">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+        <edge from-layer="3" from-port="6" to-layer="4" to-port="7"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {72}, InferenceEngine::C });
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    auto& nodes = graph.getNodes();
+    for (auto &node : nodes) {
+        ASSERT_NE(MKLDNNPlugin::Depthwise, node->getType());
+        ASSERT_NE(MKLDNNPlugin::Activation, node->getType());
+        ASSERT_NE(MKLDNNPlugin::Power, node->getType());
+    }
+
+    auto& chains = graph.GetFusedChains();
+    ASSERT_EQ(1, chains.size());
+    ASSERT_EQ("conv1", chains[0].root);
+    ASSERT_EQ(std::vector<std::string>({"scaleshift1", "clamp1", "power1"}), chains[0].fused);
+    ASSERT_EQ(3 * 2 * 3 * 5 * 5 * sizeof(float), chains[0].savedBytes);
+
+    // The chain is reported by the execution graph
+    auto execGraph = graph.dump();
+    InferenceEngine::CNNLayerPtr execConv;
+    ASSERT_EQ(InferenceEngine::StatusCode::OK, execGraph->getLayerByName("conv1", execConv, nullptr));
+    ASSERT_EQ("scaleshift1,clamp1,power1", execConv->params["fusedPostOps"]);
+    ASSERT_EQ(std::to_string(chains[0].savedBytes), execConv->params["fusedSavedBytes"]);
+
+    // The convolution output consumed by the network output as well is not fused
+    InferenceEngine::CNNNetReader ref_net_reader;
+    ASSERT_NO_THROW(ref_net_reader.ReadNetwork(model.data(), model.length()));
+    ref_net_reader.SetWeights(weights_ptr);
+    InferenceEngine::CNNNetwork ref_network = ref_net_reader.getNetwork();
+    ref_network.addOutput("conv1");
+
+    MKLDNNGraphTestClass ref_graph;
+    ASSERT_NO_THROW(ref_graph.CreateGraph(ref_network));
+    ASSERT_TRUE(ref_graph.GetFusedChains().empty());
+
+    InferenceEngine::SizeVector dims_src = {1, 3, 5, 5};
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float>::Ptr ref_output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    ref_output->allocate();
+    InferenceEngine::BlobMap refOutputBlobs;
+    refOutputBlobs[item.first] = ref_output;
+    ref_graph.Infer(srcs, refOutputBlobs);
+
+    compare(*output, *ref_output);
+}
+
+TEST_F(MKLDNNGraphOptimizationTests, TestRemoveInversePermutes) {
+    std::string model = R"V0G0N(
+<net name="InversePermutes" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="to_nhwc" type="Permute" precision="FP32" id="1">
+            <data order="0,2,3,1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="to_nchw" type="Permute" precision="FP32" id="2">
+            <data order="0,3,1,2"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power1" type="Power" precision="FP32" id="3">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    auto& nodes = graph.getNodes();
+    for (auto &node : nodes) {
+        ASSERT_NE(MKLDNNPlugin::Permute, node->getType());
+    }
+    // Both permutes read and write 1x3x4x5 floats
+    ASSERT_EQ(2 * 2 * 60 * sizeof(float), graph.GetEliminatedBytes()["Permute"]);
+
+    InferenceEngine::SizeVector dims_src = {1, 3, 4, 5};
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+    dst_ref.allocate();
+    const float *src_data = src->cbuffer().as<const float *>();
+    float *ref_data = dst_ref.data();
+    for (size_t i = 0; i < src->size(); i++) {
+        ref_data[i] = 2 * src_data[i];
+    }
+
+    compare(*output, dst_ref);
+}
+
+TEST_F(MKLDNNGraphOptimizationTests, TestChannelsLastPermuteInPlace) {
+    std::string model = R"V0G0N(
+<net name="ChannelsLastPermute" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="to_nhwc" type="Permute" precision="FP32" id="1">
+            <data order="0,2,3,1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power1" type="Power" precision="FP32" id="2">
+            <power_data power="1" scale="1" shift="1"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    InferenceEngine::CNNNetwork network = net_reader.getNetwork();
+    // The input node keeps the data in channels last, so the permute only reinterprets the dimensions
+    network.getInputsInfo()["data"]->setLayout(InferenceEngine::NHWC);
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(network));
+
+    bool permuteFound = false;
+    for (auto &node : graph.getNodes()) {
+        if (node->getType() == MKLDNNPlugin::Permute) {
+            permuteFound = true;
+            ASSERT_TRUE(node->isInplace());
+        }
+    }
+    ASSERT_TRUE(permuteFound);
+
+    InferenceEngine::SizeVector dims_src = {1, 3, 4, 5};
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = network.getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+    dst_ref.allocate();
+    const float *src_data = src->cbuffer().as<const float *>();
+    float *ref_data = dst_ref.data();
+    const size_t C = dims_src[1], H = dims_src[2], W = dims_src[3];
+    for (size_t c = 0; c < C; c++) {
+        for (size_t h = 0; h < H; h++) {
+            for (size_t w = 0; w < W; w++) {
+                ref_data[(h * W + w) * C + c] = src_data[(c * H + h) * W + w] + 1;
+            }
+        }
+    }
+
+    compare(*output, dst_ref);
+}
+
+// Builds the graph as MKLDNNGraph::InitGraph does, but puts a pair of reorders through an intermediate layout on the
+// output of every input node before the implementation specific optimizations, as it happens when a node between
+// two inserted reorders is removed
+class MKLDNNGraphReorderPairTestClass: public MKLDNNGraphTestClass {
+public:
+    void CreateGraphWithReorderPairs(InferenceEngine::ICNNNetwork &network, InferenceEngine::Layout intermediate,
+                                     const InferenceEngine::Blob::Ptr &scales = nullptr) {
+        Replicate(network, std::make_shared<MKLDNNPlugin::MKLDNNExtensionManager>());
+        SortTopologically();
+        MKLDNNPlugin::MKLDNNGraphOptimizer optimizer;
+        optimizer.ApplyCommonGraphOptimizations(*this);
+        SortTopologically();
+
+        InitNodes();
+        for (auto &node : graphNodes) {
+            node->initOptimalPrimitiveDescriptor();
+        }
+        InitEdges();
+
+        for (auto &input : inputNodes) {
+            auto edge = input.second->getChildEdgeAt(0);
+            auto inDesc = edge->getDesc();
+            InferenceEngine::TensorDesc intermediateDesc(inDesc.getPrecision(), inDesc.getDims(), intermediate);
+            auto first = insertReorder(edge, inDesc, intermediateDesc);
+            auto second = insertReorder(first->getChildEdgeAt(0), intermediateDesc, inDesc);
+            second->_scales = scales;
+        }
+
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
+        SortTopologically();
+        CompleteGraph();
+        status = Ready;
+    }
+
+private:
+    MKLDNNPlugin::MKLDNNReorderNode *insertReorder(const MKLDNNPlugin::MKLDNNEdgePtr &edge,
+                                                   const InferenceEngine::TensorDesc &inDesc,
+                                                   const InferenceEngine::TensorDesc &outDesc) {
+        InferenceEngine::CNNLayerPtr layer(new InferenceEngine::CNNLayer({edge->getParent()->getName() + "_reorder",
+                                                                          "Reorder", inDesc.getPrecision()}));
+        auto reorder = std::make_shared<MKLDNNPlugin::MKLDNNReorderNode>(layer, getEngine(), 0);
+        reorder->setDescs(inDesc, outDesc);
+
+        auto iIndex = edge->getInputNum();
+        auto oIndex = edge->getOutputNum();
+        edge->drop();
+
+        MKLDNNPlugin::MKLDNNEdgePtr beforeNode(new MKLDNNPlugin::MKLDNNEdge(edge->getParent(), reorder, iIndex, 0));
+        MKLDNNPlugin::MKLDNNEdgePtr afterNode(new MKLDNNPlugin::MKLDNNEdge(reorder, edge->getChild(), 0, oIndex));
+        edge->getParent()->addEdge(beforeNode);
+        edge->getChild()->addEdge(afterNode);
+
+        reorder->getSupportedDescriptors();
+        reorder->initSupportedPrimitiveDescriptors();
+        reorder->selectOptimalPrimitiveDescriptor();
+
+        graphEdges.erase(std::find(graphEdges.begin(), graphEdges.end(), edge));
+        graphEdges.push_back(beforeNode);
+        graphEdges.push_back(afterNode);
+        graphNodes.push_back(reorder);
+        return reorder.get();
+    }
+};
+
+class MKLDNNGraphDropDoubleReordersTests: public TestsCommon {
+protected:
+    std::string model = R"V0G0N(
+<net name="DoubleReorder" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power1" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    void inferAndCompare(MKLDNNGraphTestClass &graph, InferenceEngine::CNNNetwork &network,
+                         const std::vector<float> &channelScales) {
+        InferenceEngine::SizeVector dims_src = {1, 3, 4, 5};
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+        src->allocate();
+        fill_data(src->buffer(), src->size());
+
+        InferenceEngine::BlobMap srcs;
+        srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+        InferenceEngine::OutputsDataMap out = network.getOutputsInfo();
+        std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        InferenceEngine::BlobMap outputBlobs;
+        outputBlobs[item.first] = output;
+        graph.Infer(srcs, outputBlobs);
+
+        InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+        dst_ref.allocate();
+        const float *src_data = src->cbuffer().as<const float *>();
+        float *ref_data = dst_ref.data();
+        const size_t spatial = dims_src[2] * dims_src[3];
+        for (size_t i = 0; i < src->size(); i++) {
+            ref_data[i] = 2 * src_data[i] * channelScales[i / spatial];
+        }
+
+        compare(*output, dst_ref);
+    }
+
+    size_t countReorders(MKLDNNGraphTestClass &graph) {
+        size_t reorders = 0;
+        for (auto &node : graph.getNodes()) {
+            if (node->getType() == MKLDNNPlugin::Reorder)
+                reorders++;
+        }
+        return reorders;
+    }
+};
+
+TEST_F(MKLDNNGraphDropDoubleReordersTests, TestCancelledReordersAreRemoved) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    InferenceEngine::CNNNetwork network = net_reader.getNetwork();
+
+    MKLDNNGraphTestClass ref_graph;
+    ASSERT_NO_THROW(ref_graph.CreateGraph(network));
+
+    MKLDNNGraphReorderPairTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraphWithReorderPairs(network, InferenceEngine::NHWC));
+    ASSERT_EQ(countReorders(ref_graph), countReorders(graph));
+    ASSERT_EQ(2 * 2 * 60 * sizeof(float), graph.GetEliminatedBytes()["Reorder"]);
+
+    inferAndCompare(graph, network, {1, 1, 1});
+}
+
+TEST_F(MKLDNNGraphDropDoubleReordersTests, TestScaledReordersAreMerged) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    InferenceEngine::CNNNetwork network = net_reader.getNetwork();
+
+    MKLDNNGraphTestClass ref_graph;
+    ASSERT_NO_THROW(ref_graph.CreateGraph(network));
+
+    std::vector<float> channelScales = {0.5f, 2.f, 3.f};
+    InferenceEngine::TBlob<float>::Ptr scales = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {channelScales.size()}, InferenceEngine::C});
+    scales->allocate();
+    std::copy(channelScales.begin(), channelScales.end(), scales->buffer().as<float *>());
+
+    MKLDNNGraphReorderPairTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraphWithReorderPairs(network, InferenceEngine::NHWC, scales));
+    ASSERT_EQ(countReorders(ref_graph) + 1, countReorders(graph));
+    ASSERT_EQ(2 * 60 * sizeof(float), graph.GetEliminatedBytes()["Reorder"]);
+
+    bool scaleReorderFound = false;
+    for (auto &node : graph.getNodes()) {
+        if (node->getName().find("_ScaleReorder_") != std::string::npos)
+            scaleReorderFound = true;
+    }
+    ASSERT_TRUE(scaleReorderFound);
+
+    inferAndCompare(graph, network, channelScales);
+}
@@ -9,6 +9,10 @@
 #include "tests_common.hpp"
 #include "../test_graph.hpp"
 #include <ie_ir_reader.hpp>
+#include <details/ie_cnn_network_tools.h>
+#include <mutex>
+#include <set>
+#include <thread>
 
 // to fix compilation in Debug mode
 IE_SUPPRESS_DEPRECATED_START
@@ -6819,3 +6823,379 @@ TEST_F(MKLDNNGraphStructureTests, TestConcatWithFourInputs) {
 
     IE_SUPPRESS_DEPRECATED_END
 }
+
+TEST_F(MKLDNNGraphStructureTests, TestNodesThreadsAreLimitedByStreamWidth) {
+    std::string model = R"V0G0N(
+<net name="NodesThreads" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="3" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+            <weights offset="0" size="36"/>
+            <biases offset="36" size="12"/>
+        </layer>
+        <layer name="softmax1" type="SoftMax" precision="FP32" id="2">
+            <data axis="1"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {48}, InferenceEngine::C });
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    net_reader.SetWeights(InferenceEngine::TBlob<uint8_t>::Ptr(weights));
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    const int streamThreads = parallel_get_max_threads();
+    for (auto &node : graph.getNodes()) {
+        ASSERT_LE(1, node->getThreadsNum());
+        ASSERT_GE(streamThreads, node->getThreadsNum());
+        if (node->getType() == MKLDNNPlugin::Convolution)
+            ASSERT_EQ(streamThreads, node->getThreadsNum());
+    }
+
+    auto execGraph = graph.dump();
+    auto layers = InferenceEngine::details::CNNNetSortTopologically(*execGraph);
+    for (auto &layer : layers) {
+        ASSERT_NE(layer->params.end(), layer->params.find("threads"));
+    }
+}
+
+class MKLDNNGraphNodesThreadsTestClass: public MKLDNNGraphTestClass {
+public:
+    void LimitNodesThreads(const std::function<int(const MKLDNNPlugin::MKLDNNNodePtr&)> &getThreads) {
+        for (auto &node : graphNodes)
+            node->setThreadsNum(getThreads(node));
+        CreateNodesArenas();
+    }
+
+    // Runs a parallel loop the way the node is executed, returns the concurrency it gets and the number of threads it takes
+    std::pair<int, size_t> RunAsNode(const MKLDNNPlugin::MKLDNNNodePtr &node, int iterations) {
+        int concurrency = 0;
+        std::set<std::thread::id> threads;
+        std::mutex threadsMutex;
+        ExecuteWithThreads(node->getThreadsNum(), [&] {
+            concurrency = parallel_get_max_threads();
+            InferenceEngine::parallel_for(iterations, [&](int) {
+                std::lock_guard<std::mutex> lock(threadsMutex);
+                threads.insert(std::this_thread::get_id());
+            });
+        });
+        return {concurrency, threads.size()};
+    }
+};
+
+TEST_F(MKLDNNGraphStructureTests, TestNodesRunWithTheirThreadsLimits) {
+    std::string model = R"V0G0N(
+<net name="NodesThreads" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>9</dim>
+                    <dim>9</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="16" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>9</dim>
+                    <dim>9</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>9</dim>
+                    <dim>9</dim>
+                </port>
+            </output>
+            <weights offset="0" size="1024"/>
+            <biases offset="1024" size="64"/>
+        </layer>
+        <layer name="pool1" type="Pooling" precision="FP32" id="2">
+            <pooling_data kernel-x="3" kernel-y="3" pad-x="0" pad-y="0" pool-method="max" stride-x="2" stride-y="2"/>
+            <input>
+                <port id="3">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>9</dim>
+                    <dim>9</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="softmax1" type="SoftMax" precision="FP32" id="3">
+            <data axis="1"/>
+            <input>
+                <port id="5">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>2</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {1088}, InferenceEngine::C });
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    net_reader.SetWeights(InferenceEngine::TBlob<uint8_t>::Ptr(weights));
+
+    const int streamThreads = parallel_get_max_threads();
+
+    // Single thread nodes are mixed with the nodes running in the narrower arenas and the full width ones
+    MKLDNNGraphNodesThreadsTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+    int nodeIndex = 0;
+    graph.LimitNodesThreads([&](const MKLDNNPlugin::MKLDNNNodePtr &node) {
+        const int limits[] = {1, 2, streamThreads};
+        return std::min(streamThreads, limits[nodeIndex++ % 3]);
+    });
+
+    auto execGraph = graph.dump();
+    std::map<std::string, std::string> reportedThreads;
+    for (auto &layer : InferenceEngine::details::CNNNetSortTopologically(*execGraph))
+        reportedThreads[layer->name] = layer->params["threads"];
+
+    for (auto &node : graph.getNodes()) {
+        auto run = graph.RunAsNode(node, 16 * streamThreads);
+        ASSERT_EQ(node->getThreadsNum(), run.first) << node->getName();
+        ASSERT_GE(static_cast<size_t>(node->getThreadsNum()), run.second) << node->getName();
+        ASSERT_EQ(std::to_string(run.first), reportedThreads[node->getName()]) << node->getName();
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestGraphCreatedFromSnapshotIsTheSame) {
+    std::string model = R"V0G0N(
+<net name="Snapshot" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>6</dim>
+                    <dim>6</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="8" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>6</dim>
+                    <dim>6</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>6</dim>
+                    <dim>6</dim>
+                </port>
+            </output>
+            <weights offset="0" size="256"/>
+            <biases offset="256" size="32"/>
+        </layer>
+        <layer name="relu1" type="ReLU" precision="FP32" id="2">
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>6</dim>
+                    <dim>6</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>6</dim>
+                    <dim>6</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="pool1" type="Pooling" precision="FP32" id="3">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="2" stride-y="2" pool-method="max"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>6</dim>
+                    <dim>6</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>3</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {288}, InferenceEngine::C });
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    net_reader.SetWeights(InferenceEngine::TBlob<uint8_t>::Ptr(weights));
+
+    MKLDNNPlugin::MKLDNNGraphSnapshot::CPtr snapshot;
+    MKLDNNGraphTestClass graph;
+    graph.setSnapshotHandler([&](const MKLDNNPlugin::MKLDNNGraphSnapshot::CPtr &s) { snapshot = s; });
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+    ASSERT_NE(nullptr, snapshot);
+
+    MKLDNNGraphTestClass copy;
+    ASSERT_NO_THROW(copy.MKLDNNGraph::CreateGraph(snapshot));
+
+    auto &nodes = graph.getNodes();
+    auto &copyNodes = copy.getNodes();
+    ASSERT_EQ(nodes.size(), copyNodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ASSERT_NE(nodes[i], copyNodes[i]);
+        ASSERT_EQ(nodes[i]->getName(), copyNodes[i]->getName());
+        ASSERT_EQ(nodes[i]->getType(), copyNodes[i]->getType());
+        ASSERT_EQ(nodes[i]->getFusedWith().size(), copyNodes[i]->getFusedWith().size());
+        ASSERT_EQ(nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType(),
+                  copyNodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType());
+        ASSERT_EQ(nodes[i]->getParentEdges().size(), copyNodes[i]->getParentEdges().size());
+        ASSERT_EQ(nodes[i]->getChildEdges().size(), copyNodes[i]->getChildEdges().size());
+    }
+
+    // Only the graph which is optimized has the optimization phases
+    auto hasPhase = [](const MKLDNNPlugin::MKLDNNGraph &g, const std::string &name) {
+        for (auto &phase : g.GetLoadPhases())
+            if (phase.name == name)
+                return true;
+        return false;
+    };
+    ASSERT_TRUE(hasPhase(graph, "GraphOptimizations"));
+    ASSERT_FALSE(hasPhase(copy, "GraphOptimizations"));
+    ASSERT_TRUE(hasPhase(copy, "CopyNodes"));
+    ASSERT_TRUE(hasPhase(copy, "CreatePrimitives"));
+
+    InferenceEngine::SizeVector dims_src = {1, 8, 6, 6};
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("data", src));
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float>::Ptr copyOutput = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    copyOutput->allocate();
+    InferenceEngine::BlobMap copyOutputBlobs;
+    copyOutputBlobs[item.first] = copyOutput;
+    copy.Infer(srcs, copyOutputBlobs);
+
+    compare(*output, *copyOutput);
+}
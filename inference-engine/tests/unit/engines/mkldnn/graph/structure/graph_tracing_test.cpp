@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "mkldnn_exec_network.h"
+
+#include "tests_common.hpp"
+#include <ie_plugin_config.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace ::testing;
+using namespace std;
+
+class MKLDNNGraphTracingTests: public TestsCommon {
+protected:
+    std::string tracedFile = "mkldnn_tracing_test_traced.json";
+    std::string otherFile = "mkldnn_tracing_test_other.json";
+
+    void TearDown() override {
+        std::remove(tracedFile.c_str());
+        std::remove(otherFile.c_str());
+    }
+
+    static std::string model(const std::string &layerName) {
+        return R"V0G0N(
+<net name="Tracing" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name=")V0G0N" + layerName + R"V0G0N(" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+    }
+
+    static MKLDNNPlugin::MKLDNNExecNetwork::Ptr load(InferenceEngine::CNNNetReader &net_reader,
+                                                     const std::string &layerName, const std::string &traceFile) {
+        auto xml = model(layerName);
+        net_reader.ReadNetwork(xml.data(), xml.length());
+        MKLDNNPlugin::Config config;
+        config.readProperties({{InferenceEngine::PluginConfigParams::KEY_TRACE_FILE, traceFile}});
+        MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(
+                new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), config, {}));
+        execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+        execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+        return execNetwork;
+    }
+
+    static void infer(const MKLDNNPlugin::MKLDNNExecNetwork::Ptr &execNetwork) {
+        InferenceEngine::IInferRequest::Ptr inferRequest;
+        execNetwork->CreateInferRequest(inferRequest);
+
+        InferenceEngine::ResponseDesc resp;
+        InferenceEngine::Blob::Ptr src;
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->GetBlob("data", src, &resp)) << resp.msg;
+        fill_data(src->buffer(), src->size());
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->Infer(&resp)) << resp.msg;
+    }
+
+    static std::string read(const std::string &file) {
+        std::ifstream in(file);
+        std::stringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+};
+
+TEST_F(MKLDNNGraphTracingTests, TestNetworksWriteOnlyTheirOwnTimeline) {
+    InferenceEngine::CNNNetReader tracedReader, otherReader, untracedReader;
+    auto traced = load(tracedReader, "traced_power", tracedFile);
+    auto other = load(otherReader, "other_power", otherFile);
+    auto untraced = load(untracedReader, "untraced_power", "");
+
+    ASSERT_NO_FATAL_FAILURE(infer(traced));
+    ASSERT_NO_FATAL_FAILURE(infer(other));
+    ASSERT_NO_FATAL_FAILURE(infer(untraced));
+
+    // The trace file is written when the network is destroyed
+    traced.reset();
+    auto trace = read(tracedFile);
+    ASSERT_EQ(0, trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"traced_power\",\"cat\":\"Node\""));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"Infer\",\"cat\":\"Pipeline\""));
+    ASSERT_EQ(std::string::npos, trace.find("other_power"));
+    ASSERT_EQ(std::string::npos, trace.find("untraced_power"));
+
+    // The events of the destroyed network are not written again
+    other.reset();
+    trace = read(otherFile);
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"other_power\",\"cat\":\"Node\""));
+    ASSERT_EQ(std::string::npos, trace.find("traced_power"));
+    ASSERT_EQ(std::string::npos, trace.find("untraced_power"));
+}
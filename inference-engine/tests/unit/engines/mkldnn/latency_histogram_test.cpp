@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "mkldnn_latency_histogram.h"
+#include "mkldnn_graph.h"
+
+#include "single_layer_common.hpp"
+#include "tests_common.hpp"
+#include "graph/test_graph.hpp"
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+
+TEST(MKLDNNLatencyHistogramTests, BucketsCoverValuesWithBoundedError) {
+    int previous = 0;
+    for (uint64_t value = 0; value < (1ull << 24); value += 1 + value / 64) {
+        int bucket = MKLDNNLatencyHistogram::getBucket(value);
+        ASSERT_GE(bucket, previous);
+        ASSERT_LT(bucket, MKLDNNLatencyHistogram::bucketsCount);
+        ASSERT_LT(value, MKLDNNLatencyHistogram::getUpperBound(bucket));
+        if (bucket > 0)
+            ASSERT_GE(value, MKLDNNLatencyHistogram::getUpperBound(bucket - 1));
+        ASSERT_LE(MKLDNNLatencyHistogram::getUpperBound(bucket), value + value / 8 + 1);
+        previous = bucket;
+    }
+    ASSERT_EQ(MKLDNNLatencyHistogram::bucketsCount - 1, MKLDNNLatencyHistogram::getBucket(UINT64_MAX));
+}
+
+TEST(MKLDNNLatencyHistogramTests, PercentilesOfRecordedSamples) {
+    MKLDNNLatencyHistogram histogram;
+    MKLDNNLatencyHistogram::Counts counts;
+    histogram.accumulate(counts);
+    ASSERT_EQ(0, MKLDNNLatencyHistogram::getPercentile(counts, 50));
+
+    for (int i = 0; i < 99; i++)
+        histogram.record(1000);
+    histogram.record(1000000);
+
+    counts.clear();
+    histogram.accumulate(counts);
+    ASSERT_EQ(MKLDNNLatencyHistogram::getUpperBound(MKLDNNLatencyHistogram::getBucket(1000)),
+              MKLDNNLatencyHistogram::getPercentile(counts, 99));
+    ASSERT_EQ(MKLDNNLatencyHistogram::getUpperBound(MKLDNNLatencyHistogram::getBucket(1000000)),
+              MKLDNNLatencyHistogram::getPercentile(counts, 99.9));
+
+    // Histograms of the streams are summed
+    histogram.accumulate(counts);
+    ASSERT_EQ(2, counts[MKLDNNLatencyHistogram::getBucket(1000000)]);
+}
+
+TEST(MKLDNNLatencyHistogramTests, GraphSamplesEveryNthInference) {
+    std::string model = R"V0G0N(
+<net name="Histograms" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="1">
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_LATENCY_SAMPLING_PERIOD, "3"}});
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    for (int i = 0; i < 7; i++)
+        graph.MKLDNNGraph::Infer();
+
+    std::map<std::string, MKLDNNLatencyHistogram::Counts> histograms;
+    graph.GetLatencyHistograms(histograms);
+    ASSERT_NE(histograms.end(), histograms.find("relu"));
+    uint64_t samples = 0;
+    for (auto count : histograms["relu"])
+        samples += count;
+    // Inferences 0, 3 and 6
+    ASSERT_EQ(3, samples);
+}
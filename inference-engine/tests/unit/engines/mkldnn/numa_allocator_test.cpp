@@ -0,0 +1,214 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "mkldnn_numa_allocator.h"
+#include "mkldnn_memory.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+TEST(MKLDNNNumaAllocatorTests, DisabledModeUsesDefaultAllocator) {
+    ASSERT_EQ(nullptr, CreateGraphAllocator(0, Config::HugePagesMode::Disabled));
+}
+
+TEST(MKLDNNNumaAllocatorTests, BuffersAreAlignedToHugePages) {
+    for (auto mode : {Config::HugePagesMode::Transparent, Config::HugePagesMode::Explicit}) {
+        auto allocator = CreateGraphAllocator(0, mode);
+        ASSERT_NE(nullptr, allocator);
+
+        const size_t size = 3 * MKLDNNNumaAllocator::hugePageSize + 17;
+        void* handle = allocator->alloc(size);
+        ASSERT_NE(nullptr, handle);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(handle) % MKLDNNNumaAllocator::hugePageSize);
+
+        auto* data = static_cast<uint8_t*>(allocator->lock(handle));
+        for (size_t i = 0; i < size; i++)
+            data[i] = static_cast<uint8_t>(i);
+        for (size_t i = 0; i < size; i += 4099)
+            ASSERT_EQ(static_cast<uint8_t>(i), data[i]);
+        allocator->unlock(handle);
+
+        ASSERT_TRUE(allocator->free(handle));
+        ASSERT_EQ(nullptr, allocator->alloc(0));
+    }
+}
+
+TEST(MKLDNNNumaAllocatorTests, SmallBuffersAreTakenFromHeap) {
+    auto allocator = CreateGraphAllocator(0, Config::HugePagesMode::Explicit);
+    ASSERT_NE(nullptr, allocator);
+
+    // Many small weights of a graph must not take a huge page each
+    std::vector<void*> handles;
+    for (size_t size = 1; size < MKLDNNNumaAllocator::hugePageSize; size = size * 3 + 5) {
+        void* handle = allocator->alloc(size);
+        ASSERT_NE(nullptr, handle);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(handle) % MKLDNNNumaAllocator::smallBufferAlignment);
+        std::memset(allocator->lock(handle), 1, size);
+        allocator->unlock(handle);
+        handles.push_back(handle);
+    }
+    void* large = allocator->alloc(MKLDNNNumaAllocator::hugePageSize);
+    ASSERT_NE(nullptr, large);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(large) % MKLDNNNumaAllocator::hugePageSize);
+    handles.push_back(large);
+
+    for (void* handle : handles)
+        ASSERT_TRUE(allocator->free(handle));
+}
+
+TEST(MKLDNNNumaAllocatorTests, MemoryIsCreatedByAllocator) {
+    auto allocator = CreateGraphAllocator(0, Config::HugePagesMode::Transparent);
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+
+    MKLDNNPlugin::MKLDNNMemory memory(eng);
+    memory.Create(MKLDNNMemoryDesc(TensorDesc(Precision::FP32, {1, 64, 128, 128}, Layout::NCHW)), allocator);
+    ASSERT_NE(nullptr, memory.GetData());
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(memory.GetData()) % MKLDNNNumaAllocator::hugePageSize);
+
+    float* data = static_cast<float*>(memory.GetData());
+    std::fill(data, data + memory.GetSize() / sizeof(float), 1.f);
+    ASSERT_EQ(1.f, data[memory.GetSize() / sizeof(float) - 1]);
+}
+
+#ifdef __linux__
+namespace {
+
+// Returns -1 if the counters are not available (containers, restricted perf_event_paranoid)
+int openTlbMissesCounter() {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+std::vector<int> getNumaNodeCpus(int numaNode) {
+    std::vector<int> cpus;
+    std::ifstream file("/sys/devices/system/node/node" + std::to_string(numaNode) + "/cpulist");
+    std::string range;
+    while (std::getline(file, range, ',')) {
+        auto dash = range.find('-');
+        int first = std::stoi(range.substr(0, dash));
+        int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int cpu = first; cpu <= last; cpu++)
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+struct AccessResult {
+    double nsPerAccess;
+    long long tlbMisses;
+};
+
+// Dependent random loads over the whole buffer, so every access pays the full translation and memory latency
+AccessResult measureRandomAccess(IAllocator &allocator, size_t size) {
+    const size_t count = size / sizeof(size_t);
+    void* handle = allocator.alloc(size);
+    auto* next = static_cast<size_t*>(allocator.lock(handle));
+
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+    for (size_t i = 0; i < count; i++)
+        next[order[i]] = order[(i + 1) % count];
+
+    const size_t accesses = 10 * 1000 * 1000;
+    int counter = openTlbMissesCounter();
+    if (counter >= 0) {
+        ioctl(counter, PERF_EVENT_IOC_RESET, 0);
+        ioctl(counter, PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t position = 0;
+    for (size_t i = 0; i < accesses; i++)
+        position = next[position];
+    auto finish = std::chrono::high_resolution_clock::now();
+
+    AccessResult result {std::chrono::duration<double, std::nano>(finish - start).count() / accesses, -1};
+    if (counter >= 0) {
+        ioctl(counter, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(counter, &result.tlbMisses, sizeof(result.tlbMisses)) != sizeof(result.tlbMisses))
+            result.tlbMisses = -1;
+        close(counter);
+    }
+
+    // Keeps the chain from being optimized out
+    if (position == count)
+        std::cout << position;
+
+    allocator.unlock(handle);
+    allocator.free(handle);
+    return result;
+}
+
+}  // namespace
+
+TEST(MKLDNNNumaAllocatorTests, DISABLED_BenchmarkHugePagesAndNumaBinding) {
+    const size_t size = 1024 * 1024 * 1024;
+    auto print = [](const std::string &name, const AccessResult &result) {
+        std::cout << name << ": " << result.nsPerAccess << " ns/access";
+        if (result.tlbMisses >= 0)
+            std::cout << ", " << result.tlbMisses << " dTLB load misses";
+        std::cout << std::endl;
+    };
+
+    auto cpus = getNumaNodeCpus(0);
+    if (!cpus.empty()) {
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        for (int cpu : cpus)
+            CPU_SET(cpu, &mask);
+        sched_setaffinity(0, sizeof(mask), &mask);
+    }
+
+    auto transparent = CreateGraphAllocator(0, Config::HugePagesMode::Transparent);
+    auto explicitPages = CreateGraphAllocator(0, Config::HugePagesMode::Explicit);
+    // Same mapping without the MADV_HUGEPAGE hint gives the baseline 4KB pages unless THP is set to "always"
+    auto* small = new MKLDNNNumaAllocator(0, Config::HugePagesMode::Disabled);
+    std::shared_ptr<IAllocator> smallPages(small, [](IAllocator* allocator) { allocator->Release(); });
+
+    print("4KB pages, local node", measureRandomAccess(*smallPages, size));
+    print("transparent huge pages, local node", measureRandomAccess(*transparent, size));
+    print("explicit huge pages, local node", measureRandomAccess(*explicitPages, size));
+
+    int remoteNode = 1;
+    while (!getNumaNodeCpus(remoteNode).empty())
+        remoteNode++;
+    remoteNode--;
+    if (remoteNode > 0) {
+        auto remote = CreateGraphAllocator(remoteNode, Config::HugePagesMode::Transparent);
+        print("transparent huge pages, remote node " + std::to_string(remoteNode), measureRandomAccess(*remote, size));
+    } else {
+        std::cout << "single NUMA node, remote access is not measured" << std::endl;
+    }
+}
+#endif
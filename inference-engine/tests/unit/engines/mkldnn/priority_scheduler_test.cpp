@@ -0,0 +1,235 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "mkldnn_priority_scheduler.h"
+#include "mkldnn_streams.h"
+#include "config.h"
+
+#include "tests_common.hpp"
+#include "graph/test_graph.hpp"
+#include <ie_plugin_config.hpp>
+#include <ie_tracer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+
+TEST(MKLDNNPrioritySchedulerTests, InferenceOutOfScopeIsNotPreempted) {
+    MKLDNNPriorityScheduler::Scope highPriority(10);
+    std::atomic<bool> mustYield(true);
+    std::thread([&] { mustYield = MKLDNNPriorityScheduler::mustYield(); }).join();
+    ASSERT_FALSE(mustYield);
+}
+
+TEST(MKLDNNPrioritySchedulerTests, SamePriorityIsNotPreempted) {
+    MKLDNNPriorityScheduler::Scope first(1);
+    std::atomic<bool> mustYield(true);
+    std::thread([&] {
+        MKLDNNPriorityScheduler::Scope second(1);
+        mustYield = MKLDNNPriorityScheduler::mustYield();
+    }).join();
+    ASSERT_FALSE(mustYield);
+}
+
+TEST(MKLDNNPrioritySchedulerTests, NestedScopeKeepsOuterPriority) {
+    MKLDNNPriorityScheduler::Scope outer(0);
+    {
+        // the body of TensorIterator must not be preempted by the graph running it
+        MKLDNNPriorityScheduler::Scope nested(-1);
+        ASSERT_FALSE(MKLDNNPriorityScheduler::mustYield());
+    }
+    ASSERT_FALSE(MKLDNNPriorityScheduler::mustYield());
+}
+
+TEST(MKLDNNPrioritySchedulerTests, LowPriorityWaitsForHighPriorityCompletion) {
+    std::atomic<bool> highStarted(false), highFinished(false), lowResumed(false);
+    std::atomic<bool> resumedBeforeHighFinished(false);
+
+    std::thread low([&] {
+        MKLDNNPriorityScheduler::Scope scope(0);
+        while (!highStarted) std::this_thread::yield();
+        ASSERT_TRUE(MKLDNNPriorityScheduler::mustYield());
+        MKLDNNPriorityScheduler::getInstance().yield();
+        resumedBeforeHighFinished = !highFinished;
+        lowResumed = true;
+    });
+
+    {
+        MKLDNNPriorityScheduler::Scope scope(5);
+        highStarted = true;
+        ASSERT_FALSE(MKLDNNPriorityScheduler::mustYield());
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ASSERT_FALSE(lowResumed);
+        highFinished = true;
+    }
+    low.join();
+
+    ASSERT_TRUE(lowResumed);
+    ASSERT_FALSE(resumedBeforeHighFinished);
+}
+
+TEST(MKLDNNPrioritySchedulerTests, PreemptionIsBounded) {
+    std::atomic<bool> highStarted(false);
+    std::atomic<bool> expired(false), preemptedAgain(true), newInferencePreempted(false);
+    std::chrono::steady_clock::duration waited {};
+
+    std::thread low([&] {
+        {
+            MKLDNNPriorityScheduler::Scope scope(0);
+            while (!highStarted) std::this_thread::yield();
+            auto start = std::chrono::steady_clock::now();
+            MKLDNNPriorityScheduler::getInstance().yield();
+            waited = std::chrono::steady_clock::now() - start;
+            expired = true;
+            // the inference which waited for maxPreemption continues till its end
+            preemptedAgain = MKLDNNPriorityScheduler::mustYield();
+        }
+        MKLDNNPriorityScheduler::Scope next(0);
+        newInferencePreempted = MKLDNNPriorityScheduler::mustYield();
+    });
+
+    {
+        MKLDNNPriorityScheduler::Scope scope(5);
+        highStarted = true;
+        while (!expired) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        low.join();
+    }
+
+    ASSERT_GE(waited, MKLDNNPriorityScheduler::maxPreemption);
+    ASSERT_FALSE(preemptedAgain);
+    ASSERT_TRUE(newInferencePreempted);
+}
+
+TEST(MKLDNNPrioritySchedulerTests, StreamsStartQueuedTasksByPriority) {
+    std::promise<void> unblock;
+    std::shared_future<void> blocked = unblock.get_future().share();
+    std::promise<void> done;
+    std::vector<int> order;
+    {
+        MultiWorkerTaskExecutor executor({[] {}}, "Test");
+        // the first task holds the only stream until all the other tasks are queued
+        executor.run([blocked] { blocked.wait(); });
+        executor.runWithPriority([&] { order.push_back(1); }, 0);
+        executor.runWithPriority([&] { order.push_back(2); }, 5);
+        executor.runWithPriority([&] { order.push_back(3); }, 0);
+        executor.runWithPriority([&] { order.push_back(4); }, 5);
+        executor.runWithPriority([&] { order.push_back(5); done.set_value(); }, -1);
+        unblock.set_value();
+        done.get_future().wait();
+    }
+    ASSERT_EQ((std::vector<int>{2, 4, 1, 3, 5}), order);
+}
+
+TEST(MKLDNNPriorityConfigTests, PriorityIsParsed) {
+    Config config;
+    ASSERT_EQ(0, config.priority);
+    config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_PRIORITY, "-3"}});
+    ASSERT_EQ(-3, config.priority);
+    ASSERT_EQ("-3", config._config.at(InferenceEngine::PluginConfigParams::KEY_CPU_PRIORITY));
+}
+
+TEST(MKLDNNPriorityConfigTests, WrongPriorityIsRejected) {
+    for (auto value : {"", "high", "1.5", "7x", "99999999999"}) {
+        Config config;
+        ASSERT_THROW(config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_PRIORITY, value}}),
+                     InferenceEngine::details::InferenceEngineException) << value;
+        ASSERT_EQ(0, config.priority) << value;
+    }
+}
+
+class MKLDNNGraphPreemptionTests: public TestsCommon {
+protected:
+    std::string model = R"V0G0N(
+<net name="Preemption" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scale" type="Power" precision="FP32" id="1">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+};
+
+TEST_F(MKLDNNGraphPreemptionTests, InferYieldsToHigherPriorityBetweenNodes) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+    auto &tracer = InferenceEngine::Tracer::getInstance();
+    int session = tracer.startSession();
+    graph.setTraceSession(session);
+
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(
+            {InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+    InferenceEngine::BlobMap srcs = {{"data", src}};
+    auto item = *net_reader.getNetwork().getOutputsInfo().begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs = {{item.first, output}};
+
+    std::atomic<bool> finished(false);
+    std::thread low;
+    {
+        MKLDNNPriorityScheduler::Scope highPriority(5);
+        low = std::thread([&] {
+            MKLDNNPriorityScheduler::Scope lowPriority(0);
+            graph.Infer(srcs, outputBlobs);
+            finished = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ASSERT_FALSE(finished);
+    }
+    low.join();
+    ASSERT_TRUE(finished);
+
+    auto srcData = src->buffer().as<const float *>();
+    auto dstData = output->buffer().as<const float *>();
+    for (size_t i = 0; i < output->size(); i++)
+        ASSERT_FLOAT_EQ(2.f * srcData[i], dstData[i]);
+
+    std::stringstream trace;
+    tracer.write(session, trace);
+    tracer.endSession(session);
+    ASSERT_NE(std::string::npos, trace.str().find("\"name\":\"Preempted\",\"cat\":\"Node\""));
+}
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/middleend/hw/conv_tiling/hw_tiling_planner.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace vpu;
+using namespace vpu::HWTilingNS;
+using namespace testing;
+
+namespace {
+
+TilingOption makeOption(int numHeightTiles, double cost) {
+    return {1, numHeightTiles, 1, numHeightTiles, cost};
+}
+
+TilingPlanStage makeStage(std::vector<TilingOption> options, int outputElements) {
+    TilingPlanStage stage;
+    stage.options = std::move(options);
+    stage.outputElements = outputElements;
+    return stage;
+}
+
+}  // namespace
+
+TEST(VPU_HwTilingPlannerTest, EmptyChain) {
+    const auto plan = planTilingJointly({}, 1000);
+    ASSERT_TRUE(plan.choices.empty());
+    ASSERT_EQ(plan.numDdrTransfers, 0);
+}
+
+TEST(VPU_HwTilingPlannerTest, LocalPlanTakesBestOptions) {
+    const std::vector<TilingPlanStage> chain = {
+        makeStage({makeOption(2, 100.0), makeOption(1, 150.0)}, 100),
+        makeStage({makeOption(1, 100.0)}, 100),
+    };
+
+    const auto plan = planTilingLocally(chain, 1000);
+    ASSERT_EQ(plan.choices, std::vector<std::size_t>({0, 0}));
+    ASSERT_EQ(plan.numDdrTransfers, 1);
+    ASSERT_DOUBLE_EQ(plan.cost, 100.0 + 100.0 + 2 * 100.0);
+}
+
+TEST(VPU_HwTilingPlannerTest, JointPlanKeepsDataInCMX) {
+    const std::vector<TilingPlanStage> chain = {
+        makeStage({makeOption(2, 100.0), makeOption(1, 150.0)}, 100),
+        makeStage({makeOption(1, 100.0)}, 100),
+        makeStage({makeOption(3, 100.0), makeOption(1, 120.0)}, 100),
+    };
+
+    const auto localPlan = planTilingLocally(chain, 1000);
+    const auto jointPlan = planTilingJointly(chain, 1000);
+
+    ASSERT_EQ(jointPlan.choices, std::vector<std::size_t>({1, 0, 1}));
+    ASSERT_EQ(jointPlan.numDdrTransfers, 0);
+    ASSERT_DOUBLE_EQ(jointPlan.cost, 150.0 + 100.0 + 120.0);
+    ASSERT_LT(jointPlan.cost, localPlan.cost);
+}
+
+TEST(VPU_HwTilingPlannerTest, JointPlanRespectsCMXBudget) {
+    const std::vector<TilingPlanStage> chain = {
+        makeStage({makeOption(2, 100.0), makeOption(1, 150.0)}, 2000),
+        makeStage({makeOption(1, 100.0)}, 100),
+    };
+
+    const auto plan = planTilingJointly(chain, 1000);
+    ASSERT_EQ(plan.choices, std::vector<std::size_t>({0, 0}));
+    ASSERT_EQ(plan.numDdrTransfers, 1);
+}
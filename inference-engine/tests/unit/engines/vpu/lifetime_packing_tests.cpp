@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/middleend/allocator/structs.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace vpu;
+using namespace vpu::allocator;
+using namespace testing;
+
+namespace {
+
+LifetimeBuffer makeBuffer(int start, int end, int size, double priority) {
+    LifetimeBuffer buffer;
+    buffer.start = start;
+    buffer.end = end;
+    buffer.size = size;
+    buffer.priority = priority;
+    return buffer;
+}
+
+}  // namespace
+
+TEST(VPU_LifetimePackingTest, NonOverlappingBuffersReuseMemory) {
+    std::vector<LifetimeBuffer> buffers = {
+        makeBuffer(0, 1, 100, 1.0),
+        makeBuffer(2, 3, 100, 1.0),
+        makeBuffer(4, 5, 100, 1.0),
+    };
+
+    packLifetimeBuffers(buffers, 100);
+
+    for (const auto& buffer : buffers) {
+        ASSERT_EQ(buffer.offset, 0);
+    }
+}
+
+TEST(VPU_LifetimePackingTest, OverlappingBuffersDontIntersect) {
+    std::vector<LifetimeBuffer> buffers = {
+        makeBuffer(0, 2, 100, 1.0),
+        makeBuffer(1, 3, 50, 1.0),
+        makeBuffer(3, 4, 100, 1.0),
+    };
+
+    packLifetimeBuffers(buffers, 200);
+
+    ASSERT_EQ(buffers[0].offset, 0);
+    ASSERT_EQ(buffers[1].offset, 100);
+    ASSERT_EQ(buffers[2].offset, 0);
+}
+
+TEST(VPU_LifetimePackingTest, HigherPriorityIsPlacedFirst) {
+    std::vector<LifetimeBuffer> buffers = {
+        makeBuffer(0, 2, 60, 1.0),
+        makeBuffer(1, 3, 60, 10.0),
+    };
+
+    packLifetimeBuffers(buffers, 100);
+
+    ASSERT_EQ(buffers[0].offset, -1);
+    ASSERT_EQ(buffers[1].offset, 0);
+}
+
+TEST(VPU_LifetimePackingTest, FillsGapBetweenPlacedBuffers) {
+    std::vector<LifetimeBuffer> buffers = {
+        makeBuffer(0, 4, 40, 3.0),
+        makeBuffer(0, 1, 40, 2.0),
+        makeBuffer(0, 4, 20, 1.5),
+        makeBuffer(2, 3, 40, 1.0),
+    };
+
+    packLifetimeBuffers(buffers, 100);
+
+    ASSERT_EQ(buffers[0].offset, 0);
+    ASSERT_EQ(buffers[1].offset, 40);
+    ASSERT_EQ(buffers[2].offset, 80);
+    ASSERT_EQ(buffers[3].offset, 40);
+}
@@ -227,6 +227,40 @@ TEST_F(CNNNGraphImplTests, ConstantAsInternalAndExternalLayer) {
     ASSERT_EQ(4, cnnNet.layerCount());
 }
 
+TEST_F(CNNNGraphImplTests, ConstantBlobSharesDataWithNGraphConstant) {
+    std::shared_ptr<ngraph::Function> ngraph;
+    {
+        ngraph::PartialShape shape({1, 3, 22, 22});
+        ngraph::element::Type type(ngraph::element::Type_t::f32);
+        auto param = std::make_shared<ngraph::op::Parameter>(type, shape);
+        auto constant = ngraph::op::Constant::create(ngraph::element::Type_t::f32, {1, 3, 22, 22},
+                                                     std::vector<float>(3 * 22 * 22, 2.f));
+        constant->set_friendly_name("constant");
+        auto max = std::make_shared<ngraph::op::v1::Maximum>(param, constant);
+        auto result = std::make_shared<ngraph::op::Result>(max);
+
+        ngraph::ParameterVector params = {param};
+        ngraph::ResultVector results = {result};
+
+        ngraph = std::make_shared<ngraph::Function>(results, params);
+    }
+
+    Blob::Ptr blob;
+    {
+        InferenceEngine::CNNNetwork cnnNet(ngraph);
+        auto constLayer = cnnNet.getLayerByName("constant");
+        ASSERT_NE(nullptr, constLayer);
+        blob = constLayer->blobs["custom"];
+    }
+    ngraph.reset();
+
+    // Blob data is owned by the nGraph Constant which must stay alive together with the blob
+    ASSERT_NE(nullptr, blob);
+    ASSERT_EQ(3 * 22 * 22, blob->size());
+    ASSERT_EQ(2.f, blob->cbuffer().as<const float*>()[0]);
+    ASSERT_EQ(2.f, blob->cbuffer().as<const float*>()[blob->size() - 1]);
+}
+
 TEST_F(CNNNGraphImplTests, SavePrimitivesPriority) {
     std::string model = R"V0G0N(
 <net name="Activation" version="10">
@@ -84,6 +84,23 @@ TEST_F(InferRequestBaseTests, canCatchUnknownErrorInSetUserData) {
     ASSERT_EQ(UNEXPECTED, request->SetUserData(nullptr, nullptr));
 }
 
+// SetPriority
+TEST_F(InferRequestBaseTests, canForwardSetPriority) {
+    EXPECT_CALL(*mock_impl.get(), SetPriority(3)).Times(1);
+    ASSERT_EQ(OK, request->SetPriority(3, &dsc));
+}
+
+TEST_F(InferRequestBaseTests, canReportErrorInSetPriority) {
+    EXPECT_CALL(*mock_impl.get(), SetPriority(_)).WillOnce(Throw(std::runtime_error("compare")));
+    ASSERT_NE(request->SetPriority(0, &dsc), OK);
+    ASSERT_STREQ(dsc.msg, "compare");
+}
+
+TEST_F(InferRequestBaseTests, canCatchUnknownErrorInSetPriority) {
+    EXPECT_CALL(*mock_impl.get(), SetPriority(_)).WillOnce(Throw(5));
+    ASSERT_EQ(UNEXPECTED, request->SetPriority(0, nullptr));
+}
+
 // Wait
 TEST_F(InferRequestBaseTests, canForwardWait) {
     int64_t ms = 0;
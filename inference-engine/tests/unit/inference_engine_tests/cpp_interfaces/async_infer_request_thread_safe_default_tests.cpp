@@ -11,6 +11,7 @@
 #include <cpp_interfaces/mock_task_executor.hpp>
 #include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
 #include <deque>
+#include <vector>
 
 using namespace ::testing;
 using namespace std;
@@ -55,6 +56,17 @@ struct DeferedExecutor : public ITaskExecutor {
     std::deque<Task> tasks;
 };
 
+struct PriorityRecordingExecutor : public DeferedExecutor {
+    using Ptr = std::shared_ptr<PriorityRecordingExecutor>;
+
+    void runWithPriority(Task task, int priority) override {
+        priorities.push_back(priority);
+        run(std::move(task));
+    }
+
+    std::vector<int> priorities;
+};
+
 class InferRequestThreadSafeDefaultTests : public ::testing::Test {
 protected:
     shared_ptr<TestAsyncInferRequestThreadSafeDefault> testRequest;
@@ -190,6 +202,34 @@ TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetBlob) {
     taskExecutor->executeAll();
 }
 
+// SetPriority
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetPriority) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Return());
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() { testRequest->SetPriority(1); }, REQUEST_BUSY_str));
+    taskExecutor->executeAll();
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, stagesAreRunWithPriorityOfRequest) {
+    auto taskExecutor = std::make_shared<PriorityRecordingExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(2).WillRepeatedly(Return());
+
+    testRequest->SetPriority(7);
+    ASSERT_EQ(7, mockInferRequestInternal->GetPriority());
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    taskExecutor->executeAll();
+    ASSERT_EQ(std::vector<int>{7}, taskExecutor->priorities);
+
+    // the priority set between the inferences is used by the next one
+    testRequest->SetPriority(-2);
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    taskExecutor->executeAll();
+    ASSERT_EQ((std::vector<int>{7, -2}), taskExecutor->priorities);
+}
+
 // SetCompletionCallback
 TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetCompletionCallback) {
     auto taskExecutor = std::make_shared<DeferedExecutor>();
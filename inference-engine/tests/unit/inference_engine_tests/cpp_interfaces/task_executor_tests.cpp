@@ -185,6 +185,32 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+TEST(TaskExecutorPriorityTests, queuedTasksAreStartedByPriority) {
+    std::mutex mutex_block_emulation;
+    std::condition_variable cv_block_emulation;
+    bool isBlocked = true;
+    std::vector<int> order;
+    {
+        auto taskExecutor = std::make_shared<TaskExecutor>("Test Executor");
+        // the first task holds the worker until all the other tasks are queued
+        taskExecutor->run([&] {
+            std::unique_lock<std::mutex> lock(mutex_block_emulation);
+            cv_block_emulation.wait(lock, [&isBlocked] { return !isBlocked; });
+        });
+        taskExecutor->runWithPriority([&] { order.push_back(1); }, 0);
+        taskExecutor->runWithPriority([&] { order.push_back(2); }, 5);
+        taskExecutor->runWithPriority([&] { order.push_back(3); }, 0);
+        taskExecutor->runWithPriority([&] { order.push_back(4); }, 5);
+        taskExecutor->runWithPriority([&] { order.push_back(5); }, -1);
+        {
+            std::lock_guard<std::mutex> lock{mutex_block_emulation};
+            isBlocked = false;
+        }
+        cv_block_emulation.notify_all();
+    }
+    ASSERT_EQ((std::vector<int>{2, 4, 1, 3, 5}), order);
+}
+
 static auto Executors = ::testing::Values(
     [] {
         return std::make_shared<TaskExecutor>("Test Executor");
@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_tracer.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class TracerTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        session = Tracer::getInstance().startSession();
+    }
+
+    void TearDown() override {
+        Tracer::getInstance().endSession(session);
+    }
+
+    static std::string write(int session) {
+        std::stringstream trace;
+        Tracer::getInstance().write(session, trace);
+        return trace.str();
+    }
+
+    static size_t countEvents(const std::string &trace) {
+        size_t count = 0;
+        for (auto position = trace.find("\"ph\":\"X\""); position != std::string::npos;
+             position = trace.find("\"ph\":\"X\"", position + 1)) {
+            count++;
+        }
+        return count;
+    }
+
+    int session = 0;
+};
+
+TEST_F(TracerTests, scopeIsNotRecordedWithoutSession) {
+    {
+        TraceScope trace(0, "Test", "untraced");
+    }
+    ASSERT_EQ(0, countEvents(write(0)));
+    ASSERT_EQ(0, countEvents(write(session)));
+}
+
+TEST_F(TracerTests, sessionsAreDistinct) {
+    auto &tracer = Tracer::getInstance();
+    int other = tracer.startSession();
+    ASSERT_NE(0, other);
+    ASSERT_NE(session, other);
+    tracer.endSession(other);
+}
+
+TEST_F(TracerTests, eventsOfThreadsAreWrittenAsChromeTrace) {
+    {
+        TraceScope trace(session, "Test", "main \"thread\"", 3);
+    }
+    std::thread([this] {
+        TraceScope trace(session, "Test", "other thread");
+    }).join();
+
+    auto trace = write(session);
+    ASSERT_EQ(0, trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    ASSERT_EQ(2, countEvents(trace));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"main \\\"thread\\\"\",\"cat\":\"Test\""));
+    ASSERT_NE(std::string::npos, trace.find("\"args\":{\"stream\":3}"));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"other thread\""));
+}
+
+TEST_F(TracerTests, sessionWritesOnlyItsEvents) {
+    auto &tracer = Tracer::getInstance();
+    int other = tracer.startSession();
+    tracer.addEvent(session, "Test", "mine", 0, 1);
+    tracer.addEvent(other, "Test", "other", 0, 1);
+
+    auto trace = write(session);
+    ASSERT_EQ(1, countEvents(trace));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"mine\""));
+
+    tracer.endSession(other);
+    ASSERT_EQ(0, countEvents(write(other)));
+    ASSERT_EQ(1, countEvents(write(session)));
+}
+
+TEST_F(TracerTests, endSessionReleasesBuffersOfFinishedThreads) {
+    auto &tracer = Tracer::getInstance();
+    tracer.addEvent(session, "Test", "main", 0, 1);
+    auto buffers = tracer.getBuffersCount();
+    std::thread([this] {
+        Tracer::getInstance().addEvent(session, "Test", "finished thread", 0, 1);
+    }).join();
+    ASSERT_EQ(buffers + 1, tracer.getBuffersCount());
+    ASSERT_EQ(2, countEvents(write(session)));
+
+    tracer.endSession(session);
+    ASSERT_EQ(buffers, tracer.getBuffersCount());
+    ASSERT_EQ(0, countEvents(write(session)));
+}
+
+TEST_F(TracerTests, bufferKeepsLastEvents) {
+    auto &tracer = Tracer::getInstance();
+    for (size_t i = 0; i < Tracer::eventsPerThread + 10; i++)
+        tracer.addEvent(session, "Test", i < 10 ? "old" : "new", 0, 1);
+
+    auto trace = write(session);
+    ASSERT_EQ(Tracer::eventsPerThread, countEvents(trace));
+    ASSERT_EQ(std::string::npos, trace.find("\"name\":\"old\""));
+}
+
+TEST_F(TracerTests, endSessionKeepsOrderOfOtherSessions) {
+    auto &tracer = Tracer::getInstance();
+    int other = tracer.startSession();
+    for (size_t i = 0; i < Tracer::eventsPerThread + 10; i++)
+        tracer.addEvent(i % 2 ? session : other, "Test", std::to_string(i), 0, 1);
+    tracer.endSession(other);
+
+    // The ring buffer is compacted, new events do not overwrite the kept ones until it fills up again
+    tracer.addEvent(session, "Test", "last", 0, 1);
+    auto trace = write(session);
+    ASSERT_EQ(Tracer::eventsPerThread / 2 + 1, countEvents(trace));
+    ASSERT_LT(trace.find("\"name\":\"" + std::to_string(Tracer::eventsPerThread + 9) + "\""),
+              trace.find("\"name\":\"last\""));
+}
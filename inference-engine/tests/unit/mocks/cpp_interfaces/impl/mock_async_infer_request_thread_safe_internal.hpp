@@ -60,4 +60,6 @@ public:
 
 	MOCK_METHOD1(SetBatch, void(int));
 	MOCK_METHOD1(SetBatch_ThreadUnsafe, void(int));
+	MOCK_METHOD1(SetPriority, void(int));
+	MOCK_METHOD1(SetPriority_ThreadUnsafe, void(int));
 };
@@ -24,4 +24,5 @@ public:
     MOCK_CONST_METHOD2(GetPreProcess, void(const char* name, const PreProcessInfo**));
     MOCK_METHOD1(SetCompletionCallback, void(InferenceEngine::IInferRequest::CompletionCallback));
 	MOCK_METHOD1(SetBatch, void(int));
+	MOCK_METHOD1(SetPriority, void(int));
 };
@@ -616,6 +616,23 @@ INSTANTIATE_TEST_CASE_P(
                                       MapParams(MapStrStr()),
                                       LayerDataName("data"),
                                       CanInfer(true)),
+                ::testing::make_tuple(LayerType("CTCBeamSearchDecoder"),
+                                      InOutShapes({{{88, 1, 71}, {88, 1}},
+                                                   {{1,  88, 1, 1}}}),
+                                      NewInOutShapes({{{88, 2, 71}, {88, 2}},
+                                                      {{2,  88, 1,  1}}}),
+                                      MapParams(MapStrStr({{"beam_width",      "4"},
+                                                           {"prune_threshold", "0.001"}})),
+                                      LayerDataName("data"),
+                                      CanInfer(true)),
+                ::testing::make_tuple(LayerType("CTCBeamSearchDecoder"),
+                                      InOutShapes({{{20, 3, 29}},
+                                                   {{3,  20, 1, 1}}}),
+                                      NewInOutShapes({{{30, 1, 29}},
+                                                      {{1,  30, 1, 1}}}),
+                                      MapParams(MapStrStr()),
+                                      LayerDataName("data"),
+                                      CanInfer(true)),
                 ::testing::make_tuple(LayerType("Reshape"),
                                       InOutShapes({{{1, 2}},
                                                    {{1, 1}}}),
@@ -4,12 +4,14 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <iomanip>
 #include <fstream>
 #include <algorithm>
 #include <unordered_map>
 #include <map>
 #include <vector>
 #include <string>
+#include <utility>
 
 #include <gflags/gflags.h>
 
@@ -50,6 +52,19 @@ static constexpr char iop_message[] = "Optional. Specifies precision for input a
 "                                             Notice that quotes are required.\n"
 "                                             Overwrites precision from ip and op options for specified layers.";
 
+static constexpr char passes_timings_message[] = "Optional. Print durations of graph compiler passes."
+                                                 " Supported for MYRIAD device only.";
+
+static constexpr char hw_global_tiling_message[] = "Optional. Select tilings of adjacent HW convolutions jointly"
+                                                   " to keep intermediate data in CMX. Supported for MYRIAD device only.";
+
+static constexpr char cmx_allocation_strategy_message[] = "Optional. Specifies how HW inputs are selected to be placed in CMX."
+                                                          " Supported values: GREEDY, LIFETIME. Overwrites value from config.";
+
+static constexpr char compile_statistics_message[] = "Optional. Print graph compiler estimates"
+                                                     " (HW tiling plan costs, CMX utilization, data left in DDR)."
+                                                     " Supported for MYRIAD device only.";
+
 static constexpr char dla_arch_name[] = "Optional. Specify architecture name used to compile executable network for FPGA device.";
 
 DEFINE_bool(h, false, help_message);
@@ -63,6 +78,10 @@ DEFINE_string(iop, "", iop_message);
 DEFINE_string(VPU_MYRIAD_PLATFORM, "", platform_message);
 DEFINE_string(VPU_NUMBER_OF_SHAVES, "", number_of_shaves_message);
 DEFINE_string(VPU_NUMBER_OF_CMX_SLICES, "", number_of_cmx_slices_message);
+DEFINE_bool(VPU_PASSES_TIMINGS, false, passes_timings_message);
+DEFINE_bool(VPU_HW_GLOBAL_TILING, false, hw_global_tiling_message);
+DEFINE_string(VPU_CMX_ALLOCATION_STRATEGY, "", cmx_allocation_strategy_message);
+DEFINE_bool(VPU_COMPILE_STATISTICS, false, compile_statistics_message);
 DEFINE_string(DLA_ARCH_NAME, "", dla_arch_name);
 
 static void showUsage() {
@@ -82,6 +101,10 @@ static void showUsage() {
     std::cout << "      -VPU_MYRIAD_PLATFORM       <value>     "   << platform_message             << std::endl;
     std::cout << "      -VPU_NUMBER_OF_SHAVES      <value>     "   << number_of_shaves_message     << std::endl;
     std::cout << "      -VPU_NUMBER_OF_CMX_SLICES  <value>     "   << number_of_cmx_slices_message << std::endl;
+    std::cout << "      -VPU_PASSES_TIMINGS                    "   << passes_timings_message       << std::endl;
+    std::cout << "      -VPU_HW_GLOBAL_TILING                  "   << hw_global_tiling_message     << std::endl;
+    std::cout << "      -VPU_CMX_ALLOCATION_STRATEGY <value>   "   << cmx_allocation_strategy_message << std::endl;
+    std::cout << "      -VPU_COMPILE_STATISTICS                "   << compile_statistics_message   << std::endl;
     std::cout << "    DLA options:                             "                                   << std::endl;
     std::cout << "      -DLA_ARCH_NAME             <value>     "   << dla_arch_name                << std::endl;
     std::cout << std::endl;
@@ -103,6 +126,18 @@ static bool parseCommandLine(int *argc, char ***argv, InferenceEngine::Core& ie)
         throw std::invalid_argument("Target device name is required");
     }
 
+    if (FLAGS_VPU_PASSES_TIMINGS && std::string::npos == FLAGS_d.find("MYRIAD")) {
+        throw std::invalid_argument("VPU_PASSES_TIMINGS option is supported for MYRIAD device only");
+    }
+
+    if (FLAGS_VPU_HW_GLOBAL_TILING && std::string::npos == FLAGS_d.find("MYRIAD")) {
+        throw std::invalid_argument("VPU_HW_GLOBAL_TILING option is supported for MYRIAD device only");
+    }
+
+    if (FLAGS_VPU_COMPILE_STATISTICS && std::string::npos == FLAGS_d.find("MYRIAD")) {
+        throw std::invalid_argument("VPU_COMPILE_STATISTICS option is supported for MYRIAD device only");
+    }
+
     if (std::string::npos != FLAGS_d.find("MYRIAD") && FLAGS_VPU_MYRIAD_PLATFORM.empty()) {
         std::vector<std::string> myriadDeviceIds = ie.GetMetric("MYRIAD", METRIC_KEY(AVAILABLE_DEVICES));
         if (myriadDeviceIds.empty()) {
@@ -155,6 +190,14 @@ static std::map<std::string, std::string> configure(const std::string &configFil
         config[VPU_CONFIG_KEY(NUMBER_OF_CMX_SLICES)] = FLAGS_VPU_NUMBER_OF_CMX_SLICES;
     }
 
+    if (FLAGS_VPU_HW_GLOBAL_TILING) {
+        config[VPU_CONFIG_KEY(HW_GLOBAL_TILING)] = CONFIG_VALUE(YES);
+    }
+
+    if (!FLAGS_VPU_CMX_ALLOCATION_STRATEGY.empty()) {
+        config[VPU_CONFIG_KEY(CMX_ALLOCATION_STRATEGY)] = FLAGS_VPU_CMX_ALLOCATION_STRATEGY;
+    }
+
     if (!FLAGS_DLA_ARCH_NAME.empty()) {
         config[DLIA_CONFIG_KEY(ARCH_NAME)] = FLAGS_DLA_ARCH_NAME;
     }
@@ -324,6 +367,37 @@ std::string getFileNameFromPath(const std::string& path,
     }
 }
 
+static void printPassesTimings(InferenceEngine::ExecutableNetwork& executableNetwork) {
+    const auto timings = executableNetwork.GetMetric(VPU_METRIC(COMPILE_PASSES_TIMINGS))
+        .as<std::vector<std::pair<std::string, double>>>();
+
+    double total = 0.0;
+    for (const auto& timing : timings) {
+        total += timing.second;
+    }
+
+    std::cout << "Graph compiler passes timings:" << std::endl;
+    for (const auto& timing : timings) {
+        std::cout << "    " << std::left << std::setw(40) << timing.first
+                  << std::right << std::fixed << std::setprecision(3) << std::setw(12) << timing.second << " ms"
+                  << std::setw(8) << std::setprecision(1) << (total > 0.0 ? 100.0 * timing.second / total : 0.0) << " %"
+                  << std::endl;
+    }
+    std::cout << "    " << std::left << std::setw(40) << "Total"
+              << std::right << std::fixed << std::setprecision(3) << std::setw(12) << total << " ms" << std::endl;
+}
+
+static void printCompileStatistics(InferenceEngine::ExecutableNetwork& executableNetwork) {
+    const auto statistics = executableNetwork.GetMetric(VPU_METRIC(COMPILE_STATISTICS))
+        .as<std::map<std::string, double>>();
+
+    std::cout << "Graph compiler statistics:" << std::endl;
+    for (const auto& entry : statistics) {
+        std::cout << "    " << std::left << std::setw(40) << entry.first
+                  << std::right << std::fixed << std::setprecision(1) << std::setw(16) << entry.second << std::endl;
+    }
+}
+
 int main(int argc, char *argv[]) {
     try {
         std::cout << "Inference Engine: " << InferenceEngine::GetInferenceEngineVersion() << std::endl;
@@ -341,6 +415,14 @@ int main(int argc, char *argv[]) {
 
         auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, configure(FLAGS_c, FLAGS_m));
 
+        if (FLAGS_VPU_PASSES_TIMINGS) {
+            printPassesTimings(executableNetwork);
+        }
+
+        if (FLAGS_VPU_COMPILE_STATISTICS) {
+            printCompileStatistics(executableNetwork);
+        }
+
         std::string outputName = FLAGS_o;
         if (outputName.empty()) {
             outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + ".blob";
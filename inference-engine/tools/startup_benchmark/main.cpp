@@ -0,0 +1,248 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <map>
+#include <vector>
+#include <string>
+#include <utility>
+
+#include <gflags/gflags.h>
+
+#include "inference_engine.hpp"
+
+static constexpr char help_message[] = "Optional. Print the usage message.";
+static constexpr char model_message[] = "Required. Comma-separated paths to the XML models.";
+static constexpr char target_device_message[] = "Optional. Specify a target device to load the networks to. Default value: CPU.";
+static constexpr char repetitions_message[] = "Optional. Number of cold and of warm runs for every model. Default value: 5.";
+static constexpr char nstreams_message[] = "Optional. Number of streams of the CPU executable network."
+                                           " Default value is set by the plugin.";
+static constexpr char output_message[] = "Optional. Path to the CSV file with the durations of the phases of every run.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(m, "", model_message);
+DEFINE_string(d, "CPU", target_device_message);
+DEFINE_uint32(n, 5, repetitions_message);
+DEFINE_string(nstreams, "", nstreams_message);
+DEFINE_string(o, "", output_message);
+
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "startup_benchmark [OPTIONS]" << std::endl;
+    std::cout << "[OPTIONS]:" << std::endl;
+    std::cout << "    -h                                       "   << help_message          << std::endl;
+    std::cout << "    -m                           <value>     "   << model_message         << std::endl;
+    std::cout << "    -d                           <value>     "   << target_device_message << std::endl;
+    std::cout << "    -n                           <value>     "   << repetitions_message   << std::endl;
+    std::cout << "    -nstreams                    <value>     "   << nstreams_message      << std::endl;
+    std::cout << "    -o                           <value>     "   << output_message        << std::endl;
+    std::cout << std::endl;
+}
+
+static bool parseCommandLine(int *argc, char ***argv) {
+    gflags::ParseCommandLineNonHelpFlags(argc, argv, true);
+
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::invalid_argument("Path to model xml file is required");
+    }
+
+    if (FLAGS_n == 0) {
+        throw std::invalid_argument("Number of runs should be positive");
+    }
+
+    if (!FLAGS_nstreams.empty() && FLAGS_d != "CPU") {
+        throw std::invalid_argument("-nstreams option is supported for CPU device only");
+    }
+
+    if (1 < *argc) {
+        std::stringstream message;
+        message << "Unknown arguments: ";
+        for (auto arg = 1; arg < *argc; arg++) {
+            message << (*argv)[arg];
+            if (arg < *argc) {
+                message << " ";
+            }
+        }
+        throw std::invalid_argument(message.str());
+    }
+
+    return true;
+}
+
+static std::vector<std::string> split(const std::string &value, char delimiter) {
+    std::vector<std::string> items;
+    std::stringstream stream(value);
+    std::string item;
+    while (std::getline(stream, item, delimiter)) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+// Durations of the phases of one run in milliseconds, in the order they were executed
+using PhaseTimes = std::vector<std::pair<std::string, double>>;
+
+class PhaseTimer {
+public:
+    explicit PhaseTimer(PhaseTimes &times) : times(times) {}
+
+    template <typename Function>
+    void measure(const std::string &phase, Function &&function) {
+        auto start = std::chrono::high_resolution_clock::now();
+        function();
+        auto finish = std::chrono::high_resolution_clock::now();
+        times.emplace_back(phase, std::chrono::duration<double, std::milli>(finish - start).count());
+    }
+
+private:
+    PhaseTimes &times;
+};
+
+static void zeroInputs(InferenceEngine::InferRequest &request, const InferenceEngine::ConstInputsDataMap &inputs) {
+    for (auto &input : inputs) {
+        auto blob = InferenceEngine::as<InferenceEngine::MemoryBlob>(request.GetBlob(input.first));
+        if (!blob) {
+            continue;
+        }
+        auto memory = blob->wmap();
+        std::memset(memory.as<void*>(), 0, blob->byteSize());
+    }
+}
+
+static PhaseTimes runOnce(InferenceEngine::Core &ie, const std::string &model) {
+    PhaseTimes times;
+    PhaseTimer timer(times);
+
+    // The plugin library is loaded by the Core lazily, so it is done on the first request to the device
+    timer.measure("LoadPlugin", [&] { ie.GetVersions(FLAGS_d); });
+
+    InferenceEngine::CNNNetwork network;
+    timer.measure("ReadNetwork", [&] { network = ie.ReadNetwork(model); });
+
+    std::map<std::string, std::string> config;
+    if (!FLAGS_nstreams.empty()) {
+        config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = FLAGS_nstreams;
+    }
+    InferenceEngine::ExecutableNetwork executableNetwork;
+    timer.measure("LoadNetwork", [&] { executableNetwork = ie.LoadNetwork(network, FLAGS_d, config); });
+
+    // Internal phases of the loading reported by the plugin, they are parts of the LoadNetwork time
+    std::vector<std::string> metrics = executableNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    if (std::find(metrics.begin(), metrics.end(), METRIC_KEY(CPU_LOAD_PHASES)) != metrics.end()) {
+        std::map<std::string, float> loadPhases = executableNetwork.GetMetric(METRIC_KEY(CPU_LOAD_PHASES));
+        for (auto &phase : loadPhases) {
+            times.emplace_back("LoadNetwork/" + phase.first, phase.second);
+        }
+    }
+
+    InferenceEngine::InferRequest request;
+    timer.measure("CreateInferRequest", [&] { request = executableNetwork.CreateInferRequest(); });
+
+    // Uninitialized inputs may contain denormals or NaNs which distort timings
+    zeroInputs(request, executableNetwork.GetInputsInfo());
+    timer.measure("FirstInfer", [&] { request.Infer(); });
+    timer.measure("SecondInfer", [&] { request.Infer(); });
+
+    return times;
+}
+
+static void printStatistics(const std::string &model, const std::string &mode, const std::vector<PhaseTimes> &runs) {
+    std::vector<std::string> phases;
+    std::map<std::string, std::vector<double>> samples;
+    for (auto &run : runs) {
+        for (auto &phase : run) {
+            if (samples.find(phase.first) == samples.end()) {
+                phases.push_back(phase.first);
+            }
+            samples[phase.first].push_back(phase.second);
+        }
+    }
+
+    std::cout << std::endl << model << ", " << mode << " runs: " << runs.size() << std::endl;
+    std::cout << std::left << std::setw(48) << "Phase" << std::right
+              << std::setw(12) << "first, ms" << std::setw(12) << "min, ms"
+              << std::setw(12) << "median, ms" << std::setw(12) << "max, ms" << std::endl;
+    for (auto &phase : phases) {
+        auto values = samples[phase];
+        double first = values.front();
+        std::sort(values.begin(), values.end());
+        std::cout << std::left << std::setw(48) << phase << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << first << std::setw(12) << values.front()
+                  << std::setw(12) << values[values.size() / 2] << std::setw(12) << values.back() << std::endl;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    try {
+        std::cout << "Inference Engine: " << InferenceEngine::GetInferenceEngineVersion() << std::endl;
+
+        if (!parseCommandLine(&argc, &argv)) {
+            return EXIT_SUCCESS;
+        }
+
+        std::ofstream csv;
+        if (!FLAGS_o.empty()) {
+            csv.open(FLAGS_o);
+            if (!csv.is_open()) {
+                throw std::runtime_error("Cannot open output file " + FLAGS_o);
+            }
+            csv << "model;mode;run;phase;time_ms" << std::endl;
+        }
+
+        for (auto &model : split(FLAGS_m, ',')) {
+            // Cold runs create a new Core every time, so the plugin is loaded and initialized again.
+            // The files stay in the page cache of the OS, it should be dropped between the runs of the tool
+            // to measure the startup from the disk.
+            std::vector<PhaseTimes> coldRuns;
+            for (uint32_t run = 0; run < FLAGS_n; run++) {
+                InferenceEngine::Core ie;
+                coldRuns.push_back(runOnce(ie, model));
+            }
+
+            std::vector<PhaseTimes> warmRuns;
+            InferenceEngine::Core ie;
+            runOnce(ie, model);
+            for (uint32_t run = 0; run < FLAGS_n; run++) {
+                warmRuns.push_back(runOnce(ie, model));
+            }
+
+            printStatistics(model, "cold", coldRuns);
+            printStatistics(model, "warm", warmRuns);
+
+            if (csv.is_open()) {
+                for (auto &runs : {std::make_pair("cold", &coldRuns), std::make_pair("warm", &warmRuns)}) {
+                    for (size_t run = 0; run < runs.second->size(); run++) {
+                        for (auto &phase : (*runs.second)[run]) {
+                            csv << model << ";" << runs.first << ";" << run << ";" << phase.first << ";"
+                                << phase.second << std::endl;
+                        }
+                    }
+                }
+            }
+        }
+    } catch (const std::exception &error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Done" << std::endl;
+    return EXIT_SUCCESS;
+}